@@ -1148,6 +1148,10 @@ public class ShrCCommand extends Command
 				CommandUtils.dbgPrint(out, "\tJCL %d  VM %d  ROMSTRING %d  ZIPCACHE %d  STARTUPHINTS %d\n", numByteOfType[(int) J9SHR_DATA_TYPE_JCL], numByteOfType[(int) J9SHR_DATA_TYPE_VM], numByteOfType[(int) J9SHR_DATA_TYPE_ROMSTRING], numByteOfType[(int) J9SHR_DATA_TYPE_ZIPCACHE], numByteOfType[(int) J9SHR_DATA_TYPE_STARTUP_HINTS]);
 			}
 			CommandUtils.dbgPrint(out, "\tJITHINT %d  AOTCLASSCHAIN %d AOTTHUNK %d\n", numByteOfType[(int) J9SHR_DATA_TYPE_JITHINT], numByteOfType[(int) J9SHR_DATA_TYPE_AOTCLASSCHAIN], numByteOfType[(int) J9SHR_DATA_TYPE_AOTTHUNK]);
+			/* J9SHR_DATA_TYPE_LOOKUPINDEX is 0 for caches created before the type existed */
+			if ((J9SHR_DATA_TYPE_LOOKUPINDEX > 0) && (J9SHR_DATA_TYPE_LOOKUPINDEX <= J9SHR_DATA_TYPE_MAX)) {
+				CommandUtils.dbgPrint(out, "\tLOOKUPINDEX %d\n", numByteOfType[(int) J9SHR_DATA_TYPE_LOOKUPINDEX]);
+			}
 			if (cacheletMetaLen > 0) {
 				CommandUtils.dbgPrint(out, "CACHELET count %d (without segments %d) metadata %d\n", numCachelets, numCacheletsNoSegments, cacheletMetaLen);
 			}
@@ -1388,6 +1392,8 @@ public class ShrCCommand extends Command
 			return "AOTCLASSCHAIN";
 		} else if (type == J9SHR_DATA_TYPE_AOTTHUNK) {
 			return "AOTTHUNK";
+		} else if ((J9SHR_DATA_TYPE_LOOKUPINDEX > 0) && (type == J9SHR_DATA_TYPE_LOOKUPINDEX)) {
+			return "LOOKUPINDEX";
 		} else {
 			return "UNKNOWN(" + type + ")";
 		}
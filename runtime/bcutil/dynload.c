@@ -557,6 +557,7 @@ readFile (J9JavaVM * javaVM) {
 		goto _failedFileRead;
 	}
 	javaVM->dynamicLoadBuffers->currentSunClassFileSize = fileSize;
+	javaVM->dynamicLoadBuffers->currentSunClassFileData = javaVM->dynamicLoadBuffers->sunClassFileBuffer;
 	j9file_close(fd);
 	return 0;
 
@@ -619,6 +620,7 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 	}
 
 	javaVM->dynamicLoadBuffers->currentSunClassFileSize = size;
+	javaVM->dynamicLoadBuffers->currentSunClassFileData = javaVM->dynamicLoadBuffers->sunClassFileBuffer;
 
   finished:
   	zipFunctions->zip_freeZipEntry(VMI, &entry);
@@ -652,14 +654,23 @@ readFileFromJImage (J9VMThread *vmThread, J9Module *j9module, U_8 *moduleName, J
 
 	rc = jimageIntf->jimageFindResource(jimageIntf, jimageHandle, (const char *)moduleName, resourceName, &resourceLocation, &size);
 	if (J9JIMAGE_NO_ERROR == rc) {
+		const U_8 *classData = NULL;
+
 		Trc_BCU_readFileFromJImage_LookupPassed_V1(moduleName, resourceName);
-		if (checkSunClassFileBuffers(javaVM, (U_32)size)) {
+		/* Use the class bytes in place if the jimage file is mapped, avoiding the copy */
+		rc = jimageIntf->jimageGetResourceData(jimageIntf, jimageHandle, resourceLocation, &classData, NULL);
+		if (J9JIMAGE_NO_ERROR == rc) {
+			dynamicLoadBuffers->currentSunClassFileData = (U_8 *)classData;
+			dynamicLoadBuffers->currentSunClassFileSize = (UDATA)size;
+			rc = 0;
+		} else if (checkSunClassFileBuffers(javaVM, (U_32)size)) {
 			/* Out of memory. */
 			Trc_BCU_readFileFromJImage_BufferAllocationFailed_V1(moduleName, resourceName, size);
 			rc = -1;
 		} else {
 			rc = jimageIntf->jimageGetResource(jimageIntf, jimageHandle, resourceLocation, (char *)dynamicLoadBuffers->sunClassFileBuffer, dynamicLoadBuffers->sunClassFileSize, NULL);
 			if (J9JIMAGE_NO_ERROR == rc) {
+				dynamicLoadBuffers->currentSunClassFileData = dynamicLoadBuffers->sunClassFileBuffer;
 				dynamicLoadBuffers->currentSunClassFileSize = (UDATA)size;
 				rc = 0;
 			} else {
@@ -171,12 +171,14 @@ initJImageIntfCommon(J9JImageIntf **jimageIntf, J9JavaVM *vm, J9PortLibrary *por
 		intf->vm = vm;
 		intf->portLib = portLibrary;
 		intf->libJImageHandle = libJImageHandle;
+		intf->mapResources = TRUE;
 
 		intf->jimageOpen = jimageOpen;
 		intf->jimageClose = jimageClose;
 		intf->jimageFindResource = jimageFindResource;
 		intf->jimageFreeResourceLocation = jimageFreeResourceLocation;
 		intf->jimageGetResource = jimageGetResource;
+		intf->jimageGetResourceData = jimageGetResourceData;
 #if JAVA_SPEC_VERSION < 26
 		intf->jimagePackageToModule = jimagePackageToModule;
 #endif /* JAVA_SPEC_VERSION < 26 */
@@ -193,11 +195,20 @@ initJImageIntf(J9JImageIntf **jimageIntf, J9JavaVM *vm, J9PortLibrary *portLibra
 	UDATA libJImageHandle = 0;
 	IDATA argIndex1 = -1;
 	IDATA argIndex2 = -1;
+	BOOLEAN mapResources = TRUE;
 	I_32 rc = J9JIMAGE_NO_ERROR;
 	PORT_ACCESS_FROM_PORT(portLibrary);
 
 	Trc_BCU_Assert_True(NULL != jimageIntf);
 
+	/* Check for -XX:+MapJImageResources and -XX:-MapJImageResources; whichever comes later wins. */
+	argIndex1 = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXMAPJIMAGERESOURCES, NULL);
+	argIndex2 = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOMAPJIMAGERESOURCES, NULL);
+
+	if (argIndex2 > argIndex1) {
+		mapResources = FALSE;
+	}
+
 	/* Check for -XX:+UseJ9JImageReader and -XX:-UseJ9JImageReader; whichever comes later wins. */
 	argIndex1 = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXUSEJ9JIMAGEREADER, NULL);
 	argIndex2 = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOUSEJ9JIMAGEREADER, NULL);
@@ -226,6 +237,9 @@ initJImageIntf(J9JImageIntf **jimageIntf, J9JavaVM *vm, J9PortLibrary *portLibra
 	}
 
 	rc = initJImageIntfCommon(jimageIntf, vm, portLibrary, libJImageHandle);
+	if (J9JIMAGE_NO_ERROR == rc) {
+		(*jimageIntf)->mapResources = mapResources;
+	}
 
 _end:
 	return rc;
@@ -289,8 +303,17 @@ jimageOpen(J9JImageIntf *jimageIntf, const char *name, UDATA *handle)
 	} else {
 		J9JImage *j9jimage = NULL;
 
-		rc = j9bcutil_loadJImage(PORTLIB, name, &j9jimage);
+		rc = j9bcutil_loadJImage(PORTLIB, name, jimageIntf->mapResources, &j9jimage);
 		if (J9JIMAGE_NO_ERROR == rc) {
+			J9JavaVM *vm = jimageIntf->vm;
+
+			if ((NULL != vm) && (0 != (vm->verboseLevel & VERBOSE_DYNLOAD))) {
+				if (NULL != j9jimage->fileData) {
+					j9tty_printf(PORTLIB, "JImage file %s is mapped entirely\n", name);
+				} else {
+					j9tty_printf(PORTLIB, "Only the metadata of jimage file %s is mapped\n", name);
+				}
+			}
 			*handle = (UDATA)j9jimage;
 		}
 	}
@@ -419,6 +442,31 @@ jimageGetResource(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation
 	return rc;
 }
 
+I_32
+jimageGetResourceData(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, const U_8 **data, I_64 *resourceSize)
+{
+	I_32 rc = J9JIMAGE_RESOURCE_NOT_MAPPED;
+	PORT_ACCESS_FROM_PORT(jimageIntf->portLib);
+
+	Trc_BCU_Assert_True(NULL != data);
+
+	*data = NULL;
+	/* libjimage only provides a copying interface */
+	if (0 == jimageIntf->libJImageHandle) {
+		J9JImage *jimage = (J9JImage *)handle;
+		J9JImageLocation *j9jimageLocation = (J9JImageLocation *)resourceLocation;
+
+		rc = j9bcutil_getJImageResourceData(PORTLIB, jimage, j9jimageLocation, data);
+
+		if (J9JIMAGE_NO_ERROR == rc) {
+			if (NULL != resourceSize) {
+				*resourceSize = j9jimageLocation->uncompressedSize;
+			}
+		}
+	}
+	return rc;
+}
+
 #if JAVA_SPEC_VERSION < 26
 const char *
 jimagePackageToModule(J9JImageIntf *jimageIntf, UDATA handle, const char *packageName)
@@ -104,7 +104,7 @@ _end:
 }
 
 I_32
-j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, J9JImage **pjimage)
+j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, BOOLEAN mapResources, J9JImage **pjimage)
 {
 	IDATA jimagefd = -1;
 	UDATA pageSize = 0;
@@ -171,22 +171,42 @@ j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, J9JImage **pji
 	jimage->fileLength = fileSize;
 	j9jimageHeader = jimage->j9jimageHeader = (J9JImageHeader *)((U_8 *)jimage + sizeof(J9JImage) + (fileNameLen + 1));
 
-	/* Map JImage header, redirect table, locationsOffsetTable, ImageLocations and Strings
-	 * Format of the above structures in jimage is:
-	 * 	| JImageHeader | Redirect Table (s4*tableLength) | LocationsOffsetTable (u4*tableLength) | Locations | Strings | ... |
-	 */
-	mapSize = JIMAGE_RESOURCE_AREA_OFFSET(header);
-	pageSize = j9mmap_get_region_granularity(j9jimageHeader);
-	if (0 != pageSize) {
-		mapSize = ROUND_UP_TO(pageSize, mapSize);
-	}
 #if defined(J9ZOS390)
 	/*
 	 * With OMRPORT_MMAP_FLAG_ZOS_READ_MAPFILE, j9mmap_map_file() has the old bahaviour that reads the file content into allocated private memory.
+	 * Reading all of the resources up front would defeat the purpose, so only the metadata is mapped.
 	 */
 	mmapflag = OMRPORT_MMAP_FLAG_ZOS_READ_MAPFILE;
+#else /* defined(J9ZOS390) */
+	/* Map the whole file read-only so that the resources can be accessed in place
+	 * rather than read into a buffer. If that is disabled (-XX:-MapJImageResources)
+	 * or the address space cannot accommodate the whole file, fall back to mapping
+	 * the metadata only.
+	 */
+	if (mapResources && ((UDATA)fileSize == (U_64)fileSize)) {
+		jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, (UDATA)fileSize, fileName, mmapflag, J9MEM_CATEGORY_CLASSES);
+		if (NULL != jimage->jimageMmap) {
+			jimage->fileData = (U_8 *)jimage->jimageMmap->pointer;
+		} else {
+			I_32 portlibErrCode = j9error_last_error_number();
+			const char *portlibErrMsg = j9error_last_error_message();
+			Trc_BCU_loadJImage_JImageFullMmapFailed((UDATA)fileSize, fileName, portlibErrCode, portlibErrMsg);
+		}
+	}
 #endif /* defined(J9ZOS390) */
-	jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, mapSize, fileName, mmapflag, J9MEM_CATEGORY_CLASSES);
+
+	/* Map JImage header, redirect table, locationsOffsetTable, ImageLocations and Strings
+	 * Format of the above structures in jimage is:
+	 * 	| JImageHeader | Redirect Table (s4*tableLength) | LocationsOffsetTable (u4*tableLength) | Locations | Strings | ... |
+	 */
+	if (NULL == jimage->jimageMmap) {
+		mapSize = JIMAGE_RESOURCE_AREA_OFFSET(header);
+		pageSize = j9mmap_get_region_granularity(j9jimageHeader);
+		if (0 != pageSize) {
+			mapSize = ROUND_UP_TO(pageSize, mapSize);
+		}
+		jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, mapSize, fileName, mmapflag, J9MEM_CATEGORY_CLASSES);
+	}
 	if (NULL == jimage->jimageMmap) {
 		I_32 portlibErrCode = j9error_last_error_number();
 		const char *portlibErrMsg = j9error_last_error_message();
@@ -535,6 +555,52 @@ _end:
 	return rc;
 }
 
+/**
+ * Returns a pointer to the data of a resource in the mapped jimage file.
+ *
+ * @param [in] jimage pointer to J9JImage representing jimage file
+ * @param [in] j9jimageLocation pointer to J9JImageLocation containing metadata of the resource
+ * @param [in] dataSize number of bytes of the resource data to be accessed
+ *
+ * @return pointer to the resource data, or NULL if the jimage file is not mapped entirely
+ * 		   or the resource data is outside the file
+ */
+static U_8 *
+getMappedResourceData(J9JImage *jimage, J9JImageLocation *j9jimageLocation, U_64 dataSize)
+{
+	U_8 *resourceData = NULL;
+
+	if ((NULL != jimage->fileData)
+		&& (j9jimageLocation->resourceOffset <= jimage->fileLength)
+		&& (dataSize <= (jimage->fileLength - j9jimageLocation->resourceOffset))
+	) {
+		resourceData = jimage->fileData + j9jimageLocation->resourceOffset;
+	}
+	return resourceData;
+}
+
+I_32
+j9bcutil_getJImageResourceData(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, const U_8 **resourceData)
+{
+	I_32 rc = J9JIMAGE_RESOURCE_NOT_MAPPED;
+
+	Trc_BCU_Assert_NotEquals(NULL, jimage);
+	Trc_BCU_Assert_NotEquals(NULL, resourceData);
+
+	*resourceData = NULL;
+
+	/* Compressed resources have to be inflated into a buffer by j9bcutil_getJImageResource() */
+	if (0 == j9jimageLocation->compressedSize) {
+		U_8 *data = getMappedResourceData(jimage, j9jimageLocation, j9jimageLocation->uncompressedSize);
+
+		if (NULL != data) {
+			*resourceData = data;
+			rc = J9JIMAGE_NO_ERROR;
+		}
+	}
+	return rc;
+}
+
 I_32
 j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, void *dataBuffer, U_64 dataBufferSize)
 {
@@ -542,8 +608,11 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 	JImageHeader *jimageHeader = NULL;
 	I_64 seekResult = -1;
 	IDATA bytesRead = 0;
+	U_8 *resourceData = NULL;
+	U_8 *allocatedInputBuffer = NULL;
 	U_8 *inputBuffer = NULL;
 	U_8 *outputBuffer = NULL;
+	U_64 resourceSize = 0;
 	I_32 rc = J9JIMAGE_NO_ERROR;
 
 	PORT_ACCESS_FROM_PORT(portlib);
@@ -556,32 +625,44 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 	j9jimageHeader = jimage->j9jimageHeader;
 	jimageHeader = j9jimageHeader->jimageHeader;
 
-	seekResult = j9file_seek(jimage->fd, (I_64)j9jimageLocation->resourceOffset, EsSeekSet);
-	if (-1 == seekResult) {
-		I_32 portlibErrCode = j9error_last_error_number();
-		const char *portlibErrMsg = j9error_last_error_message();
-		Trc_BCU_getJImageResource_JImageFileSeekFailed(jimage->fileName, j9jimageLocation->resourceOffset, portlibErrCode, portlibErrMsg);
-		rc = J9JIMAGE_FILE_SEEK_ERROR;
-		goto _end;
+	resourceSize = (0 != j9jimageLocation->compressedSize) ? j9jimageLocation->compressedSize : j9jimageLocation->uncompressedSize;
+	resourceData = getMappedResourceData(jimage, j9jimageLocation, resourceSize);
+
+	if (NULL == resourceData) {
+		seekResult = j9file_seek(jimage->fd, (I_64)j9jimageLocation->resourceOffset, EsSeekSet);
+		if (-1 == seekResult) {
+			I_32 portlibErrCode = j9error_last_error_number();
+			const char *portlibErrMsg = j9error_last_error_message();
+			Trc_BCU_getJImageResource_JImageFileSeekFailed(jimage->fileName, j9jimageLocation->resourceOffset, portlibErrCode, portlibErrMsg);
+			rc = J9JIMAGE_FILE_SEEK_ERROR;
+			goto _end;
+		}
 	}
 
 	if (0 != j9jimageLocation->compressedSize) {
 		DecompressorInfo *decompressorInfo = NULL;
 		char *decompressorName = NULL;
+		BOOLEAN lastDecompressor = FALSE;
 
-		inputBuffer = j9mem_allocate_memory((UDATA)j9jimageLocation->compressedSize, J9MEM_CATEGORY_CLASSES);
-		if (NULL == inputBuffer) {
-			Trc_BCU_getJImageResource_MemoryAllocationFailed(jimage->fileName, j9jimageLocation->compressedSize);
-			rc = J9JIMAGE_OUT_OF_MEMORY;
-			goto _end;
-		}
-		bytesRead = j9file_read(jimage->fd, inputBuffer, (UDATA)j9jimageLocation->compressedSize);
-		if (j9jimageLocation->compressedSize != bytesRead) {
-			I_32 portlibErrCode = j9error_last_error_number();
-			const char *portlibErrMsg = j9error_last_error_message();
-			Trc_BCU_getJImageResource_JImageReadResourceDataFailed(jimage->fileName, bytesRead, j9jimageLocation->compressedSize, portlibErrCode, portlibErrMsg);
-			rc = J9JIMAGE_FILE_READ_ERROR;
-			goto _end;
+		if (NULL != resourceData) {
+			/* Decompress straight from the mapped file */
+			inputBuffer = resourceData;
+		} else {
+			allocatedInputBuffer = j9mem_allocate_memory((UDATA)j9jimageLocation->compressedSize, J9MEM_CATEGORY_CLASSES);
+			if (NULL == allocatedInputBuffer) {
+				Trc_BCU_getJImageResource_MemoryAllocationFailed(jimage->fileName, j9jimageLocation->compressedSize);
+				rc = J9JIMAGE_OUT_OF_MEMORY;
+				goto _end;
+			}
+			bytesRead = j9file_read(jimage->fd, allocatedInputBuffer, (UDATA)j9jimageLocation->compressedSize);
+			if (j9jimageLocation->compressedSize != bytesRead) {
+				I_32 portlibErrCode = j9error_last_error_number();
+				const char *portlibErrMsg = j9error_last_error_message();
+				Trc_BCU_getJImageResource_JImageReadResourceDataFailed(jimage->fileName, bytesRead, j9jimageLocation->compressedSize, portlibErrCode, portlibErrMsg);
+				rc = J9JIMAGE_FILE_READ_ERROR;
+				goto _end;
+			}
+			inputBuffer = allocatedInputBuffer;
 		}
 
 		do {
@@ -624,38 +705,51 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 			/* If decompressorFlag is 0 then the inflated data itself is in compressed format.
 			 * Loop until we find decompressorFlag set to 1 which would mean no more decompression is required.
 			 */
-			if (0 == decompressorInfo->decompressorFlag) {
-				inputBuffer = outputBuffer;
-			} else {
-				/* This is the last decompressor. */
+			lastDecompressor = (0 != decompressorInfo->decompressorFlag);
+			if (lastDecompressor) {
 				IDATA bytesToCopy = (dataBufferSize < decompressorInfo->uncompressedSize) ? (IDATA)dataBufferSize : (IDATA)decompressorInfo->uncompressedSize;
 				memcpy(dataBuffer, outputBuffer, bytesToCopy);
 				if (dataBufferSize < decompressorInfo->uncompressedSize) {
 					rc = J9JIMAGE_RESOURCE_TRUNCATED;
 				}
 				j9mem_free_memory(outputBuffer);
+				outputBuffer = NULL;
+			}
+
+			/* The input of this pass is no longer needed; data in the mapped file is never freed */
+			if (NULL != allocatedInputBuffer) {
+				j9mem_free_memory(allocatedInputBuffer);
+				allocatedInputBuffer = NULL;
+			}
+			if (!lastDecompressor) {
+				inputBuffer = outputBuffer;
+				allocatedInputBuffer = outputBuffer;
+				outputBuffer = NULL;
 			}
-			j9mem_free_memory(decompressorInfo);
-		} while (0 == decompressorInfo->decompressorFlag);
+		} while (!lastDecompressor);
 	} else {
 		IDATA bytesToRead = (dataBufferSize < j9jimageLocation->uncompressedSize) ? (IDATA)dataBufferSize : (IDATA)j9jimageLocation->uncompressedSize;
-		bytesRead = j9file_read(jimage->fd, dataBuffer, bytesToRead);
-		if (bytesToRead != bytesRead) {
-			I_32 portlibErrCode = j9error_last_error_number();
-			const char *portlibErrMsg = j9error_last_error_message();
-			Trc_BCU_getJImageResource_JImageReadResourceDataFailed(jimage->fileName, bytesRead, bytesToRead, portlibErrCode, portlibErrMsg);
-			rc = J9JIMAGE_FILE_READ_ERROR;
-			goto _end;
+
+		if (NULL != resourceData) {
+			memcpy(dataBuffer, resourceData, bytesToRead);
 		} else {
-			if (dataBufferSize < j9jimageLocation->uncompressedSize) {
-				rc = J9JIMAGE_RESOURCE_TRUNCATED;
+			bytesRead = j9file_read(jimage->fd, dataBuffer, bytesToRead);
+			if (bytesToRead != bytesRead) {
+				I_32 portlibErrCode = j9error_last_error_number();
+				const char *portlibErrMsg = j9error_last_error_message();
+				Trc_BCU_getJImageResource_JImageReadResourceDataFailed(jimage->fileName, bytesRead, bytesToRead, portlibErrCode, portlibErrMsg);
+				rc = J9JIMAGE_FILE_READ_ERROR;
+				goto _end;
 			}
 		}
+		if (dataBufferSize < j9jimageLocation->uncompressedSize) {
+			rc = J9JIMAGE_RESOURCE_TRUNCATED;
+		}
 	}
 
 _end:
-	if (NULL != inputBuffer) {
-		j9mem_free_memory(inputBuffer);
+	if (NULL != allocatedInputBuffer) {
+		j9mem_free_memory(allocatedInputBuffer);
 	}
 	if ((NULL != outputBuffer) && (outputBuffer != dataBuffer)) {
 		j9mem_free_memory(outputBuffer);
@@ -826,6 +920,7 @@ j9bcutil_unloadJImage(J9PortLibrary *portlib, J9JImage *jimage)
 		if (NULL != jimage->jimageMmap) {
 			j9mmap_unmap_file(jimage->jimageMmap);
 			jimage->jimageMmap = NULL;
+			jimage->fileData = NULL;
 		}
 		if (-1 != jimage->fd) {
 			j9file_close(jimage->fd);
@@ -6951,7 +6951,7 @@ UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
 		case SOURCE_jimage:
 		{
 			J9JImage *jimage = NULL;
-			result = j9bcutil_loadJImage(PORTLIB, options.sourceString, &jimage);
+			result = j9bcutil_loadJImage(PORTLIB, options.sourceString, TRUE, &jimage);
 			if (J9JIMAGE_NO_ERROR != result) {
 				j9tty_printf(PORTLIB, "Error in loading jimage file %s. Error code=%d\n", options.sourceString, result);
 				result = RET_JIMAGE_LOADJIMAGE_FAILED;
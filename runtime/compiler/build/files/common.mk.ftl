@@ -417,6 +417,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/Message.cpp \
     compiler/net/MessageTypes.cpp \
     compiler/net/ServerStream.cpp \
+    compiler/net/TrafficRecorder.cpp \
     compiler/runtime/CompileService.cpp \
     compiler/runtime/JITClientSession.cpp \
     compiler/runtime/JITServerAOTCache.cpp \
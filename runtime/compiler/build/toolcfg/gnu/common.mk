@@ -524,6 +524,11 @@ endif
 SOLINK_FLAGS+=$(SOLINK_FLAGS_EXTRA)
 
 ifneq ($(J9VM_OPT_JITSERVER),)
+    # Used for JITServer message compression; already linked on z.
+    ifneq ($(HOST_ARCH),z)
+        SOLINK_SLINK+=j9zlib$(J9_VERSION)
+    endif
+
     ifneq ($(OPENSSL_CFLAGS),)
         C_FLAGS+=$(OPENSSL_CFLAGS)
         CXX_FLAGS+=$(OPENSSL_CFLAGS)
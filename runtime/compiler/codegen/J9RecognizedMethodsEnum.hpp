@@ -695,6 +695,7 @@ FirstJ9Method = LastOMRMethod + 1,
     java_lang_invoke_VarHandleByteArrayAsX_ByteBufferHandle_method,
 
     jdk_internal_foreign_layout_ValueLayouts_AbstractValueLayout_accessHandle,
+    openj9_internal_foreign_abi_InternalDowncallHandler_invokeNative,
     jdk_internal_foreign_AbstractMemorySegmentImpl_reinterpret, java_lang_foreign_MemorySegment_method,
 
     // Clone and Deep Copy
@@ -785,6 +785,13 @@ public:
     TR_MethodToBeCompiled *addOutOfProcessMethodToBeCompiled(JITServer::ServerStream *stream);
 #endif /* defined(J9VM_OPT_JITSERVER) */
     void queueEntry(TR_MethodToBeCompiled *entry);
+    /**
+     * @brief Detach an entry from the compilation queue. Must have compilationQueueMonitor in hand.
+     *        The priority of a queued entry must not be changed before it is detached.
+     * @param prev The entry that precedes \p entry in the queue, or NULL if \p entry is at the head
+     * @param entry The entry to be detached
+     */
+    void dequeueEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry);
     void recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
     void requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
@@ -1535,6 +1542,15 @@ private:
      */
     TR_MethodToBeCompiled *getCompilationQueueEntry();
 
+    /**
+     * @brief Find the entry after which a request with the given priority must be inserted in the queue
+     *        so that the queue stays sorted by priority and FIFO within a priority.
+     * @param priority The priority of the request to be inserted
+     * @param levelIndex Set to the index in _methodQueueLevels where the priority is, or should be, tracked
+     * @return The entry after which to insert, or NULL if the request must become the head of the queue
+     */
+    TR_MethodToBeCompiled *findQueueInsertionPoint(uint16_t priority, int32_t &levelIndex);
+
     J9Method *getRamMethod(TR_FrontEnd *vm, char *className, char *methodName, char *signature);
     // char *buildMethodString(TR_ResolvedMethod *method);
 
@@ -1549,6 +1565,19 @@ private:
     TR::CompilationInfoPerThread **_arrayOfCompilationInfoPerThread; // First NULL entry means end of the array
     TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
     TR_MethodToBeCompiled *_methodQueue;
+
+    // Index over _methodQueue: for each of the distinct priorities present in the queue, remember the last
+    // entry with that priority. Sorted by decreasing priority. This makes queueEntry proportional to the
+    // number of distinct priorities rather than the length of the queue. When more than
+    // METHOD_QUEUE_MAX_LEVELS priorities are queued, the extra ones are found by walking the queue.
+    struct MethodQueueLevel {
+        uint16_t _priority;
+        TR_MethodToBeCompiled *_tail;
+    };
+
+    static const int32_t METHOD_QUEUE_MAX_LEVELS = 16;
+    MethodQueueLevel _methodQueueLevels[METHOD_QUEUE_MAX_LEVELS];
+    int32_t _numMethodQueueLevels;
     TR_MethodToBeCompiled *_methodPool;
     int32_t _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -105,6 +105,7 @@
 #include "control/JITServerHelpers.hpp"
 #include "runtime/JITClientSession.hpp"
 #include "runtime/JITServerAOTDeserializer.hpp"
+#include "runtime/Listener.hpp"
 #include "runtime/OMRRSSReport.hpp"
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
@@ -1963,10 +1964,7 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class *clazz, J9V
             }
 
             // detach from queue
-            if (prev)
-                prev->_next = cur->_next;
-            else
-                _methodQueue = cur->_next;
+            dequeueEntry(prev, cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
@@ -2063,10 +2061,7 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                     }
                 }
                 // detach from queue
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                dequeueEntry(prev, cur);
                 updateCompQueueAccountingOnDequeue(cur);
                 // decrease the queue weight
                 decreaseQueueWeightBy(cur->_weight);
@@ -2400,7 +2395,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
 
     while (_methodQueue) {
         TR_MethodToBeCompiled *cur = _methodQueue;
-        _methodQueue = cur->_next;
+        dequeueEntry(NULL, cur);
         updateCompQueueAccountingOnDequeue(cur);
         // decrease the queue weight
         decreaseQueueWeightBy(cur->_weight);
@@ -3396,6 +3391,13 @@ void TR::CompilationInfo::stopCompilationThreads()
         if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) {
             fprintf(stderr, "Number of connections opened = %u\n", JITServer::ServerStream::getNumConnectionsOpened());
             fprintf(stderr, "Number of connections closed = %u\n", JITServer::ServerStream::getNumConnectionsClosed());
+            TR_Listener *listener = ((TR_JitPrivateConfig *)_jitConfig->privateConfig)->listener;
+            if (listener) {
+                fprintf(stderr, "Number of idle connections parked = %" OMR_PRIuPTR "\n",
+                    listener->getNumParkedConnections());
+                fprintf(stderr, "Number of parked connections closed at shutdown = %" OMR_PRIuPTR "\n",
+                    listener->getNumParkedConnectionsClosedAtShutdown());
+            }
         } else if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT) {
             fprintf(stderr, "Number of connections opened = %u\n", JITServer::ClientStream::getNumConnectionsOpened());
             fprintf(stderr, "Number of connections closed = %u\n", JITServer::ClientStream::getNumConnectionsClosed());
@@ -4651,10 +4653,15 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         if (pc)
             cur->_oldStartPC = pc;
 
-        // If the priority has increased, use the new priority
+        // If the priority has increased, use the new priority.
+        // The entry must be taken out of the queue before its priority changes
         //
-        if (cur->_priority < priority)
+        bool priorityIncreased = false;
+        if (cur->_priority < priority) {
+            dequeueEntry(prev, cur); // take it out of the queue; it will be put back below
             cur->_priority = priority;
+            priorityIncreased = true;
+        }
         // If the optimization level is higher, just upgrade
         // (unless the methods has excessive complexity)
         //
@@ -4668,14 +4675,13 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
                         cur->_optimizationPlan->insertInstrumentation());
             }
         }
-        // If the position in the queue is still correct, just return
+        // If the priority did not change, the position in the queue is still correct
         //
-        if (!prev || prev->_priority >= cur->_priority)
+        if (!priorityIncreased)
             return cur;
 
-        // Must re-position in the queue
+        // Must re-position in the queue (the entry has already been taken out)
         //
-        prev->_next = cur->_next; // take it out of the queue
     }
 
     // If method is not yet in the queue prepare the queue entry
@@ -4898,16 +4904,83 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
     entry->_freeTag |= ENTRY_QUEUED;
 
-    if (!_methodQueue || _methodQueue->_priority < entry->_priority) {
+    int32_t levelIndex;
+    TR_MethodToBeCompiled *prev = findQueueInsertionPoint(entry->_priority, levelIndex);
+    if (!prev) {
         entry->_next = _methodQueue;
         _methodQueue = entry;
     } else {
-        for (TR_MethodToBeCompiled *prev = _methodQueue;; prev = prev->_next) {
-            if (!prev->_next || prev->_next->_priority < entry->_priority) {
-                entry->_next = prev->_next;
-                prev->_next = entry;
-                break;
+        entry->_next = prev->_next;
+        prev->_next = entry;
+    }
+
+    // The new entry is now the last one with its priority
+    if (levelIndex < _numMethodQueueLevels && _methodQueueLevels[levelIndex]._priority == entry->_priority) {
+        _methodQueueLevels[levelIndex]._tail = entry;
+    } else if (_numMethodQueueLevels < METHOD_QUEUE_MAX_LEVELS) {
+        for (int32_t i = _numMethodQueueLevels; i > levelIndex; i--)
+            _methodQueueLevels[i] = _methodQueueLevels[i - 1];
+        _methodQueueLevels[levelIndex]._priority = entry->_priority;
+        _methodQueueLevels[levelIndex]._tail = entry;
+        _numMethodQueueLevels++;
+    }
+    // Otherwise too many distinct priorities are queued; this one is not tracked
+}
+
+//----------------------- findQueueInsertionPoint ------------------------
+// Return the last entry in the queue with a priority greater than or
+// equal to the given priority (NULL if there is none). Must have
+// compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled *TR::CompilationInfo::findQueueInsertionPoint(uint16_t priority, int32_t &levelIndex)
+{
+    // Levels are sorted by decreasing priority; find the first one that is not higher than the given priority
+    int32_t i = 0;
+    while (i < _numMethodQueueLevels && _methodQueueLevels[i]._priority > priority)
+        i++;
+    levelIndex = i;
+
+    if (i < _numMethodQueueLevels && _methodQueueLevels[i]._priority == priority)
+        return _methodQueueLevels[i]._tail;
+
+    // Start from the last entry of the closest higher priority (or from the head of the queue)
+    // and skip over any entries whose priorities are not tracked
+    TR_MethodToBeCompiled *prev = i > 0 ? _methodQueueLevels[i - 1]._tail : NULL;
+    TR_MethodToBeCompiled *next = prev ? prev->_next : _methodQueue;
+    while (next && next->_priority >= priority) {
+        prev = next;
+        next = next->_next;
+    }
+    return prev;
+}
+
+//--------------------------- dequeueEntry -------------------------------
+// Detach the entry from the queue. prev must be the entry that precedes
+// it in the queue (NULL if entry is the head of the queue). Must have
+// compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::dequeueEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry)
+{
+    TR_ASSERT(prev ? prev->_next == entry : _methodQueue == entry, "prev %p does not precede entry %p", prev, entry);
+
+    if (prev)
+        prev->_next = entry->_next;
+    else
+        _methodQueue = entry->_next;
+
+    for (int32_t i = 0; i < _numMethodQueueLevels; i++) {
+        if (_methodQueueLevels[i]._priority == entry->_priority) {
+            if (_methodQueueLevels[i]._tail == entry) {
+                if (prev && prev->_priority == entry->_priority) {
+                    _methodQueueLevels[i]._tail = prev;
+                } else {
+                    // That was the last entry with this priority
+                    _numMethodQueueLevels--;
+                    for (; i < _numMethodQueueLevels; i++)
+                        _methodQueueLevels[i] = _methodQueueLevels[i + 1];
+                }
             }
+            break;
         }
     }
 }
@@ -4967,10 +5040,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
 
             if (cur->_priority < priority) {
                 // take the method out
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                dequeueEntry(prev, cur);
                 // put it back at its proper place
                 cur->_priority = priority;
                 queueEntry(cur);
@@ -5012,24 +5082,12 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method *method, void *p
 #ifdef STATS
     fprintf(stderr, "Promoting method in queue QSZ=%d\n", getMethodQueueSize());
 #endif
-    cur->_priority = CP_ASYNC_MAX;
 
-    // take the method out
-    prev->_next = cur->_next;
-    // find insertion point
-    if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-    {
-        cur->_next = _methodQueue;
-        _methodQueue = cur;
-        // FIXME: how about the compilation lag
-    } else {
-        for (prev = _methodQueue; prev->_next; prev = prev->_next)
-            if (prev->_next->_priority < CP_ASYNC_MAX) {
-                cur->_next = prev->_next;
-                prev->_next = cur;
-                break;
-            }
-    }
+    // take the method out and insert it back at its proper place
+    // FIXME: how about the compilation lag
+    dequeueEntry(prev, cur);
+    cur->_priority = CP_ASYNC_MAX;
+    queueEntry(cur);
     return i;
 }
 
@@ -5060,15 +5118,11 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method *method)
         //
         if (cur && cur->_priority <= CP_ASYNC_MAX) {
             // Take the method out, increase its priority and insert it at the proper place
+            // (if the method is already at the top of the queue it will stay there)
             //
+            dequeueEntry(prev, cur);
             cur->_priority = CP_SYNC_NORMAL;
-            if (prev) {
-                prev->_next = cur->_next;
-                queueEntry(cur);
-            } else // method already at the top of the queue
-            {
-                // Nothing to do
-            }
+            queueEntry(cur);
         } else {
             cur = NULL; // prevent further processing
         }
@@ -5152,7 +5206,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
 
         if (_methodQueue) {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(NULL, nextMethodToBeCompiled);
 
             // See explanation at the start of this function of why it is important to ensure this
             TR_ASSERT_FATAL(nextMethodToBeCompiled->getMethodDetails().isJitDumpMethod(),
@@ -5175,7 +5229,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
 #endif
             ) {
                 nextMethodToBeCompiled = _methodQueue;
-                _methodQueue = _methodQueue->_next;
+                dequeueEntry(NULL, nextMethodToBeCompiled);
             }
             // Check if we need to throttle
             else if (exceedsCompCpuEntitlement() == TR_yes && !compThreadCameOutOfSleep
@@ -5194,7 +5248,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                 _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
             {
                 nextMethodToBeCompiled = _methodQueue;
-                _methodQueue = _methodQueue->_next;
+                dequeueEntry(NULL, nextMethodToBeCompiled);
             } else // scan for a cold/warm method
             {
                 TR_MethodToBeCompiled *prev = _methodQueue;
@@ -5204,7 +5258,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                         nextMethodToBeCompiled->_priority >= CP_SYNC_MIN || // sync comp
                         nextMethodToBeCompiled->_methodIsInSharedCache == TR_yes) // very cheap relocation
                     {
-                        prev->_next = nextMethodToBeCompiled->_next;
+                        dequeueEntry(prev, nextMethodToBeCompiled);
                         break;
                     }
                 }
@@ -6036,11 +6090,9 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread *vmThread, TR::IlG
                     break;
             }
             if (reqMe && reqMe->_priority < CP_ASYNC_ABOVE_NORMAL) {
+                dequeueEntry(prevReq, reqMe);
                 reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-                if (prevReq && prevReq->_priority < CP_ASYNC_ABOVE_NORMAL) {
-                    prevReq->_next = reqMe->_next;
-                    queueEntry(reqMe);
-                }
+                queueEntry(reqMe);
             }
         }
     }
@@ -12154,7 +12206,9 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addOutOfProcessMethodToBeCompiled(JI
         // This needs to be served as soon as possible, so we give it a higher priority
         CompilationPriority priority = (stream == LOAD_AOTCACHE_REQUEST) ? CP_SYNC_BELOW_MAX : CP_SYNC_NORMAL;
         entry->initialize(details, NULL, priority, NULL);
-        if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance)) {
+        // The queue time is also reported by the MetricsServer
+        if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance)
+            || (getPersistentInfo()->getJITServerMetricsPort() != 0)) {
             PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
             entry->_entryTime = j9time_usec_clock();
         }
@@ -12200,7 +12254,16 @@ void TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry)
 
     recycleCompilationEntry(entry);
 
-    if (entry->_stream && addOutOfProcessMethodToBeCompiled(entry->_stream)) {
+    if (!entry->_stream)
+        return;
+
+    // Let the listener thread wait for the next request on this connection, so that
+    // compilation threads do not block in read() on connections of idle clients
+    TR_Listener *listener = ((TR_JitPrivateConfig *)_jitConfig->privateConfig)->listener;
+    if (listener && listener->parkIdleConnection(entry->_stream))
+        return;
+
+    if (addOutOfProcessMethodToBeCompiled(entry->_stream)) {
         // successfully queued the new entry, so notify a thread
         getCompilationMonitor()->notifyAll();
     }
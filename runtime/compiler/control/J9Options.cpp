@@ -441,8 +441,11 @@ J9::ExternalOptionsMetadata J9::Options::_externalOptionsMetadata[J9::ExternalOp
     {                   "-XX:+TrackAOTDependencies",         EXACT_MATCH, -1,  true }, // = 77
     {                   "-XX:-TrackAOTDependencies",         EXACT_MATCH, -1,  true }, // = 78
     {               "-XX:+JITServerUseProfileCache",         EXACT_MATCH, -1,  true }, // = 79
-    {               "-XX:-JITServerUseProfileCache",         EXACT_MATCH, -1,  true }  // = 80
-    // TR_NumExternalOptions                                                              = 81
+    {               "-XX:-JITServerUseProfileCache",         EXACT_MATCH, -1,  true }, // = 80
+    {             "-XX:+JITServerCompressMessages",         EXACT_MATCH, -1,  true }, // = 81
+    {             "-XX:-JITServerCompressMessages",         EXACT_MATCH, -1,  true }, // = 82
+    {                "-XX:JITServerRecordTraffic=",    STARTSWITH_MATCH, -1,  true }  // = 83
+    // TR_NumExternalOptions                                                              = 84
 };
 
 //************************************************************************
@@ -1433,6 +1436,10 @@ bool J9::Options::JITServerParseCommonOptions(J9VMInitArgs *vmArgsArray, J9JavaV
         = getArgIndex(vm, J9::ExternalOptions::XXminusJITServerLogConnections, vmArgsArray, postRestore);
     int32_t xxJITServerAOTmxArgIndex
         = getArgIndex(vm, J9::ExternalOptions::XXJITServerAOTmxOption, vmArgsArray, postRestore);
+    int32_t xxJITServerCompressMessagesArgIndex
+        = getArgIndex(vm, J9::ExternalOptions::XXplusJITServerCompressMessages, vmArgsArray, postRestore);
+    int32_t xxDisableJITServerCompressMessagesArgIndex
+        = getArgIndex(vm, J9::ExternalOptions::XXminusJITServerCompressMessages, vmArgsArray, postRestore);
 
     if (xxJITServerPortArgIndex >= 0) {
         UDATA port = 0;
@@ -1502,6 +1509,12 @@ bool J9::Options::JITServerParseCommonOptions(J9VMInitArgs *vmArgsArray, J9JavaV
         TR::Options::setVerboseOption(TR_VerboseJITServerConns);
     }
 
+    // Message compression is used only if enabled at both the client and the server
+    if (xxJITServerCompressMessagesArgIndex > xxDisableJITServerCompressMessagesArgIndex)
+        compInfo->getPersistentInfo()->setJITServerCompressMessages(true);
+    else if (xxDisableJITServerCompressMessagesArgIndex > xxJITServerCompressMessagesArgIndex)
+        compInfo->getPersistentInfo()->setJITServerCompressMessages(false);
+
     if (xxJITServerAOTmxArgIndex >= 0) {
         uint32_t aotMaxBytes = 0;
         const char *xxJITServerAOTmxOption
@@ -2462,6 +2475,15 @@ bool J9::Options::preProcessJitServer(J9JavaVM *vm, J9JITConfig *jitConfig)
                     compInfo->getPersistentInfo()->setJITServerAOTCacheName(name);
                 }
 
+                int32_t xxJITServerRecordTrafficArgIndex
+                    = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerRecordTrafficOption);
+
+                if (xxJITServerRecordTrafficArgIndex >= 0) {
+                    char *fileName = NULL;
+                    GET_OPTION_VALUE(xxJITServerRecordTrafficArgIndex, '=', &fileName);
+                    compInfo->getPersistentInfo()->setJITServerRecordTrafficFile(fileName);
+                }
+
                 int32_t xxJITServerAOTCacheDelayMethodRelocationArgIndex = J9::Options::getExternalOptionIndex(
                     J9::ExternalOptions::XXplusJITServerAOTCacheDelayMethodRelocation);
                 int32_t xxDisableJITServerAOTCacheDelayMethodRelocationArgIndex = J9::Options::getExternalOptionIndex(
@@ -141,7 +141,10 @@ enum ExternalOptions {
     XXminusTrackAOTDependencies = 78,
     XXplusJITServerUseProfileCache = 79,
     XXminusJITServerUseProfileCache = 80,
-    TR_NumExternalOptions = 81
+    XXplusJITServerCompressMessages = 81,
+    XXminusJITServerCompressMessages = 82,
+    XXJITServerRecordTrafficOption = 83,
+    TR_NumExternalOptions = 84
 };
 
 /**
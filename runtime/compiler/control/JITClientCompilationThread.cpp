@@ -1181,6 +1181,40 @@ static bool handleResponse(JITServer::MessageType response, JITServer::ClientStr
                 isFinal, isPrivate, unresolvedInCP, result);
             client->write(response, attrs);
         } break;
+        case MessageType::ResolvedMethod_getMultipleFieldAttributes: {
+            auto recv = client->getRecvData<TR_ResolvedJ9Method *, std::vector<int32_t>, std::vector<uint8_t>,
+                std::vector<uint8_t> >();
+            TR_ResolvedJ9Method *method = std::get<0>(recv);
+            auto &cpIndices = std::get<1>(recv);
+            auto &isStatic = std::get<2>(recv);
+            auto &isStore = std::get<3>(recv);
+            int32_t numFields = cpIndices.size();
+            std::vector<TR_J9MethodFieldAttributes> attributes;
+            attributes.reserve(numFields);
+            for (int32_t i = 0; i < numFields; ++i) {
+                TR::DataType type = TR::NoType;
+                bool volatileP = true;
+                bool isFinal = false;
+                bool isPrivate = false;
+                bool unresolvedInCP;
+                bool result;
+                uintptr_t fieldOffsetOrAddress;
+                if (isStatic[i]) {
+                    void *address;
+                    result = method->staticAttributes(comp, cpIndices[i], &address, &type, &volatileP, &isFinal,
+                        &isPrivate, isStore[i], &unresolvedInCP, false);
+                    fieldOffsetOrAddress = reinterpret_cast<uintptr_t>(address);
+                } else {
+                    U_32 fieldOffset;
+                    result = method->fieldAttributes(comp, cpIndices[i], &fieldOffset, &type, &volatileP, &isFinal,
+                        &isPrivate, isStore[i], &unresolvedInCP, false);
+                    fieldOffsetOrAddress = static_cast<uintptr_t>(fieldOffset);
+                }
+                attributes.push_back(TR_J9MethodFieldAttributes(fieldOffsetOrAddress, type.getDataType(), volatileP,
+                    isFinal, isPrivate, unresolvedInCP, result));
+            }
+            client->write(response, attributes);
+        } break;
         case MessageType::ResolvedMethod_getResolvedStaticMethodAndMirror: {
             auto recv = client->getRecvData<TR_ResolvedJ9Method *, I_32>();
             auto *method = std::get<0>(recv);
@@ -3064,6 +3098,18 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
 
     auto classInfoTuple = JITServerHelpers::packRemoteROMClassInfo(clazz, compiler->fej9vm()->vmThread(),
         compiler->trMemory(), serializeClass);
+
+    // Prefetch the classes profiled at the call sites of the method being compiled. These are the likely
+    // inlining candidates, which the server would otherwise request one by one during the compilation.
+    std::vector<J9Class *> prefetchedClasses;
+    std::vector<JITServerHelpers::ClassInfoTuple> prefetchedClassInfos;
+    static const bool disableCompilationPrefetch = feGetEnv("TR_DisableJITServerCompilationPrefetch") != NULL;
+    if (!disableCompilationPrefetch && !J9_ARE_ANY_BITS_SET(romMethod->modifiers, J9AccNative)) {
+        if (auto iProfiler = (JITClientIProfiler *)compiler->fej9vm()->getIProfiler())
+            iProfiler->gatherUncachedClassesUsedInMethod((TR_OpaqueMethodBlock *)method, compiler, prefetchedClasses,
+                prefetchedClassInfos);
+    }
+
     std::string optionsStr = TR::Options::packOptions(compiler->getOptions());
     std::string recompMethodInfoStr = compiler->isRecompilationEnabled()
         ? std::string((const char *)compiler->getRecompilationInfo()->getMethodInfo(), sizeof(TR_PersistentMethodInfo))
@@ -3219,7 +3265,7 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
             classInfoTuple, optionsStr, recompMethodInfoStr, chtableUpdates.first, chtableUpdates.second,
             useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()), aotCacheStore,
             aotCacheLoad, methodIndex, classChainOffset, ramClassChain, uncachedRAMClasses, uncachedClassInfos,
-            newKnownIds, numPermanentLoaders);
+            newKnownIds, numPermanentLoaders, prefetchedClasses, prefetchedClassInfos);
 
         JITServer::MessageType response;
         while (!handleServerMessage(client, compiler->fej9vm(), response))
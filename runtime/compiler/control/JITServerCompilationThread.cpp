@@ -41,6 +41,7 @@
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
 #include "runtime/J9VMAccess.hpp"
+#include "runtime/MetricsServer.hpp"
 #include "runtime/RelocationTarget.hpp"
 
 #include "jitprotos.h"
@@ -575,6 +576,8 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
     auto &uncachedClassInfos = std::get<23>(req);
     auto &newKnownIds = std::get<24>(req);
     size_t numPermanentLoaders = std::get<25>(req);
+    auto &prefetchedClasses = std::get<26>(req);
+    auto &prefetchedClassInfos = std::get<27>(req);
 
     TR_ASSERT_FATAL(TR::Compiler->persistentMemory() == compInfo->persistentMemory(),
         "per-client persistent memory must not be set at this point");
@@ -861,6 +864,11 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
         TR_ASSERT_FATAL(romClass, "ROM class of J9Class=%p must be cached at this point", clazz);
     }
 
+    // Cache the classes profiled at the call sites of the method to be compiled, which the client
+    // sent along with the request because they are the likely inlining candidates
+    if (!prefetchedClasses.empty())
+        JITServerHelpers::cacheRemoteROMClassBatch(clientSession, prefetchedClasses, prefetchedClassInfos);
+
     // Optimization plan needs to use the global allocator,
     // because there is a global pool of plans
     {
@@ -962,19 +970,11 @@ void TR::CompilationInfoPerThreadRemote::processAOTCacheMapRequest(const std::st
 
     std::vector<std::string> methodSignaturesV;
     if (aotCache) {
-        auto cachedMethodMonitor = aotCache->getCachedMethodMonitor();
         try {
-            {
-                OMR::CriticalSection cs(cachedMethodMonitor);
-
-                auto cachedAOTMethod = aotCache->getCachedMethodHead();
-                methodSignaturesV.reserve(aotCache->getCachedMethodMap().size());
-
-                for (; cachedAOTMethod != NULL; cachedAOTMethod = cachedAOTMethod->getNextRecord()) {
-                    const SerializedAOTMethod &serializedAOTMethod = cachedAOTMethod->data();
-                    methodSignaturesV.emplace_back(std::string(serializedAOTMethod.signature()));
-                }
-            }
+            methodSignaturesV.reserve(aotCache->getNumCachedMethods());
+            aotCache->serializedMethodsDo([&](const SerializedAOTMethod &serializedAOTMethod) {
+                methodSignaturesV.emplace_back(std::string(serializedAOTMethod.signature()));
+            });
         } catch (const std::bad_alloc &e) {
             if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "std::bad_alloc: %s", e.what());
@@ -1018,7 +1018,7 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
         auto aotCacheMap = compInfo->getJITServerAOTCacheMap();
         TR_ASSERT(aotCacheMap, "aotCacheMap must exist if such a special request was issued");
         if (stream == LOAD_AOTCACHE_REQUEST)
-            aotCacheMap->loadNextQueuedAOTCacheFromFile(scratchSegmentProvider);
+            aotCacheMap->loadNextQueuedAOTCacheFromFile();
         else
             aotCacheMap->saveNextQueuedAOTCacheToFile();
 
@@ -1037,6 +1037,21 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
 
     _recompilationMethodInfo = NULL;
 
+    // Statistics for the MetricsServer. The stream counters are cumulative for the connection,
+    // which can serve several requests, so remember their values at the start of this request.
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    bool collectMetrics = CompilationMetrics::isEnabled(compInfo);
+    uint64_t requestStartTime = 0;
+    uint64_t numMessagesReceived = 0, numBytesReceived = 0, numBytesSent = 0;
+    if (collectMetrics) {
+        requestStartTime = j9time_usec_clock();
+        if (entry._entryTime)
+            CompilationMetrics::recordQueueTime(requestStartTime - entry._entryTime);
+        numMessagesReceived = stream->getNumMessagesReceived();
+        numBytesReceived = stream->getNumBytesReceived();
+        numBytesSent = stream->getNumBytesSent();
+    }
+
     // Release compMonitor before doing the blocking read
     compInfo->releaseCompMonitor(compThread);
 
@@ -1288,6 +1303,13 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
     // Update statistics regarding the compilation status (including compilationOK)
     compInfo->updateCompilationErrorStats((TR_CompilationErrorCode)entry._compErrCode);
 
+    // The response has already been sent to the client, so the request is complete
+    if (collectMetrics && optPlan) {
+        CompilationMetrics::recordCompilation(optPlan->getOptLevel(), j9time_usec_clock() - requestStartTime,
+            stream->getNumMessagesReceived() - numMessagesReceived, stream->getNumBytesReceived() - numBytesReceived,
+            stream->getNumBytesSent() - numBytesSent);
+    }
+
     // Save the pointer to the plan before recycling the entry
     // Decrease the queue weight
     compInfo->decreaseQueueWeightBy(entry._weight);
@@ -785,6 +785,21 @@ void JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compil
     j9tty_printf(PORTLIB, "Total number of messages: %llu\n", (unsigned long long)totalMsgCount);
     j9tty_printf(PORTLIB, "Total amount of data received: %llu bytes\n",
         (unsigned long long)JITServer::CommunicationStream::_totalMsgSize);
+    if (JITServer::CommunicationStream::_numCompressedMsgsSent) {
+        uint64_t uncompressedBytes = JITServer::CommunicationStream::_totalUncompressedBytesSent;
+        uint64_t compressedBytes = JITServer::CommunicationStream::_totalCompressedBytesSent;
+        j9tty_printf(PORTLIB,
+            "Compressed messages sent: %llu, %llu bytes compressed to %llu bytes (ratio %f) in %llu usec\n",
+            (unsigned long long)JITServer::CommunicationStream::_numCompressedMsgsSent,
+            (unsigned long long)uncompressedBytes, (unsigned long long)compressedBytes,
+            uncompressedBytes / double(compressedBytes),
+            (unsigned long long)JITServer::CommunicationStream::_compressionTimeUs);
+    }
+    if (JITServer::CommunicationStream::_numCompressedMsgsReceived) {
+        j9tty_printf(PORTLIB, "Compressed messages received: %llu, decompressed in %llu usec\n",
+            (unsigned long long)JITServer::CommunicationStream::_numCompressedMsgsReceived,
+            (unsigned long long)JITServer::CommunicationStream::_decompressionTimeUs);
+    }
 
     uint32_t numCompilations = 0;
     uint32_t numDeserializedMethods = 0;
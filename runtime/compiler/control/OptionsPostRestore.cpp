@@ -130,7 +130,9 @@ void J9::OptionsPostRestore::iterateOverExternalOptions()
             case J9::ExternalOptions::XXminusJITServerLogConnections:
             case J9::ExternalOptions::XXJITServerAOTmxOption:
             case J9::ExternalOptions::XXplusJITServerLocalSyncCompilesOption:
-            case J9::ExternalOptions::XXminusJITServerLocalSyncCompilesOption: {
+            case J9::ExternalOptions::XXminusJITServerLocalSyncCompilesOption:
+            case J9::ExternalOptions::XXplusJITServerCompressMessages:
+            case J9::ExternalOptions::XXminusJITServerCompressMessages: {
                 // These will be processed in processJitServerOptions; however,
                 // consume them here
                 FIND_AND_CONSUME_RESTORE_ARG(OPTIONAL_LIST_MATCH, optString, 0);
@@ -245,6 +247,11 @@ void J9::OptionsPostRestore::iterateOverExternalOptions()
                 _argIndexJITServerAOTCacheName = FIND_ARG_IN_RESTORE_ARGS(STARTSWITH_MATCH, optString, 0);
             } break;
 
+            case J9::ExternalOptions::XXJITServerRecordTrafficOption: {
+                // Recording can only be started at JVM startup
+                FIND_AND_CONSUME_RESTORE_ARG(STARTSWITH_MATCH, optString, 0);
+            } break;
+
             case J9::ExternalOptions::Xlockword: {
                 // TBD
             } break;
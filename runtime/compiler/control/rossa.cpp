@@ -120,6 +120,7 @@
 #include "net/CommunicationStream.hpp"
 #include "net/ClientStream.hpp"
 #include "net/LoadSSLLibs.hpp"
+#include "net/TrafficRecorder.hpp"
 #include "runtime/JITClientSession.hpp"
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerAOTDeserializer.hpp"
@@ -1722,6 +1723,11 @@ extern "C" jint onLoadInternal(J9JavaVM *javaVM, J9JITConfig *jitConfig, char *x
             return -1;
 
         JITServer::CommunicationStream::initConfigurationFlags();
+
+        // Recording is best effort; remote compilations proceed normally if it cannot be started
+        const std::string &recordTrafficFile = compInfo->getPersistentInfo()->getJITServerRecordTrafficFile();
+        if (!recordTrafficFile.empty())
+            JITServer::TrafficRecorder::init(recordTrafficFile, compInfo->getPersistentInfo()->getClientUID());
     }
 #endif // J9VM_OPT_JITSERVER
 
@@ -177,6 +177,8 @@ public:
         , _requireJITServer(false)
         , _localSyncCompiles(true)
         , _JITServerUseAOTCache(false)
+        , _JITServerCompressMessages(false)
+        , _JITServerRecordTrafficFile()
         , _JITServerAOTCacheName("default")
         , _JITServerUseAOTCachePersistence(false)
         , _JITServerAOTCacheDir()
@@ -464,6 +466,14 @@ public:
 
     void setJITServerUseAOTCache(bool use) { _JITServerUseAOTCache = use; }
 
+    bool getJITServerCompressMessages() const { return _JITServerCompressMessages; }
+
+    void setJITServerCompressMessages(bool compress) { _JITServerCompressMessages = compress; }
+
+    const std::string &getJITServerRecordTrafficFile() const { return _JITServerRecordTrafficFile; }
+
+    void setJITServerRecordTrafficFile(const char *fileName) { _JITServerRecordTrafficFile = fileName; }
+
     const std::string &getJITServerAOTCacheName() const { return _JITServerAOTCacheName; }
 
     void setJITServerAOTCacheName(const char *name) { _JITServerAOTCacheName = name; }
@@ -593,6 +603,8 @@ private:
     bool _requireJITServer;
     bool _localSyncCompiles;
     bool _JITServerUseAOTCache;
+    bool _JITServerCompressMessages; // Whether to compress large messages; negotiated with the other side
+    std::string _JITServerRecordTrafficFile; // File where the client records its remote compilations, if any
     std::string _JITServerAOTCacheName; // Name of the server AOT cache that this client is using
     bool _JITServerUseAOTCachePersistence; // Whether to persist the JITServer AOT caches at the server
     std::string _JITServerAOTCacheDir; // Directory where the JITServer persistent AOT caches are located
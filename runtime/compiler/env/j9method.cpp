@@ -3597,6 +3597,11 @@ void TR_ResolvedJ9Method::construct()
                 "()Ljava/lang/invoke/VarHandle;") },
               { TR::unknownMethod } };
 
+    static X InternalDowncallHandlerMethods[]
+        = { { TR::openj9_internal_foreign_abi_InternalDowncallHandler_invokeNative, 12, "invokeNative", (int16_t)-1,
+                "*" },
+              { TR::unknownMethod } };
+
     static X ILGenMacrosMethods[] = {
         { TR::java_lang_invoke_ILGenMacros_placeholder, 11, "placeholder", (int16_t)-1, "*" },
         { TR::java_lang_invoke_ILGenMacros_numArguments, 12, "numArguments", (int16_t)-1, "*" },
@@ -4196,6 +4201,11 @@ void TR_ResolvedJ9Method::construct()
         { 0 }
     };
 
+    static Y class51[] = {
+        { "openj9/internal/foreign/abi/InternalDowncallHandler", InternalDowncallHandlerMethods },
+        { 0 }
+    };
+
     static Y class53[] = {
         { "java/util/concurrent/atomic/AtomicIntegerFieldUpdater", JavaUtilConcurrentAtomicIntegerFieldUpdaterMethods },
         { 0 }
@@ -4215,7 +4225,7 @@ void TR_ResolvedJ9Method::construct()
     static Y *recognizedClasses[] = { 0, 0, 0, class13, class14, class15, class16, class17, class18, class19, class20,
         class21, class22, class23, class24, class25, 0, class27, class28, class29, class30, class31, class32, class33,
         class34, class35, class36, 0, class38, class39, class40, class41, class42, class43, class44, class45, class46,
-        class47, class48, class49, class50, 0, 0, class53, 0, class55, 0, 0, 0, 0, class60 };
+        class47, class48, class49, class50, class51, 0, class53, 0, class55, 0, 0, 0, 0, class60 };
 
     const int32_t minRecognizedClassLength = 10;
     const int32_t maxRecognizedClassLength
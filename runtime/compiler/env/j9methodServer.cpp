@@ -1742,6 +1742,68 @@ void TR_ResolvedJ9JITServerMethod::cacheFields()
     }
 }
 
+void TR_ResolvedJ9JITServerMethod::cacheMultipleFieldAttributes()
+{
+    // Relocatable compilations use separate attribute caches that also carry the defining classes
+    auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_fe->_compInfoPT);
+    TR::Compilation *comp = compInfoPT->getCompilation();
+    if (comp->compileRelocatableCode())
+        return;
+
+    // 1. Iterate through bytecodes and look for loads/stores
+    // If the attributes of the corresponding field or static are not cached, add them
+    // to the list of attributes that will be requested from the client in one batch.
+    TR_J9ByteCodeIterator bci(0, this, _fe, comp);
+    std::vector<int32_t> cpIndices;
+    std::vector<uint8_t> isStaticField;
+    std::vector<uint8_t> isStoreField;
+    for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown; bc = bci.next()) {
+        bool isStatic = (bc == J9BCgetstatic || bc == J9BCputstatic);
+        bool isStore = (bc == J9BCputfield || bc == J9BCputstatic);
+        if (!isStatic && bc != J9BCgetfield && bc != J9BCputfield)
+            continue;
+
+        int32_t cpIndex = bci.next2Bytes();
+        TR_J9MethodFieldAttributes attributes;
+        if (getCachedFieldAttributes(cpIndex, attributes, isStatic))
+            continue;
+
+        // The same field can be accessed several times in a method; only ask for it once
+        bool requested = false;
+        for (size_t i = 0; i < cpIndices.size(); ++i) {
+            if (cpIndices[i] == cpIndex && isStaticField[i] == isStatic) {
+                requested = true;
+                break;
+            }
+        }
+        if (!requested) {
+            cpIndices.push_back(cpIndex);
+            isStaticField.push_back(isStatic);
+            isStoreField.push_back(isStore);
+        }
+    }
+
+    // If there's just one field, it's faster to get its attributes through regular means,
+    // to avoid overhead of vectors
+    int32_t numFields = cpIndices.size();
+    if (numFields < 2)
+        return;
+
+    // 2. Send a message to get the attributes of all fields
+    _stream->write(JITServer::MessageType::ResolvedMethod_getMultipleFieldAttributes, _remoteMirror, cpIndices,
+        isStaticField, isStoreField);
+    auto recv = _stream->read<std::vector<TR_J9MethodFieldAttributes> >();
+
+    // 3. Cache all received attributes
+    auto &attributes = std::get<0>(recv);
+    TR_ASSERT(numFields == attributes.size(), "Number of received attributes does not match the requested number");
+    for (int32_t i = 0; i < numFields; ++i) {
+        TR_J9MethodFieldAttributes cachedAttributes;
+        if (!getCachedFieldAttributes(cpIndices[i], cachedAttributes, isStaticField[i]))
+            cacheFieldAttributes(cpIndices[i], attributes[i], isStaticField[i]);
+    }
+}
+
 int32_t TR_ResolvedJ9JITServerMethod::collectImplementorsCapped(TR_OpaqueClassBlock *topClass, int32_t maxCount,
     int32_t cpIndexOrOffset, TR_YesNoMaybe useGetResolvedInterfaceMethod, TR_ResolvedMethod **implArray)
 {
@@ -262,6 +262,7 @@ public:
     bool addValidationRecordForCachedResolvedMethod(const TR_ResolvedMethodKey &key, TR_OpaqueMethodBlock *method);
     void cacheResolvedMethodsCallees(int32_t ttlForUnresolved = 2);
     void cacheFields();
+    void cacheMultipleFieldAttributes();
     int32_t collectImplementorsCapped(TR_OpaqueClassBlock *topClass, int32_t maxCount, int32_t cpIndexOrOffset,
         TR_YesNoMaybe useGetResolvedInterfaceMethod, TR_ResolvedMethod **implArray);
 
@@ -214,6 +214,11 @@ TR::Block *TR_J9ByteCodeIlGenerator::walker(TR::Block *prevBlock)
         // Cache field info for every field/static loaded/stored in this method, which are later used by
         // jitFieldsAreSame/jitStaticAreSame when creating symbol references.
         static_cast<TR_ResolvedJ9JITServerMethod *>(_methodSymbol->getResolvedMethod())->cacheFields();
+
+        // Likewise, fetch the attributes of those fields/statics in one message, instead of one
+        // message per field when the symbol references are created.
+        static_cast<TR_ResolvedJ9JITServerMethod *>(_methodSymbol->getResolvedMethod())
+            ->cacheMultipleFieldAttributes();
     }
 #endif
 
@@ -268,6 +268,9 @@ static BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
 ClientStream::ClientStream(TR::PersistentInfo *info)
     : CommunicationStream()
     , _versionCheckStatus(NOT_DONE)
+    , _compressionRequested(info->getJITServerCompressMessages())
+    , _recorder(TrafficRecorder::get())
+    , _numRecordedMessages(0)
 {
     int connfd = openConnection(info->getJITServerAddress(), info->getJITServerPort(), info->getSocketTimeout());
     BIO *ssl = openSSLConnection(_sslCtx, connfd);
@@ -28,6 +28,7 @@
 #include "ilgen/J9IlGeneratorMethodDetails.hpp"
 #include "net/RawTypeConvert.hpp"
 #include "net/CommunicationStream.hpp"
+#include "net/TrafficRecorder.hpp"
 
 namespace JITServer {
 enum VersionCheckStatus {
@@ -78,7 +79,9 @@ public:
     template<typename... T> void buildCompileRequest(T... args)
     {
         if (getVersionCheckStatus() == NOT_DONE) {
-            _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS);
+            // Also request the optional features that the server may acknowledge in its replies
+            _cMsg.setFullVersion(getJITServerVersion(),
+                CONFIGURATION_FLAGS | (_compressionRequested ? JITServerMessageCompression : 0));
             write(MessageType::compilationRequest, args...);
             _cMsg.clearFullVersion();
         } else // getVersionCheckStatus() == PASSED
@@ -99,6 +102,8 @@ public:
         _cMsg.setType(type);
         setArgsRaw<T...>(_cMsg, args...);
 
+        if (_recorder)
+            recordSentMessage();
         writeMessage(_cMsg);
     }
 
@@ -112,6 +117,11 @@ public:
     MessageType read()
     {
         readMessage(_sMsg);
+        // Start compressing outgoing messages once the server agreed to it
+        if (_compressionRequested && !_compressMessages && (_sMsg.capabilities() & JITServerMessageCompression))
+            _compressMessages = true;
+        if (_recorder)
+            recordReceivedMessage();
         return _sMsg.type();
     }
 
@@ -134,6 +144,9 @@ public:
             // _cMsg.clear();
         } else
             setArgsRaw<T...>(_cMsg, args...);
+        // An interrupted compilation cannot be replayed
+        if (_recorder)
+            discardRecordedMessages();
         writeMessage(_cMsg);
     }
 
@@ -182,9 +195,61 @@ public:
     static int getNumConnectionsClosed() { return _numConnectionsClosed; }
 
 private:
+    /**
+       @brief Record a message about to be sent; a compilation request starts a new recording
+    */
+    void recordSentMessage()
+    {
+        if (MessageType::compilationRequest == _cMsg.type())
+            discardRecordedMessages();
+        else if (0 == _numRecordedMessages)
+            return; // Not part of a compilation
+        _cMsg.serialize();
+        TrafficRecorder::appendMessage(_recordedMessages, _cMsg, FROM_CLIENT);
+        _numRecordedMessages++;
+    }
+
+    /**
+       @brief Record a message just received; the final response completes the recording of a compilation
+    */
+    void recordReceivedMessage()
+    {
+        if (0 == _numRecordedMessages)
+            return; // Not part of a compilation
+        TrafficRecorder::appendMessage(_recordedMessages, _sMsg, FROM_SERVER);
+        _numRecordedMessages++;
+        switch (_sMsg.type()) {
+            case MessageType::compilationCode:
+            case MessageType::compilationFailure:
+            case MessageType::AOTCache_storedAOTMethod:
+            case MessageType::AOTCache_serializedAOTMethod:
+            case MessageType::AOTCache_failure:
+            case MessageType::compilationThreadCrashed:
+                _recorder->recordCompilation(_recordedMessages, _numRecordedMessages);
+                discardRecordedMessages();
+                break;
+            case MessageType::jitDumpPrintIL:
+                // Diagnostic recompilations are not worth replaying
+                discardRecordedMessages();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void discardRecordedMessages()
+    {
+        _recordedMessages.clear();
+        _numRecordedMessages = 0;
+    }
+
     static int _numConnectionsOpened;
     static int _numConnectionsClosed;
     VersionCheckStatus _versionCheckStatus; // indicates whether a version checking has been performed
+    bool _compressionRequested; // whether this client asks the server to compress messages on this connection
+    TrafficRecorder *_recorder; // NULL unless remote compilations are being recorded
+    std::string _recordedMessages; // Messages of the compilation being recorded on this connection
+    uint32_t _numRecordedMessages; // 0 when no compilation is being recorded
     static int _incompatibilityCount;
     static uint64_t _incompatibleStartTime; // Time when version incomptibility has been detected
     static const uint64_t
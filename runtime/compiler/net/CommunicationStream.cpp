@@ -20,10 +20,13 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <errno.h>
+#include <sys/socket.h>
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include "zlib.h"
 
 namespace JITServer {
 
@@ -36,6 +39,12 @@ uint32_t CommunicationStream::_numConsecutiveReadErrorsOfSameType = 0;
 #if defined(MESSAGE_SIZE_STATS)
 TR_Stats CommunicationStream::_msgSizeStats[];
 #endif /* defined(MESSAGE_SIZE_STATS) */
+uint64_t CommunicationStream::_numCompressedMsgsSent = 0;
+uint64_t CommunicationStream::_totalUncompressedBytesSent = 0;
+uint64_t CommunicationStream::_totalCompressedBytesSent = 0;
+uint64_t CommunicationStream::_compressionTimeUs = 0;
+uint64_t CommunicationStream::_numCompressedMsgsReceived = 0;
+uint64_t CommunicationStream::_decompressionTimeUs = 0;
 
 void CommunicationStream::initConfigurationFlags()
 {
@@ -60,16 +69,122 @@ void CommunicationStream::initSSL()
     // It's redundant and doesn't need to be called
 }
 
-void CommunicationStream::readMessage(Message &msg)
+MessageBuffer *CommunicationStream::getCompressionBuffer()
+{
+    if (!_compressionBuffer)
+        _compressionBuffer = new (TR::Compiler->persistentGlobalAllocator()) MessageBuffer();
+    return _compressionBuffer;
+}
+
+bool CommunicationStream::compressMessage(const char *serialMsg, uint32_t serializedSize, uint32_t &wireSize)
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(TR::Compiler->omrPortLib);
+    uint64_t startTime = omrtime_usec_clock();
+
+    // There is no point in sending a compressed message that is not smaller than the original
+    static const uint32_t headerSize = 2 * sizeof(uint32_t);
+    MessageBuffer *buffer = getCompressionBuffer();
+    buffer->expandIfNeeded(serializedSize);
+    char *frame = buffer->getBufferStart();
+    uLongf compressedSize = serializedSize - headerSize;
+    int rc = compress2((Bytef *)(frame + headerSize), &compressedSize, (const Bytef *)serialMsg, serializedSize,
+        Z_BEST_SPEED);
+
+    _compressionTimeUs += omrtime_usec_clock() - startTime;
+    if (rc != Z_OK) // Z_BUF_ERROR means that the data is not compressible enough
+        return false;
+
+    wireSize = headerSize + compressedSize;
+    ((uint32_t *)frame)[0] = wireSize | COMPRESSED_MESSAGE_FLAG;
+    ((uint32_t *)frame)[1] = serializedSize;
+
+    _numCompressedMsgsSent++;
+    _totalUncompressedBytesSent += serializedSize;
+    _totalCompressedBytesSent += wireSize;
+    return true;
+}
+
+void CommunicationStream::decompressMessage(Message &msg, const char *frame, uint32_t wireSize)
 {
-    msg.clearForRead();
+    OMRPORT_ACCESS_FROM_OMRPORT(TR::Compiler->omrPortLib);
+    uint64_t startTime = omrtime_usec_clock();
+
+    static const uint32_t headerSize = 2 * sizeof(uint32_t);
+    uint32_t serializedSize = ((const uint32_t *)frame)[1];
+    // The message buffer is empty at this point, so expanding it does not need to copy anything
+    if (serializedSize > msg.getBufferCapacity())
+        msg.expandBuffer(serializedSize, 0);
+
+    uLongf uncompressedSize = serializedSize;
+    int rc = uncompress((Bytef *)msg.getBufferStartForRead(), &uncompressedSize, (const Bytef *)(frame + headerSize),
+        wireSize - headerSize);
+    if ((rc != Z_OK) || (uncompressedSize != serializedSize)
+        || (((uint32_t *)msg.getBufferStartForRead())[0] != serializedSize)) {
+        throw JITServer::StreamFailure("JITServer I/O error: failed to decompress message");
+    }
+
+    _decompressionTimeUs += omrtime_usec_clock() - startTime;
+    _numCompressedMsgsReceived++;
+}
 
+bool CommunicationStream::prefetchMessage(Message &msg)
+{
+    if (_ssl)
+        return true;
+
+    if (0 == _numPrefetchedBytes)
+        msg.clearForRead();
+
+    // Read the size of the message first, then the rest of it, so that the bytes
+    // of the following message are left on the socket
+    uint32_t bytesNeeded = sizeof(uint32_t);
+    while (true) {
+        char *buffer = msg.getBufferStartForRead();
+        if (_numPrefetchedBytes >= sizeof(uint32_t)) {
+            uint32_t serializedSize = ((uint32_t *)buffer)[0] & ~COMPRESSED_MESSAGE_FLAG;
+            // An invalid size is reported by readMessage()
+            if ((serializedSize < sizeof(uint32_t)) || (_numPrefetchedBytes >= serializedSize))
+                return true;
+            if (serializedSize > msg.getBufferCapacity()) {
+                msg.expandBuffer(serializedSize, _numPrefetchedBytes);
+                buffer = msg.getBufferStartForRead();
+            }
+            bytesNeeded = serializedSize;
+        }
+
+        ssize_t bytesRead
+            = recv(_connfd, buffer + _numPrefetchedBytes, bytesNeeded - _numPrefetchedBytes, MSG_DONTWAIT);
+        if (bytesRead > 0)
+            _numPrefetchedBytes += bytesRead;
+        else if ((bytesRead < 0) && (EINTR == errno))
+            continue;
+        else if ((bytesRead < 0) && ((EAGAIN == errno) || (EWOULDBLOCK == errno)))
+            return false;
+        else // The connection was closed or failed; readMessage() will report it
+            return true;
+    }
+}
+
+void CommunicationStream::readMessage(Message &msg)
+{
     // The message buffer storage and its capacity could be
     // changed when the serialized size is set.
-    char *buffer = msg.getBufferStartForRead();
-    uint32_t bufferCapacity = msg.getBufferCapacity();
+    char *buffer = NULL;
+    uint32_t bufferCapacity = 0;
+    int32_t bytesRead = 0;
 
-    int32_t bytesRead = readOnceBlocking(buffer, bufferCapacity);
+    if (_numPrefetchedBytes > 0) {
+        // Continue with the part of the message read by prefetchMessage()
+        buffer = msg.getBufferStartForRead();
+        bufferCapacity = msg.getBufferCapacity();
+        bytesRead = _numPrefetchedBytes;
+        _numPrefetchedBytes = 0;
+    } else {
+        msg.clearForRead();
+        buffer = msg.getBufferStartForRead();
+        bufferCapacity = msg.getBufferCapacity();
+        bytesRead = readOnceBlocking(buffer, bufferCapacity);
+    }
 
     // bytesRead should be greater than 0 here, readOnceBlocking() throws
     // an exception already if (bytesRead <= 0).
@@ -79,6 +194,8 @@ void CommunicationStream::readMessage(Message &msg)
 
     // bytesRead >= sizeof(uint32_t)
     uint32_t serializedSize = ((uint32_t *)buffer)[0];
+    bool isCompressed = (serializedSize & COMPRESSED_MESSAGE_FLAG) != 0;
+    serializedSize &= ~COMPRESSED_MESSAGE_FLAG;
     if (bytesRead > serializedSize) {
         throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
     }
@@ -86,26 +203,42 @@ void CommunicationStream::readMessage(Message &msg)
     // serializedSize >= bytesRead
     uint32_t bytesLeftToRead = serializedSize - bytesRead;
 
-    if (bytesLeftToRead > 0) {
-        if (serializedSize > bufferCapacity) {
-            // bytesRead could be less than the buffer capacity.
-            msg.expandBuffer(serializedSize, bytesRead);
+    if (isCompressed) {
+        // Assemble the compressed message in the compression buffer and inflate it into the message buffer
+        if (serializedSize < 2 * sizeof(uint32_t))
+            throw JITServer::StreamFailure("JITServer I/O error: compressed message is too small");
+        MessageBuffer *compressionBuffer = getCompressionBuffer();
+        compressionBuffer->expandIfNeeded(serializedSize);
+        char *frame = compressionBuffer->getBufferStart();
+        memcpy(frame, buffer, bytesRead);
+        if (bytesLeftToRead > 0)
+            readBlocking(frame + bytesRead, bytesLeftToRead);
+        decompressMessage(msg, frame, serializedSize);
+        msg.setSerializedSize(((uint32_t *)msg.getBufferStartForRead())[0]);
+    } else {
+        if (bytesLeftToRead > 0) {
+            if (serializedSize > bufferCapacity) {
+                // bytesRead could be less than the buffer capacity.
+                msg.expandBuffer(serializedSize, bytesRead);
+
+                // The buffer storage will change after the buffer is expanded.
+                buffer = msg.getBufferStartForRead();
+            }
 
-            // The buffer storage will change after the buffer is expanded.
-            buffer = msg.getBufferStartForRead();
+            readBlocking(buffer + bytesRead, bytesLeftToRead);
         }
 
-        readBlocking(buffer + bytesRead, bytesLeftToRead);
+        msg.setSerializedSize(serializedSize);
     }
 
-    msg.setSerializedSize(serializedSize);
-
     // rebuild the message
     msg.deserialize();
 
-    // Update message count and size statistics
+    // Update message count and size statistics (for compressed messages, the size received on the wire)
     _msgTypeCount[msg.type()] += 1;
     _totalMsgSize += serializedSize;
+    _numMessagesReceived++;
+    _numBytesReceived += serializedSize;
 #if defined(MESSAGE_SIZE_STATS)
     _msgSizeStats[msg.type()].update(serializedSize);
 #endif /* defined(MESSAGE_SIZE_STATS) */
@@ -114,8 +247,20 @@ void CommunicationStream::readMessage(Message &msg)
 void CommunicationStream::writeMessage(Message &msg)
 {
     char *serialMsg = msg.serialize();
+    uint32_t serializedSize = msg.serializedSize();
+    TR_ASSERT_FATAL(!(serializedSize & COMPRESSED_MESSAGE_FLAG), "Message of type %u is too large: %u bytes",
+        msg.type(), serializedSize);
+
     // write serialized message to the socket
-    writeBlocking(serialMsg, msg.serializedSize());
+    uint32_t wireSize = 0;
+    if (_compressMessages && (serializedSize >= MESSAGE_COMPRESSION_THRESHOLD)
+        && compressMessage(serialMsg, serializedSize, wireSize)) {
+        writeBlocking(_compressionBuffer->getBufferStart(), wireSize);
+    } else {
+        wireSize = serializedSize;
+        writeBlocking(serialMsg, serializedSize);
+    }
+    _numBytesSent += wireSize;
     msg.clearForWrite();
 }
 
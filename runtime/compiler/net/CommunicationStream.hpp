@@ -34,6 +34,7 @@
 namespace JITServer {
 // When adding another compatibility mask/flag, also add a new message in
 // CommunicationStream::showFullVersionIncompatibility that handles the new enum value.
+// Compatibility flags must not overlap with JITServerCapabilitiesMask (see Message.hpp).
 enum JITServerCompatibilityFlags {
     JITServerJavaVersionMask = 0x00000FFF,
     JITServerCompressedRef = 0x00001000,
@@ -54,6 +55,21 @@ public:
 #if defined(MESSAGE_SIZE_STATS)
     static TR_Stats _msgSizeStats[MessageType::MessageType_MAXTYPE];
 #endif /* defined(MESSAGE_SIZE_STATS) */
+    // Message compression statistics
+    static uint64_t _numCompressedMsgsSent;
+    static uint64_t _totalUncompressedBytesSent; // size before compression of the messages that were compressed
+    static uint64_t _totalCompressedBytesSent; // size after compression of the messages that were compressed
+    static uint64_t _compressionTimeUs;
+    static uint64_t _numCompressedMsgsReceived;
+    static uint64_t _decompressionTimeUs;
+
+    // The most significant bit of the size that prefixes a message on the wire indicates that
+    // the message is compressed. A compressed message is sent as: the wire size (including the
+    // two headers) with this bit set, the size of the uncompressed message, and the deflated
+    // serialized message.
+    static const uint32_t COMPRESSED_MESSAGE_FLAG = 0x80000000;
+    // Messages smaller than this are not worth compressing
+    static const uint32_t MESSAGE_COMPRESSION_THRESHOLD = 4096;
 
     static void initConfigurationFlags();
 
@@ -85,10 +101,23 @@ public:
 
     static bool shouldReadRetry() { return (_numConsecutiveReadErrorsOfSameType < MAX_READ_RETRY); }
 
+    // Per-connection statistics; only updated by the thread currently using the stream
+    uint64_t getNumMessagesReceived() const { return _numMessagesReceived; }
+
+    uint64_t getNumBytesReceived() const { return _numBytesReceived; }
+
+    uint64_t getNumBytesSent() const { return _numBytesSent; }
+
 protected:
     CommunicationStream()
         : _ssl(NULL)
         , _connfd(-1)
+        , _compressMessages(false)
+        , _numMessagesReceived(0)
+        , _numBytesReceived(0)
+        , _numBytesSent(0)
+        , _numPrefetchedBytes(0)
+        , _compressionBuffer(NULL)
     {}
 
     virtual ~CommunicationStream()
@@ -97,6 +126,10 @@ protected:
             (*OBIO_free_all)(_ssl);
         if (_connfd != -1)
             close(_connfd);
+        if (_compressionBuffer) {
+            _compressionBuffer->~MessageBuffer();
+            TR::Compiler->persistentGlobalAllocator().deallocate(_compressionBuffer);
+        }
     }
 
     void initStream(int connfd, BIO *ssl)
@@ -110,12 +143,30 @@ protected:
     void readMessage(Message &msg);
     void writeMessage(Message &msg);
 
+    /**
+       @brief Read, without blocking, the part of the next message that is already available on the socket
+
+       The bytes are kept in msg and are consumed by the next readMessage(msg), which then
+       does not block as long as the whole message was prefetched. Never reads past the end
+       of the message. Streams using SSL are not prefetched.
+
+       @return true if the whole message is buffered, or if readMessage() must be called anyway
+               because the peer closed the connection, an error occurred or the stream uses SSL;
+               false if the rest of the message has not arrived yet
+    */
+    bool prefetchMessage(Message &msg);
+
     int getConnFD() const { return _connfd; }
 
     BIO *_ssl; // SSL connection, null if not using SSL
     int _connfd;
     ServerMessage _sMsg;
     ClientMessage _cMsg;
+    bool _compressMessages; // whether large outgoing messages are compressed; negotiated per connection
+    uint64_t _numMessagesReceived;
+    uint64_t _numBytesReceived; // size on the wire
+    uint64_t _numBytesSent; // size on the wire
+    uint32_t _numPrefetchedBytes; // bytes of the next message already read by prefetchMessage()
 
     // When increasing a version number here (especially MINOR_NUMBER), please
     // also change the ID comment to a unique value, preferably one that has
@@ -128,11 +179,18 @@ protected:
     // likely to lose an increment when merging/rebasing/etc.
     //
     static const uint8_t MAJOR_NUMBER = 1;
-    static const uint16_t MINOR_NUMBER = 99; // ID: Ux5WzqSxujCchhi+IAqz
+    static const uint16_t MINOR_NUMBER = 101; // ID: FVrM1/JuHpClmZyi3CzZ
     static const uint8_t PATCH_NUMBER = 0;
     static uint32_t CONFIGURATION_FLAGS;
 
 private:
+    // Scratch buffer holding compressed messages; allocated on first use
+    MessageBuffer *getCompressionBuffer();
+    bool compressMessage(const char *serialMsg, uint32_t serializedSize, uint32_t &wireSize);
+    void decompressMessage(Message &msg, const char *frame, uint32_t wireSize);
+
+    MessageBuffer *_compressionBuffer;
+
     void readBlocking(char *data, size_t size)
     {
         size_t totalBytesRead = 0;
@@ -20,7 +20,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <cstddef>
 #include "net/Message.hpp"
+#include "net/TrafficRecord.hpp"
 #include "infra/Assert.hpp"
 #include "env/VerboseLog.hpp"
 
@@ -28,6 +30,40 @@ namespace JITServer {
 const char * const Message::DataDescriptor::_descriptorNames[] = { "INT32", "INT64", "UINT32", "UINT64", "BOOL",
     "STRING", "OBJECT", "ENUM", "VECTOR", "SIMPLE_VECTOR", "EMPTY_VECTOR", "TUPLE", "INVALID" };
 
+// jitserver_replay parses recorded messages using the layout described in TrafficRecord.hpp
+struct TrafficRecordLayoutCheck {
+    typedef Message::MetaData MetaData;
+    typedef Message::DataDescriptor DataDescriptor;
+
+    static_assert(offsetof(TrafficRecordMessageHeader, _version) == sizeof(uint32_t) + offsetof(MetaData, _version),
+        "Recorded message header does not match Message::MetaData");
+    static_assert(offsetof(TrafficRecordMessageHeader, _config) == sizeof(uint32_t) + offsetof(MetaData, _config),
+        "Recorded message header does not match Message::MetaData");
+    static_assert(offsetof(TrafficRecordMessageHeader, _type) == sizeof(uint32_t) + offsetof(MetaData, _type),
+        "Recorded message header does not match Message::MetaData");
+    static_assert(offsetof(TrafficRecordMessageHeader, _numDataPoints)
+            == sizeof(uint32_t) + offsetof(MetaData, _numDataPoints),
+        "Recorded message header does not match Message::MetaData");
+    static_assert(sizeof(TrafficRecordMessageHeader) == sizeof(uint32_t) + sizeof(MetaData),
+        "Recorded message header does not match Message::MetaData");
+
+    static_assert(offsetof(TrafficRecordDataDescriptor, _type) == offsetof(DataDescriptor, _type),
+        "Recorded data descriptor does not match Message::DataDescriptor");
+    static_assert(offsetof(TrafficRecordDataDescriptor, _paddingSize) == offsetof(DataDescriptor, _paddingSize),
+        "Recorded data descriptor does not match Message::DataDescriptor");
+    static_assert(offsetof(TrafficRecordDataDescriptor, _dataOffset) == offsetof(DataDescriptor, _dataOffset),
+        "Recorded data descriptor does not match Message::DataDescriptor");
+    static_assert(
+        offsetof(TrafficRecordDataDescriptor, _vectorElementSize) == offsetof(DataDescriptor, _vectorElementSize),
+        "Recorded data descriptor does not match Message::DataDescriptor");
+    static_assert(offsetof(TrafficRecordDataDescriptor, _size) == offsetof(DataDescriptor, _size),
+        "Recorded data descriptor does not match Message::DataDescriptor");
+    static_assert(sizeof(TrafficRecordDataDescriptor) == sizeof(DataDescriptor),
+        "Recorded data descriptor does not match Message::DataDescriptor");
+    static_assert(TRAFFIC_RECORD_DATA_TYPE_UINT64 == DataDescriptor::UINT64,
+        "Recorded data descriptor does not match Message::DataDescriptor");
+};
+
 uint32_t Message::addData(const DataDescriptor &desc, const void *dataStart, bool needs64BitAlignment)
 {
     // Write the descriptor itself
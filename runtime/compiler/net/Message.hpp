@@ -30,6 +30,14 @@
 #include "OMR/Bytes.hpp" // for alignNoCheck
 
 namespace JITServer {
+// Optional features that the client requests and the server acknowledges through the _config
+// field of the message metadata. Unlike JITServerCompatibilityFlags (which share the same field
+// in the first client message), these do not need to match between client and server.
+enum JITServerCapabilityFlags {
+    JITServerMessageCompression = 0x00010000,
+    JITServerCapabilitiesMask = 0xFFFF0000,
+};
+
 /**
    @class Message
    @brief Representation of a JITServer remote message.
@@ -219,6 +227,8 @@ public:
         uint8_t _dataOffset; // Offset from DataDescriptor to actual data
         uint8_t _vectorElementSize; // Size of an element for SIMPLE_VECTORs
         uint32_t _size; // Size of the data segment, which can include nested data
+
+        friend struct TrafficRecordLayoutCheck;
     }; // struct DataDescriptor
 
     Message()
@@ -385,16 +395,23 @@ protected:
     MessageBuffer _buffer; // Buffer used for send/receive operations
 };
 
-class ServerMessage : public Message {};
+class ServerMessage : public Message {
+public:
+    uint32_t capabilities() const { return getMetaData()->_config & JITServerCapabilitiesMask; }
+
+    void setCapabilities(uint32_t capabilities) { getMetaData()->_config = capabilities & JITServerCapabilitiesMask; }
+};
 
 class ClientMessage : public Message {
 public:
     uint64_t fullVersion()
     {
         const MetaData *metaData = getMetaData();
-        return buildFullVersion(metaData->_version, metaData->_config);
+        return buildFullVersion(metaData->_version, metaData->_config & ~JITServerCapabilitiesMask);
     }
 
+    uint32_t capabilities() const { return getMetaData()->_config & JITServerCapabilitiesMask; }
+
     void setFullVersion(uint32_t version, uint32_t config)
     {
         MetaData *metaData = getMetaData();
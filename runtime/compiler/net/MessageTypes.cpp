@@ -77,6 +77,7 @@ const char *messageNames[] = {
     "ResolvedMethod_stringConstant",
     "ResolvedMethod_getResolvedVirtualMethod",
     "ResolvedMethod_getMultipleResolvedMethods",
+    "ResolvedMethod_getMultipleFieldAttributes",
 #if defined(J9VM_OPT_METHOD_HANDLE)
     "ResolvedMethod_varHandleMethodTypeTableEntryAddress",
     "ResolvedMethod_isUnresolvedVarHandleMethodTypeTableEntry",
@@ -84,6 +84,7 @@ enum MessageType : uint16_t {
     ResolvedMethod_stringConstant,
     ResolvedMethod_getResolvedVirtualMethod,
     ResolvedMethod_getMultipleResolvedMethods,
+    ResolvedMethod_getMultipleFieldAttributes,
 #if defined(J9VM_OPT_METHOD_HANDLE)
     ResolvedMethod_varHandleMethodTypeTableEntryAddress,
     ResolvedMethod_isUnresolvedVarHandleMethodTypeTableEntry,
@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "ServerStream.hpp"
+#include "control/CompilationRuntime.hpp"
 
 namespace JITServer {
 int ServerStream::_numConnectionsOpened = 0;
@@ -34,6 +35,15 @@ ServerStream::ServerStream(int connfd, BIO *ssl)
     _pClientSessionData = NULL;
 }
 
+void ServerStream::negotiateCapabilities(uint32_t clientCapabilities)
+{
+    TR::PersistentInfo *info = TR::CompilationInfo::get()->getPersistentInfo();
+    _compressMessages = (clientCapabilities & JITServerMessageCompression) && info->getJITServerCompressMessages();
+    if (_compressMessages && TR::Options::getVerboseOption(TR_VerboseJITServerConns))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "t=%6u Message compression enabled on socket 0x%x",
+            (uint32_t)info->getElapsedTime(), getConnFD());
+}
+
 static bool handleCreateSSLContextError(SSL_CTX *&ctx, const char *errMsg)
 {
     perror(errMsg);
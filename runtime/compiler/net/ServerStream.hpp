@@ -73,6 +73,29 @@ public:
         _pClientSessionData = NULL;
     }
 
+    /**
+       @brief Return the socket descriptor of the connection, e.g. to monitor it for new requests
+    */
+    int getConnectionFD() const { return getConnFD(); }
+
+    /**
+       @brief Check whether the SSL layer already buffered data that was read from the socket
+
+       Such data will not be signaled as new input on the socket, so the stream must be read
+       right away instead of waiting for the socket to become readable.
+    */
+    bool hasPendingSSLData() const { return _ssl && ((*OBIO_ctrl)(_ssl, BIO_CTRL_PENDING, 0, NULL) > 0); }
+
+    /**
+       @brief Buffer, without blocking, the part of the next client message available on the socket
+
+       Used by the listener thread for parked connections, so that the stream is handed to a
+       compilation thread only once it can read the whole request without blocking.
+
+       @return false if the rest of the message has not arrived yet, true otherwise
+    */
+    bool readPendingRequest() { return prefetchMessage(_cMsg); }
+
     /**
        @brief Send a message to the client
 
@@ -92,6 +115,8 @@ public:
         }
 
         _sMsg.setType(type);
+        // Acknowledge the optional features negotiated with the client
+        _sMsg.setCapabilities(_compressMessages ? JITServerMessageCompression : 0);
         setArgsRaw<Args...>(_sMsg, args...);
         writeMessage(_sMsg);
     }
@@ -149,9 +174,13 @@ public:
     template<typename... T> MessageType readCompileRequest(std::tuple<T...> &req, std::string &cacheName)
     {
         readMessage(_cMsg);
-        if (_cMsg.fullVersion() != 0 && _cMsg.fullVersion() != getJITServerFullVersion()) {
-            throw StreamVersionIncompatible(
-                showFullVersionIncompatibility(getJITServerFullVersion(), _cMsg.fullVersion()));
+        if (_cMsg.fullVersion() != 0) {
+            if (_cMsg.fullVersion() != getJITServerFullVersion()) {
+                throw StreamVersionIncompatible(
+                    showFullVersionIncompatibility(getJITServerFullVersion(), _cMsg.fullVersion()));
+            }
+            // The first message on a connection also carries the features requested by the client
+            negotiateCapabilities(_cMsg.capabilities());
         }
 
         switch (_cMsg.type()) {
@@ -259,6 +288,13 @@ public:
         const std::string &sslRootCerts);
 
 private:
+    /**
+       @brief Enable the optional features requested by the client that are also enabled at the server
+
+       @param clientCapabilities JITServerCapabilityFlags sent by the client in its first message
+    */
+    void negotiateCapabilities(uint32_t clientCapabilities);
+
     static int _numConnectionsOpened;
     static int _numConnectionsClosed;
     uint64_t _clientId; // UID of client connected to this communication stream
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef TRAFFIC_RECORD_H
+#define TRAFFIC_RECORD_H
+
+#include <cstdint>
+#include "net/MessageTypes.hpp"
+
+namespace JITServer {
+/**
+   @brief Layout of the files produced by JITServer::TrafficRecorder and consumed by jitserver_replay
+
+   A recording starts with a TrafficRecordHeader. Each remote compilation recorded by the client
+   is then stored as a TrafficRecordCompilation followed by all the messages of the compilation,
+   starting with the compilation request and ending with the final response of the server.
+   Each message is stored as a uint32_t TrafficRecordDirection followed by the serialized message
+   (uncompressed, starting with its own size). Messages are stored in the byte order and with the
+   pointer size of the client, and can only be replayed against a server of the same JITServer
+   version and build configuration.
+*/
+static const char TRAFFIC_RECORD_EYECATCHER[8] = { 'J', 'S', 'T', 'R', 'A', 'F', 'F', 'C' };
+static const uint32_t TRAFFIC_RECORD_FORMAT_VERSION = 1;
+
+struct TrafficRecordHeader {
+    char _eyeCatcher[8];
+    uint32_t _formatVersion;
+    uint32_t _pointerSize;
+    uint64_t _fullVersion; // JITServer version and compatibility flags of the client
+    uint64_t _clientUID;
+};
+
+struct TrafficRecordCompilation {
+    uint32_t _numMessages;
+    uint32_t _size; // Size in bytes of the messages that follow
+};
+
+enum TrafficRecordDirection : uint32_t {
+    FROM_SERVER = 0,
+    FROM_CLIENT = 1,
+};
+
+/**
+   @brief Serialized layout of the start of a JITServer::Message: its size followed by Message::MetaData
+
+   jitserver_replay cannot include net/Message.hpp, so the layout of the recorded messages is
+   described here; Message.cpp checks that it matches JITServer::Message.
+*/
+struct TrafficRecordMessageHeader {
+    uint32_t _size;
+    uint32_t _version;
+    uint32_t _config;
+    MessageType _type;
+    uint16_t _numDataPoints;
+};
+
+/**
+   @brief Serialized layout of a JITServer::Message::DataDescriptor
+*/
+struct TrafficRecordDataDescriptor {
+    uint8_t _type; // Message::DataDescriptor::DataType
+    uint8_t _paddingSize;
+    uint8_t _dataOffset;
+    uint8_t _vectorElementSize;
+    uint32_t _size;
+};
+
+static const uint8_t TRAFFIC_RECORD_DATA_TYPE_UINT64 = 3; // Message::DataDescriptor::UINT64
+}; // namespace JITServer
+
+#endif // TRAFFIC_RECORD_H
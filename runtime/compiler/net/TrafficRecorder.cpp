@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <errno.h>
+#include <string.h>
+#include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "net/CommunicationStream.hpp"
+#include "net/TrafficRecorder.hpp"
+
+namespace JITServer {
+TrafficRecorder *TrafficRecorder::_recorder = NULL;
+
+TrafficRecorder::TrafficRecorder(FILE *file, TR::Monitor *monitor)
+    : _file(file)
+    , _monitor(monitor)
+    , _numRecordedCompilations(0)
+    , _failed(false)
+{}
+
+bool TrafficRecorder::init(const std::string &fileName, uint64_t clientUID)
+{
+    TR_ASSERT_FATAL(!_recorder, "Traffic recorder already initialized");
+
+    FILE *file = fopen(fileName.c_str(), "wb");
+    if (!file) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Failed to open traffic recording file %s: %s",
+                fileName.c_str(), strerror(errno));
+        return false;
+    }
+
+    TrafficRecordHeader header;
+    memcpy(header._eyeCatcher, TRAFFIC_RECORD_EYECATCHER, sizeof(header._eyeCatcher));
+    header._formatVersion = TRAFFIC_RECORD_FORMAT_VERSION;
+    header._pointerSize = sizeof(void *);
+    header._fullVersion = CommunicationStream::getJITServerFullVersion();
+    header._clientUID = clientUID;
+
+    TR::Monitor *monitor = TR::Monitor::create("JITServerTrafficRecorderMonitor");
+    if (!monitor || (1 != fwrite(&header, sizeof(header), 1, file)) || fflush(file)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Failed to initialize traffic recording file %s",
+                fileName.c_str());
+        fclose(file);
+        return false;
+    }
+
+    _recorder = new (TR::Compiler->persistentGlobalAllocator()) TrafficRecorder(file, monitor);
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Recording remote compilations to %s", fileName.c_str());
+    return true;
+}
+
+void TrafficRecorder::appendMessage(std::string &buffer, Message &msg, TrafficRecordDirection direction)
+{
+    const char *data = msg.getBufferStartForRead();
+    uint32_t size = *(const uint32_t *)data;
+    uint32_t dir = direction;
+    buffer.append((const char *)&dir, sizeof(dir));
+    buffer.append(data, size);
+}
+
+void TrafficRecorder::recordCompilation(const std::string &buffer, uint32_t numMessages)
+{
+    TrafficRecordCompilation compilation;
+    compilation._numMessages = numMessages;
+    compilation._size = buffer.size();
+
+    OMR::CriticalSection recording(_monitor);
+    if (_failed)
+        return;
+
+    // Flush every compilation, so that the recording is usable even if the JVM does not exit cleanly
+    if ((1 != fwrite(&compilation, sizeof(compilation), 1, _file))
+        || (1 != fwrite(buffer.data(), buffer.size(), 1, _file)) || fflush(_file)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "Failed to write to the traffic recording file: %s; recording stopped after %u compilations",
+                strerror(errno), _numRecordedCompilations);
+        _failed = true;
+        return;
+    }
+    _numRecordedCompilations++;
+}
+}; // namespace JITServer
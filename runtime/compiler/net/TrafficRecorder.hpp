@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef TRAFFIC_RECORDER_H
+#define TRAFFIC_RECORDER_H
+
+#include <stdio.h>
+#include <string>
+#include "net/Message.hpp"
+#include "net/TrafficRecord.hpp"
+
+namespace TR {
+class Monitor;
+}
+
+namespace JITServer {
+/**
+   @class TrafficRecorder
+   @brief Records the messages exchanged by the client during remote compilations
+
+   The recording can be fed to a server with jitserver_replay, which allows benchmarking
+   and regression-testing the server without running the client JVMs. See TrafficRecord.hpp
+   for the layout of the file.
+
+   There is a single recorder per client JVM. Each ClientStream accumulates the messages
+   of the compilation in progress and hands them to the recorder once the server sent its
+   final response, so compilations from different compilation threads are never interleaved.
+ */
+class TrafficRecorder {
+public:
+    /**
+       @brief Create the recorder and write the header of the recording
+
+       @param fileName Name of the recording file; any existing file is overwritten
+       @param clientUID UID of the client
+       @return Whether recording is enabled
+    */
+    static bool init(const std::string &fileName, uint64_t clientUID);
+
+    static TrafficRecorder *get() { return _recorder; }
+
+    /**
+       @brief Append a message to the compilation being recorded by a stream
+
+       @param [in,out] buffer Messages of the compilation recorded so far
+       @param msg The message; must be serialized, i.e. start with its size
+       @param direction Whether the message was sent by the client or by the server
+    */
+    static void appendMessage(std::string &buffer, Message &msg, TrafficRecordDirection direction);
+
+    /**
+       @brief Write all the messages of a compilation to the recording
+
+       @param buffer Messages of the compilation
+       @param numMessages Number of messages in the buffer
+    */
+    void recordCompilation(const std::string &buffer, uint32_t numMessages);
+
+    uint32_t getNumRecordedCompilations() const { return _numRecordedCompilations; }
+
+private:
+    TrafficRecorder(FILE *file, TR::Monitor *monitor);
+
+    static TrafficRecorder *_recorder;
+
+    FILE *_file;
+    TR::Monitor *_monitor; // Serializes the writes from all the compilation threads
+    uint32_t _numRecordedCompilations;
+    bool _failed; // Set after the first write error; nothing is recorded afterwards
+};
+}; // namespace JITServer
+
+#endif // TRAFFIC_RECORDER_H
@@ -475,6 +475,7 @@ const OptimizationStrategy hotStrategyOpts[] = {
     { OMR::inductionVariableAnalysis, OMR::IfLoopsAndNotProfiling },
     { OMR::loopSpecializerGroup, OMR::IfLoopsAndNotProfiling },
     { OMR::inductionVariableAnalysis, OMR::IfLoopsAndNotProfiling },
+    { OMR::SPMDKernelParallelization, OMR::IfLoopsAndNotProfiling }, // auto-SIMD of counted loops
     { OMR::generalLoopUnroller, OMR::IfLoopsAndNotProfiling }, // unroll Loops
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
     { OMR::recognizedCallTransformer, OMR::MarkLastRun },
@@ -572,6 +573,7 @@ const OptimizationStrategy scorchingStrategyOpts[] = {
     { OMR::inductionVariableAnalysis, OMR::IfLoops },
     { OMR::loopSpecializerGroup, OMR::IfLoops },
     { OMR::inductionVariableAnalysis, OMR::IfLoops },
+    { OMR::SPMDKernelParallelization, OMR::IfLoops }, // auto-SIMD of counted loops
     { OMR::generalLoopUnroller, OMR::IfLoops }, // unroll Loops
     { OMR::blockSplitter, OMR::MarkLastRun },
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
@@ -82,6 +82,8 @@
 
 #define INVALID_STRIDE INT_MAX
 #define VECTOR_SIZE 16
+// number of vector operations the SIMD loop body is unrolled into
+#define VECTORS_PER_UNROLLED_BODY 4
 #define VECTOR_LENGTH TR::VectorLength128
 #define INVALID_ADDR (TR::Node *)-1
 
@@ -128,6 +130,23 @@ int32_t TR_SPMDKernelParallelizer::getUnrollCount(TR::DataType dt)
     return unrollCount;
 }
 
+// Number of lanes per vector for the loop's data type; loops without a known data type are treated as 16 bit
+int32_t TR_SPMDKernelParallelizer::getLoopVectorSize(TR_RegionStructure *loop)
+{
+    TR_HashId id = 0;
+
+    if (_loopDataType->locate(loop, id))
+        return getUnrollCount(((TR::Node *)_loopDataType->getData(id))->getDataType());
+
+    return 8;
+}
+
+// Number of scalar iterations executed by one trip around the SIMDized loop body
+int32_t TR_SPMDKernelParallelizer::getSIMDUnrollCount(TR_RegionStructure *loop)
+{
+    return getLoopVectorSize(loop) * VECTORS_PER_UNROLLED_BODY;
+}
+
 TR::Node *TR_SPMDKernelParallelizer::findLoopDataType(TR::Node *node, TR::Compilation *comp)
 {
     if (!node)
@@ -1400,15 +1419,8 @@ bool TR_SPMDKernelParallelizer::processSPMDKernelLoopForSIMDize(TR::Compilation
 {
     OMR::Logger *log = comp->log();
 
-    TR_HashId id = 0;
-    int32_t vectorSize, unrollCount;
-
-    if (_loopDataType->locate(loop, id))
-        vectorSize = getUnrollCount(((TR::Node *)_loopDataType->getData(id))->getDataType());
-    else
-        vectorSize = 8;
-
-    unrollCount = vectorSize * 4;
+    int32_t vectorSize = getLoopVectorSize(loop);
+    int32_t unrollCount = getSIMDUnrollCount(loop);
 
     TR_LoopUnroller unroller(comp, optimizer, loop, piv, TR_LoopUnroller::SPMDKernel, unrollCount - 1, peelCount,
         invariantBlock, vectorSize);
@@ -3480,6 +3492,11 @@ int32_t TR_SPMDKernelParallelizer::perform()
     if (optimizer()->optsThatCanCreateLoopsDisabled())
         return 0;
 
+    // don't pay for use-def info when there is nothing this pass can do
+    if ((comp()->getOption(TR_DisableAutoSIMD) || !comp()->cg()->getSupportsAutoSIMD())
+        && !comp()->getOptions()->getEnableGPU(TR_EnableGPU))
+        return 0;
+
     TR::StackMemoryRegion stackMemoryRegion(*trMemory());
 
     TR_UseDefInfo *useDefInfo = optimizer()->getUseDefInfo();
@@ -3995,6 +4012,48 @@ bool TR_SPMDKernelParallelizer::checkLoopIteration(TR_RegionStructure *loop, TR:
     return goodLoopBounds;
 }
 
+// Vectorization only pays off if the loop runs the vectorized body at least once. Each trip around it
+// executes getSIMDUnrollCount() iterations, the same count processSPMDKernelLoopForSIMDize() unrolls by;
+// a loop with fewer iterations runs entirely in the scalar residue loop created by the unroller and
+// only pays for the extra loop tests.
+bool TR_SPMDKernelParallelizer::isProfitableToVectorize(TR_RegionStructure *loop, TR::Compilation *comp)
+{
+    OMR::Logger *log = comp->log();
+
+    int32_t minIterations = getSIMDUnrollCount(loop);
+    int32_t iters = loop->getPrimaryInductionVariable()->getIterationCount();
+
+    if (iters > 0) {
+        if (iters < minIterations) {
+            logprintf(trace(), log, "Loop %d is not profitable to vectorize: %d iterations, vectorized body needs %d\n",
+                loop->getNumber(), iters, minIterations);
+            return false;
+        }
+
+        return true;
+    }
+
+    // Unknown trip count: estimate it from the frequency of the loop entry relative to the loop preheader.
+    // A saturated entry frequency says nothing about the trip count, so give the loop the benefit of the doubt.
+    TR::Block *loopInvariantBlock = NULL;
+    if (!TR_LoopUnroller::isWellFormedLoop(loop, comp, loopInvariantBlock) || !loopInvariantBlock)
+        return true;
+
+    int32_t entryFrequency = loop->getEntryBlock()->getFrequency();
+    int32_t preheaderFrequency = loopInvariantBlock->getFrequency();
+
+    if (entryFrequency > 0 && entryFrequency < (MAX_BLOCK_COUNT + MAX_COLD_BLOCK_COUNT) && preheaderFrequency > 0
+        && entryFrequency < preheaderFrequency * minIterations) {
+        logprintf(trace(), log,
+            "Loop %d is not profitable to vectorize: entry frequency %d, preheader frequency %d, vectorized body needs "
+            "%d iterations\n",
+            loop->getNumber(), entryFrequency, preheaderFrequency, minIterations);
+        return false;
+    }
+
+    return true;
+}
+
 bool TR_SPMDKernelParallelizer::areNodesEquivalent(TR::Compilation *comp, TR::Node *node1, TR::Node *node2)
 {
     if (!node1 && !node2)
@@ -4280,7 +4339,7 @@ void TR_SPMDKernelParallelizer::collectParallelLoops(TR_RegionStructure *region,
             && isPerfectNest(region, comp())
             && checkDataLocality(region, useNodesOfDefsInLoop, defsInLoop, comp(), useDefInfo, reductionHashTab)
             && checkIndependence(region, useDefInfo, useNodesOfDefsInLoop, defsInLoop, comp())
-            && checkLoopIteration(region, comp()))) {
+            && checkLoopIteration(region, comp()) && isProfitableToVectorize(region, comp()))) {
         logprintf(trace(), comp()->log(), "Loop %d and piv = %d collected for Auto-Vectorization\n",
             region->getNumber(), region->getPrimaryInductionVariable()->getSymRef()->getReferenceNumber());
         simdLoops.add(region);
@@ -265,6 +265,8 @@ public:
     int symbolicEvaluateTree(TR::Node *node);
 
     int32_t getUnrollCount(TR::DataType);
+    int32_t getLoopVectorSize(TR_RegionStructure *loop);
+    int32_t getSIMDUnrollCount(TR_RegionStructure *loop);
     TR::Node *findLoopDataType(TR::Node *, TR::Compilation *comp);
     void setLoopDataType(TR_RegionStructure *loop, TR::Compilation *comp);
     void genVectorAccessForScalar(TR::Node *parent, int32_t childIndex, TR::Node *node);
@@ -277,6 +279,7 @@ public:
         CS2::ArrayOf<TR::Node *, TR::Allocator> &useNodesOfDefsInLoop, SharedSparseBitVector &defsInLoop,
         TR::Compilation *comp);
     bool checkLoopIteration(TR_RegionStructure *loop, TR::Compilation *comp);
+    bool isProfitableToVectorize(TR_RegionStructure *loop, TR::Compilation *comp);
 
     // for doing data dependence analysis
     bool areNodesEquivalent(TR::Compilation *comp, TR::Node *node1, TR::Node *node2);
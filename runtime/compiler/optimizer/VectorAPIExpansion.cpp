@@ -1299,9 +1299,10 @@ bool TR_VectorAPIExpansion::boxChild(TR::TreeTop *treeTop, TR::Node *node, uint3
     int32_t elementSize = OMR::DataType::getSize(elementType);
     int32_t numLanes = bitsLength / 8 / elementSize;
 
-    if ((objectType != Vector && objectType != Mask) || // TODO: support Shuffle
-        scalarized) {
+    if ((objectType != Vector && objectType != Mask && objectType != Shuffle) || scalarized) {
         boxingSupported = false;
+    } else if (objectType == Shuffle) {
+        boxingSupported = isShuffleSupported(elementType);
     } else if (objectType == Mask) {
         maskConv = getMaskToStoreConversion(comp(), numLanes, TR::DataType::createMaskType(elementType, vectorLength),
             maskStoreOpCode);
@@ -1346,8 +1347,8 @@ bool TR_VectorAPIExpansion::boxChild(TR::TreeTop *treeTop, TR::Node *node, uint3
     treeTop->insertBefore(TR::TreeTop::create(comp(), TR::Node::create(TR::treetop, 1, newArray)));
 
     // Generate vector store to the payload array
-    TR::DataType opCodeType = (objectType == Vector) ? TR::DataType::createVectorType(elementType, vectorLength)
-                                                     : TR::DataType::createMaskType(elementType, vectorLength);
+    TR::DataType opCodeType = (objectType == Mask) ? TR::DataType::createMaskType(elementType, vectorLength)
+                                                   : TR::DataType::createVectorType(elementType, vectorLength);
 
     TR::Node *vloadNode = child;
 
@@ -1362,7 +1363,7 @@ bool TR_VectorAPIExpansion::boxChild(TR::TreeTop *treeTop, TR::Node *node, uint3
 
     TR::SymbolReference *vectorShadow = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(opCodeType, NULL);
     TR::ILOpCodes storeOpcode
-        = (objectType == Vector) ? TR::ILOpCode::createVectorOpCode(TR::vstorei, opCodeType) : maskStoreOpCode;
+        = (objectType == Mask) ? maskStoreOpCode : TR::ILOpCode::createVectorOpCode(TR::vstorei, opCodeType);
     TR::Node *storeNode = TR::Node::createWithSymRef(storeOpcode, 2, aladdNode, vloadNode, 0, vectorShadow);
     treeTop->insertBefore(TR::TreeTop::create(comp(), storeNode));
     TR::Node *fence = TR::Node::createAllocationFence(newArray, newArray);
@@ -1400,12 +1401,12 @@ bool TR_VectorAPIExpansion::boxChild(TR::TreeTop *treeTop, TR::Node *node, uint3
     // fence->setAllocation(NULL);
     treeTop->insertBefore(TR::TreeTop::create(comp(), fence));
 
-    logprintf(_trace, comp()->log(), "Boxed %s%d%s child %d of node %p into %p\n",
-        objectType == Vector ? "Vector" : "Mask", bitsLength, TR::DataType::getName(elementType), i, node, newObject);
+    logprintf(_trace, comp()->log(), "Boxed %s%d%s child %d of node %p into %p\n", vapiObjTypeNames[objectType],
+        bitsLength, TR::DataType::getName(elementType), i, node, newObject);
 
     if (TR::Options::getVerboseOption(TR_VerboseVectorAPI)) {
-        TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Boxed %s%d%s in %s at %s %s",
-            objectType == Vector ? "Vector" : "Mask", bitsLength, TR::DataType::getName(elementType),
+        TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Boxed %s%d%s in %s at %s %s", vapiObjTypeNames[objectType],
+            bitsLength, TR::DataType::getName(elementType),
             comp()->signature(), comp()->getHotnessName(comp()->getMethodHotness()), comp()->isDLT() ? "DLT" : "");
     }
     comp()->setVectorApiTransformationPerformed(true);
@@ -1433,10 +1434,12 @@ TR::Node *TR_VectorAPIExpansion::unboxNode(TR::Node *parentNode, TR::Node *opera
     TR::ILOpCodes maskConv;
     bool unboxingSupported = true;
 
-    if ((operandObjectType != Vector && operandObjectType != Mask)
+    if ((operandObjectType != Vector && operandObjectType != Mask && operandObjectType != Shuffle)
         || parentScalarized) // TODO: support unboxing into scalars
     {
         unboxingSupported = false;
+    } else if (operandObjectType == Shuffle) {
+        unboxingSupported = isShuffleSupported(elementType);
     } else if (operandObjectType == Mask) {
         maskConv = getLoadToMaskConversion(comp(), numLanes, TR::DataType::createMaskType(elementType, vectorLength),
             maskLoadOpCode);
@@ -1474,7 +1477,7 @@ TR::Node *TR_VectorAPIExpansion::unboxNode(TR::Node *parentNode, TR::Node *opera
 
     TR::DataType opCodeType = TR::NoType;
 
-    if (operandObjectType == Vector) {
+    if (operandObjectType == Vector || operandObjectType == Shuffle) {
         opCodeType = TR::DataType::createVectorType(elementType, vectorLength);
     } else if (operandObjectType == Mask) {
         opCodeType = TR::DataType::createMaskType(elementType, vectorLength);
@@ -1487,7 +1490,7 @@ TR::Node *TR_VectorAPIExpansion::unboxNode(TR::Node *parentNode, TR::Node *opera
     payloadLoad->setAndIncChild(0, operand);
 
     TR::ILOpCodes opcode
-        = operandObjectType == Vector ? TR::ILOpCode::createVectorOpCode(TR::vloadi, opCodeType) : maskLoadOpCode;
+        = operandObjectType == Mask ? maskLoadOpCode : TR::ILOpCode::createVectorOpCode(TR::vloadi, opCodeType);
 
     TR::SymbolReference *vectorShadow = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(opCodeType, NULL);
     TR::Node *newOperand = TR::Node::createWithSymRef(operand, opcode, 1, vectorShadow);
@@ -1499,12 +1502,12 @@ TR::Node *TR_VectorAPIExpansion::unboxNode(TR::Node *parentNode, TR::Node *opera
     }
 
     logprintf(_trace, comp()->log(), "Unboxed %s%d%s node %p into new node %p for parent %p\n",
-        operandObjectType == Vector ? "Vector" : "Mask", bitsLength, TR::DataType::getName(elementType), operand,
+        vapiObjTypeNames[operandObjectType], bitsLength, TR::DataType::getName(elementType), operand,
         newOperand, parentNode);
 
     if (TR::Options::getVerboseOption(TR_VerboseVectorAPI)) {
         TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Unboxed %s%d%s in %s at %s %s",
-            operandObjectType == Vector ? "Vector" : "Mask", bitsLength, TR::DataType::getName(elementType),
+            vapiObjTypeNames[operandObjectType], bitsLength, TR::DataType::getName(elementType),
             comp()->signature(), comp()->getHotnessName(comp()->getMethodHotness()), comp()->isDLT() ? "DLT" : "");
     }
     comp()->setVectorApiTransformationPerformed(true);
@@ -2170,10 +2173,11 @@ TR::Node *TR_VectorAPIExpansion::loadIntrinsicHandler(TR_VectorAPIExpansion *opt
     OMR::Logger *log = comp->log();
 
     if (mode == checkScalarization) {
-        return (objectType == Vector) ? node : NULL;
+        return (objectType == Vector || (objectType == Shuffle && isShuffleSupported(elementType))) ? node : NULL;
     } else if (mode == checkVectorization) {
-        if (objectType == Vector) {
-            logprintf(opt->_trace, log, "Vector load with numLanes %d in node %p\n", numLanes, node);
+        if (objectType == Vector || (objectType == Shuffle && isShuffleSupported(elementType))) {
+            logprintf(opt->_trace, log, "%s load with numLanes %d in node %p\n", vapiObjTypeNames[objectType],
+                numLanes, node);
 
             TR::DataType vectorType = TR::DataType::createVectorType(elementType, vectorLength);
             TR::ILOpCodes vectorOpCode = TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType);
@@ -2200,7 +2204,7 @@ TR::Node *TR_VectorAPIExpansion::loadIntrinsicHandler(TR_VectorAPIExpansion *opt
             return node;
         }
 
-        return NULL; // TODO: support other types of loads
+        return NULL;
     }
 
     logprintf(opt->_trace, log, "loadIntrinsicHandler for node %p\n", node);
@@ -2261,7 +2265,7 @@ TR::Node *TR_VectorAPIExpansion::transformLoadFromArray(TR_VectorAPIExpansion *o
     } else if (mode == doVectorization) {
         TR::ILOpCodes op;
 
-        if (objectType == Vector) {
+        if (objectType == Vector || objectType == Shuffle) {
             TR::DataType vectorType = TR::DataType::createVectorType(elementType, vectorLength);
             TR::DataType symRefType = vectorType;
             TR::SymbolReference *symRef = comp->getSymRefTab()->findOrCreateArrayShadowSymbolRef(symRefType, NULL);
@@ -2309,9 +2313,9 @@ TR::Node *TR_VectorAPIExpansion::storeIntrinsicHandler(TR_VectorAPIExpansion *op
     TR::Compilation *comp = opt->comp();
 
     if (mode == checkScalarization) {
-        return (objectType == Vector) ? node : NULL;
+        return (objectType == Vector || (objectType == Shuffle && isShuffleSupported(elementType))) ? node : NULL;
     } else if (mode == checkVectorization) {
-        if (objectType == Vector) {
+        if (objectType == Vector || (objectType == Shuffle && isShuffleSupported(elementType))) {
             TR::DataType vectorType = TR::DataType::createVectorType(elementType, vectorLength);
             TR::ILOpCodes vectorOpCode = TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType);
 
@@ -2330,10 +2334,9 @@ TR::Node *TR_VectorAPIExpansion::storeIntrinsicHandler(TR_VectorAPIExpansion *op
                 return NULL;
 
             return node;
-        } else // TODO: Shuffle
-        {
-            return NULL;
         }
+
+        return NULL;
     }
 
     logprintf(opt->_trace, comp->log(), "storeIntrinsicHandler for node %p\n", node);
@@ -2412,7 +2415,7 @@ TR::Node *TR_VectorAPIExpansion::transformStoreToArray(TR_VectorAPIExpansion *op
 
         TR::ILOpCodes op;
 
-        if (objectType == Vector) {
+        if (objectType == Vector || objectType == Shuffle) {
             TR::SymbolReference *symRef = comp->getSymRefTab()->findOrCreateArrayShadowSymbolRef(opCodeType, NULL);
             op = TR::ILOpCode::createVectorOpCode(TR::vstorei, opCodeType);
             TR::Node::recreate(node, op);
@@ -2848,6 +2851,88 @@ TR::Node *TR_VectorAPIExpansion::compressExpandOpIntrinsicHandler(TR_VectorAPIEx
         objectType == Vector ? 2 : 1, Compress);
 }
 
+TR::Node *TR_VectorAPIExpansion::rearrangeIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop,
+    TR::Node *node, TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType, int32_t numLanes,
+    handlerMode mode)
+{
+    TR::Compilation *comp = opt->comp();
+    OMR::Logger *log = comp->log();
+
+    if (mode == checkVectorization)
+        return NULL;
+
+    if (mode == checkScalarization) {
+        if (!isShuffleSupported(elementType) || numLanes < 2 || numLanes > _maxRearrangeScalarLanes) {
+            logprintf(opt->_trace, log, "Unsupported rearrange of %d %s lanes in node %p\n", numLanes,
+                TR::DataType::getName(elementType), node);
+            return NULL;
+        }
+
+        TR::Node *maskNode = node->getChild(opt->getMaskIndex(node->getSymbol()->castToMethodSymbol()));
+
+        if (!maskNode->isConstZeroValue()) {
+            logprintf(opt->_trace, log, "Unsupported masked rearrange in node %p\n", node);
+            return NULL;
+        }
+
+        return node;
+    }
+
+    TR_ASSERT_FATAL(mode == doScalarization, "Rearrange in node %p can only be scalarized\n", node);
+
+    logprintf(opt->_trace, log, "rearrangeIntrinsicHandler for node %p\n", node);
+
+    TR::Node *source = node->getChild(5);
+    TR::Node *shuffle = node->getChild(6);
+
+    anchorOldChildren(opt, treeTop, node);
+
+    if (source->getOpCodeValue() == TR::aload)
+        aloadHandler(opt, treeTop, source, elementType, vectorLength, numLanes, mode);
+
+    if (shuffle->getOpCodeValue() == TR::aload)
+        aloadHandler(opt, treeTop, shuffle, elementType, vectorLength, numLanes, mode);
+
+    // Byte and Short lanes are kept as Int after scalarization
+    bool isLong = elementType == TR::Int64;
+    TR::ILOpCodes selectOpCode = isLong ? TR::lselect : TR::iselect;
+    TR::ILOpCodes compareOpCode = isLong ? TR::lcmpeq : TR::icmpeq;
+
+    // lane i of the result is: index == 0 ? source[0] : index == 1 ? source[1] : ... : source[numLanes - 1]
+    for (int32_t i = 0; i < numLanes; i++) {
+        TR::Node *index = (i == 0) ? shuffle : getScalarNode(opt, shuffle, i);
+        TR::Node *result = getScalarNode(opt, source, numLanes - 1);
+
+        for (int32_t j = numLanes - 2; j >= 0; j--) {
+            TR::Node *lane = (j == 0) ? source : getScalarNode(opt, source, j);
+            TR::Node *laneIndex = isLong ? TR::Node::lconst(node, j) : TR::Node::iconst(node, j);
+            TR::Node *compare = TR::Node::create(node, compareOpCode, 2, index, laneIndex);
+
+            if (i == 0 && j == 0) {
+                TR::Node::recreate(node, selectOpCode);
+                node->setAndIncChild(0, compare);
+                node->setAndIncChild(1, lane);
+                node->setAndIncChild(2, result);
+                node->setNumChildren(3);
+            } else {
+                result = TR::Node::create(node, selectOpCode, 3, compare, lane, result);
+            }
+        }
+
+        if (i != 0)
+            addScalarNode(opt, node, numLanes, i, result);
+    }
+
+    if (TR::Options::getVerboseOption(TR_VerboseVectorAPI)) {
+        TR::ILOpCode opcode(selectOpCode);
+        TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Scalarized using %s in %s at %s", opcode.getName(),
+            comp->signature(), comp->getHotnessName(comp->getMethodHotness()));
+    }
+    comp->setVectorApiTransformationPerformed(true);
+
+    return node;
+}
+
 TR::Node *TR_VectorAPIExpansion::convertIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop,
     TR::Node *node, TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType, int32_t numLanes,
     handlerMode mode)
@@ -3408,7 +3493,9 @@ TR_VectorAPIExpansion::methodTableEntry TR_VectorAPIExpansion::methodTable[] = {
     { maskReductionCoercedIntrinsicHandler, Scalar, 1, -1, 2, 3, 4, 1, -1,
      { Unknown, Unknown, ElementType, NumLanes,
             Mask } }, // jdk_internal_vm_vector_VectorSupport_maskReductionCoerced
-    { unsupportedHandler, Invalid }, // jdk_internal_vm_vector_VectorSupport_rearrangeOp
+    { rearrangeIntrinsicHandler, Vector, 0, 1, 3, 4, 5, 2, 7,
+     { Unknown, Unknown, Unknown, ElementType, NumLanes, Vector, Shuffle, Mask,
+            Unknown } }, // jdk_internal_vm_vector_VectorSupport_rearrangeOp
     { reductionCoercedIntrinsicHandler, Scalar, 1, 2, 3, 4, 5, 1, 6,
      { Unknown, Unknown, Unknown, ElementType, NumLanes, Vector,
             Mask } }, // jdk_internal_vm_vector_VectorSupport_reductionCoerced
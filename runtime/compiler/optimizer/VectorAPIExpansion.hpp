@@ -91,6 +91,9 @@ private:
     // max number of operands in a vector operation (e.g. unary, binary, ternary, etc)
     static int32_t const _maxNumberOperands = 5;
 
+    // max number of lanes for which rearrange is scalarized (the select chain grows quadratically)
+    static int32_t const _maxRearrangeScalarLanes = 16;
+
 public:
     // Start of opcodes from VectorSupport.java (have to be kept up-to-date)
 
@@ -406,6 +409,28 @@ public:
         return length;
     }
 
+    /** \brief
+     *     Checks if Shuffles of the species with \c elementType can be handled like Vectors.
+     *     That is the case when the Shuffle payload holds the lane indexes in lanes of the
+     *     species' own element type, which is how the JDK lays out Shuffles of integral species
+     *     since Java 24. Earlier releases keep the indexes in a byte array.
+     *
+     *  \param elementType
+     *     Element type of the species
+     *
+     *  \return
+     *     \c true if Shuffle can be loaded, stored, boxed and unboxed as a Vector of \c elementType,
+     *     \c false otherwise
+     */
+    static bool isShuffleSupported(TR::DataType elementType)
+    {
+#if JAVA_SPEC_VERSION >= 24
+        return elementType.isIntegral();
+#else
+        return false;
+#endif
+    }
+
     /** \brief
      *     Checks if the method being compiled contains any recognized Vector API methods
      *
@@ -1622,6 +1647,43 @@ public:
         TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType, int32_t numLanes,
         handlerMode mode);
 
+    /** \brief
+     *    Scalarizes a node that is a call to \c VectorSupport.rearrangeOp() intrinsic.
+     *    Each result lane selects the source lane named by the corresponding Shuffle lane
+     *    using a chain of selects, so only species with a small number of lanes are handled.
+     *    Vectorization is not supported since there is no vector permute IL opcode.
+     *
+     *   \param opt
+     *      This optimization object
+     *
+     *   \param treeTop
+     *      Tree top of the \c node
+     *
+     *   \param node
+     *      Node to transform
+     *
+     *   \param elementType
+     *      Element type
+     *
+     *   \param vectorLength
+     *      Vector length
+     *
+     *   \param objectType
+     *      Vector API object type (Vector, Mask, Shuffle, etc.)
+     *
+     *   \param numLanes
+     *      Number of elements
+     *
+     *   \param mode
+     *      Handler mode
+     *
+     *   \return
+     *      Transformed node
+     */
+    static TR::Node *rearrangeIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop, TR::Node *node,
+        TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType, int32_t numLanes,
+        handlerMode mode);
+
     /** \brief
      *    Scalarizes or vectorizes a node that is a call to \c VectorSupport.convert() intrinsic.
      *    In both cases, the node is modified in place.
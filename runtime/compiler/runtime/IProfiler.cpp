@@ -990,19 +990,29 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::findOrCreateEntry(int32_t bucket, uin
     if (!entry)
         return NULL;
 
-    // While the entry is being allocated, another thread could have added an entry with the same PC.
-    // If that happened, it's likely that the duplicate entry is at the head of this list.
-    // Check to see if that's the case. This technique does not eliminate the race completely
-    // but catches most of duplicate situations.
-    TR_IPBytecodeHashTableEntry *headEntry = _bcHashTable[bucket];
-    if (headEntry && headEntry->getPC() == pc) {
-        delete entry; // Newly allocated entry is not needed
-        return headEntry;
-    }
+    // Entries are never removed from a bucket, so readers can walk the chains without
+    // any locking. Writers publish a new entry with a CAS on the bucket head. If the CAS
+    // fails, only the entries that were pushed since we last looked at the head need to
+    // be searched for a duplicate before retrying.
+    TR_IPBytecodeHashTableEntry *searchedHead = NULL;
+    while (true) {
+        TR_IPBytecodeHashTableEntry *headEntry = _bcHashTable[bucket];
+        for (TR_IPBytecodeHashTableEntry *crtEntry = headEntry; crtEntry != searchedHead;
+             crtEntry = crtEntry->getNext()) {
+            if (crtEntry->getPC() == pc) {
+                delete entry; // Newly allocated entry is not needed
+                return crtEntry;
+            }
+        }
+        searchedHead = headEntry;
 
-    entry->setNext(_bcHashTable[bucket]);
-    FLUSH_MEMORY(TR::Compiler->target.isSMP());
-    _bcHashTable[bucket] = entry;
+        entry->setNext(headEntry);
+        uintptr_t oldPtr = reinterpret_cast<uintptr_t>(headEntry);
+        if (oldPtr
+            == VM_AtomicSupport::lockCompareExchange(reinterpret_cast<volatile uintptr_t *>(&_bcHashTable[bucket]),
+                oldPtr, reinterpret_cast<uintptr_t>(entry)))
+            break;
+    }
 
     return entry;
 }
@@ -3095,13 +3105,9 @@ uint32_t TR_IProfiler::releaseAllEntries(uint32_t &unexpectedLockedEntries)
     for (int32_t bucket = 0; bucket < TR::Options::_iProfilerBcHashTableSize; bucket++) {
         for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
             if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked()) {
-                // Because there is a known race in findOrCreateEntry(), there is a
-                // chance that this entry is still locked because another entry for
-                // the same PC was added after it. These should not contribute to
-                // the number of unexpectedly locked entries.
-                auto otherEntry = profilingSample(entry->getPC(), 0, false);
-                if (entry == otherEntry)
-                    unexpectedLockedEntries++;
+                // findOrCreateEntry() never publishes two entries for the same PC,
+                // so any entry still locked at this point is unexpected
+                unexpectedLockedEntries++;
                 count++;
                 entry->asIPBCDataCallGraph()->releaseEntry();
             }
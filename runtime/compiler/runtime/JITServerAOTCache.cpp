@@ -23,6 +23,8 @@
 #include <string.h>
 #include <string>
 #include <cstdio> // for rename()
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "control/CompilationRuntime.hpp"
 #include "env/J9SegmentProvider.hpp"
 #include "env/StackMemoryRegion.hpp"
@@ -33,16 +35,20 @@
 #include "runtime/JITServerSharedROMClassCache.hpp"
 #include "net/CommunicationStream.hpp"
 
+// Maps the record IDs in a cache snapshot to the records that were read from it.
+// Outlives the read operation if some cached methods are read from the snapshot on demand.
 struct JITServerAOTCacheReadContext {
-    JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header, TR::StackMemoryRegion &stackMemoryRegion);
-
-    Vector<AOTCacheClassLoaderRecord *> _classLoaderRecords;
-    Vector<AOTCacheClassRecord *> _classRecords;
-    Vector<AOTCacheMethodRecord *> _methodRecords;
-    Vector<AOTCacheClassChainRecord *> _classChainRecords;
-    Vector<AOTCacheWellKnownClassesRecord *> _wellKnownClassesRecords;
-    Vector<AOTCacheAOTHeaderRecord *> _aotHeaderRecords;
-    Vector<AOTCacheThunkRecord *> _thunkRecords;
+    TR_PERSISTENT_ALLOC(TR_Memory::JITServerAOTCache)
+
+    JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header);
+
+    PersistentVector<AOTCacheClassLoaderRecord *> _classLoaderRecords;
+    PersistentVector<AOTCacheClassRecord *> _classRecords;
+    PersistentVector<AOTCacheMethodRecord *> _methodRecords;
+    PersistentVector<AOTCacheClassChainRecord *> _classChainRecords;
+    PersistentVector<AOTCacheWellKnownClassesRecord *> _wellKnownClassesRecords;
+    PersistentVector<AOTCacheAOTHeaderRecord *> _aotHeaderRecords;
+    PersistentVector<AOTCacheThunkRecord *> _thunkRecords;
 };
 
 size_t JITServerAOTCacheMap::_cacheMaxBytes = 300 * 1024 * 1024;
@@ -98,6 +104,46 @@ template<class R> R *AOTCacheRecord::readRecord(FILE *f, const JITServerAOTCache
     return record;
 }
 
+// Read a single AOT cache record R from a buffer (e.g. a memory-mapped cache file) that holds exactly that record
+template<class R>
+R *AOTCacheRecord::readRecord(const uint8_t *buffer, size_t bufferSize, const JITServerAOTCacheReadContext &context)
+{
+    typename R::SerializationRecord header;
+    if (bufferSize < sizeof(header)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Could not read %s record header",
+                R::getRecordName());
+        return NULL;
+    }
+    memcpy((void *)&header, buffer, sizeof(header));
+
+    if (!header.isValidHeader(context) || (header.size() != bufferSize)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Header for %s record is invalid",
+                R::getRecordName());
+        return NULL;
+    }
+
+    // The size of the data must also be consistent with the rest of the header
+    size_t recordSize = R::size(header);
+    R *record = new (AOTCacheRecord::allocate(recordSize)) R(context, header);
+    if ((const uint8_t *)record->dataAddr() + bufferSize > (const uint8_t *)record + recordSize) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Size of %s record is invalid",
+                R::getRecordName());
+        AOTCacheRecord::free(record);
+        return NULL;
+    }
+    memcpy((void *)record->dataAddr(), buffer, bufferSize);
+
+    if (!record->setSubrecordPointers(context)) {
+        AOTCacheRecord::free(record);
+        return NULL;
+    }
+
+    return record;
+}
+
 bool AOTSerializationRecord::isValidHeader(AOTSerializationRecordType type) const
 {
     return (type == this->type()) && (0 != this->id());
@@ -704,6 +750,10 @@ JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM)
     , _cachedMethodHead(NULL)
     , _cachedMethodTail(NULL)
     , _cachedMethodMonitor(TR::Monitor::create("JIT-JITServerAOTCacheCachedMethodMonitor"))
+    , _snapshotMethodMap(decltype(_snapshotMethodMap)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _snapshotData(NULL)
+    , _snapshotSize(0)
+    , _snapshotContext(NULL)
     , _timePrevSaveOperation(0)
     , _minNumAOTMethodsToSave(TR::Options::_aotCachePersistenceMinDeltaMethods)
     , _saveOperationInProgress(false)
@@ -715,6 +765,7 @@ JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM)
     , _numDeserializedMethods(0)
     , _numDeserializationFailures(0)
     , _numGeneratedClasses(0)
+    , _numSnapshotMethodsLoaded(0)
 {
     bool allMonitors = _classLoaderMonitor && _classMonitor && _methodMonitor && _classChainMonitor
         && _wellKnownClassesMonitor && _aotHeaderMonitor && _cachedMethodMonitor;
@@ -736,6 +787,13 @@ JITServerAOTCache::~JITServerAOTCache()
     freeMapValues(_thunkMap);
     freeMapValues(_cachedMethodMap);
 
+    if (_snapshotData)
+        munmap((void *)_snapshotData, _snapshotSize);
+    if (_snapshotContext) {
+        _snapshotContext->~JITServerAOTCacheReadContext();
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(_snapshotContext);
+    }
+
     TR::Monitor::destroy(_classMonitor);
     TR::Monitor::destroy(_classLoaderMonitor);
     TR::Monitor::destroy(_methodMonitor);
@@ -746,15 +804,14 @@ JITServerAOTCache::~JITServerAOTCache()
     TR::Monitor::destroy(_cachedMethodMonitor);
 }
 
-JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header,
-    TR::StackMemoryRegion &stackMemoryRegion)
-    : _classLoaderRecords(header._nextClassLoaderId, NULL, stackMemoryRegion)
-    , _classRecords(header._nextClassId, NULL, stackMemoryRegion)
-    , _methodRecords(header._nextMethodId, NULL, stackMemoryRegion)
-    , _classChainRecords(header._nextClassChainId, NULL, stackMemoryRegion)
-    , _wellKnownClassesRecords(header._nextWellKnownClassesId, NULL, stackMemoryRegion)
-    , _aotHeaderRecords(header._nextAOTHeaderId, NULL, stackMemoryRegion)
-    , _thunkRecords(header._nextThunkId, NULL, stackMemoryRegion)
+JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header)
+    : _classLoaderRecords(header._nextClassLoaderId, NULL, TR::Compiler->persistentGlobalAllocator())
+    , _classRecords(header._nextClassId, NULL, TR::Compiler->persistentGlobalAllocator())
+    , _methodRecords(header._nextMethodId, NULL, TR::Compiler->persistentGlobalAllocator())
+    , _classChainRecords(header._nextClassChainId, NULL, TR::Compiler->persistentGlobalAllocator())
+    , _wellKnownClassesRecords(header._nextWellKnownClassesId, NULL, TR::Compiler->persistentGlobalAllocator())
+    , _aotHeaderRecords(header._nextAOTHeaderId, NULL, TR::Compiler->persistentGlobalAllocator())
+    , _thunkRecords(header._nextThunkId, NULL, TR::Compiler->persistentGlobalAllocator())
 {}
 
 const AOTCacheClassLoaderRecord *JITServerAOTCache::getClassLoaderRecord(const uint8_t *name, size_t nameLength)
@@ -1026,7 +1083,7 @@ bool JITServerAOTCache::storeMethod(const AOTCacheClassChainRecord *definingClas
     }
 
     auto it = _cachedMethodMap.find(key);
-    if (it != _cachedMethodMap.end()) {
+    if ((it != _cachedMethodMap.end()) || (_snapshotMethodMap.find(key) != _snapshotMethodMap.end())) {
         // NOTE: Current implementation keeps the first version of the method for this key in the cache.
         //       If we want to keep the most recent version instead, we will need to synchronize deleting
         //       the old version with any concurrent threads that could be sending it to other clients.
@@ -1059,13 +1116,79 @@ const CachedAOTMethod *JITServerAOTCache::findMethod(const AOTCacheClassChainRec
     OMR::CriticalSection cs(_cachedMethodMonitor);
 
     auto it = _cachedMethodMap.find(key);
-    if (it == _cachedMethodMap.end()) {
+    if (it != _cachedMethodMap.end()) {
+        ++_numCacheHits;
+        return it->second;
+    }
+
+    // The method may not have been read from the snapshot yet
+    CachedAOTMethod *method = loadSnapshotMethod(key);
+    if (!method) {
         ++_numCacheMisses;
         return NULL;
     }
 
     ++_numCacheHits;
-    return it->second;
+    return method;
+}
+
+CachedAOTMethod *JITServerAOTCache::loadSnapshotMethod(const CachedMethodKey &key)
+{
+    if (_snapshotMethodMap.empty())
+        return NULL;
+
+    auto it = _snapshotMethodMap.find(key);
+    if (it == _snapshotMethodMap.end())
+        return NULL;
+
+    if (!JITServerAOTCacheMap::cacheHasSpace())
+        return NULL;
+
+    const SnapshotMethodLocation &location = it->second;
+    CachedAOTMethod *method = AOTCacheRecord::readRecord<CachedAOTMethod>(_snapshotData + location._offset,
+        location._size, *_snapshotContext);
+    if (method
+        && (CachedMethodKey(method->definingClassChainRecord(), method->data().index(), method->data().optLevel(),
+                _snapshotContext->_aotHeaderRecords[method->data().aotHeaderId()])
+            != key)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "AOT cache %s: Cached method at offset %llu does not match its index entry", _name.c_str(),
+                (unsigned long long)location._offset);
+        AOTCacheRecord::free(method);
+        method = NULL;
+    }
+
+    // Whether it could be read or not, the method is not looked up in the snapshot again
+    _snapshotMethodMap.erase(it);
+    if (!method)
+        return NULL;
+
+    addToMap(_cachedMethodMap, _cachedMethodHead, _cachedMethodTail, key, method);
+    ++_numSnapshotMethodsLoaded;
+
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: read method %s @ %s from snapshot",
+            _name.c_str(), method->data().signature(), TR::Compilation::getHotnessName(method->data().optLevel()));
+
+    return method;
+}
+
+void JITServerAOTCache::serializedMethodsDo(const std::function<void(const SerializedAOTMethod &)> &f) const
+{
+    OMR::CriticalSection cs(_cachedMethodMonitor);
+
+    for (const CachedAOTMethod *method = _cachedMethodHead; method; method = method->getNextRecord())
+        f(method->data());
+    // Serialized methods in the snapshot are suitably aligned since the file is mapped at a page boundary
+    // and the sizes of all the data written before them are multiples of sizeof(size_t)
+    for (auto &kv : _snapshotMethodMap) {
+        auto method = (const SerializedAOTMethod *)(_snapshotData + kv.second._offset);
+        // Skip methods that are inconsistent with their index entry; they will fail to be read anyway
+        if ((method->size() == kv.second._size)
+            && ((const uint8_t *)method->signature() + method->signatureSize() <= method->end()))
+            f(*method);
+    }
 }
 
 Vector<const AOTSerializationRecord *> JITServerAOTCache::getSerializationRecords(const CachedAOTMethod *method,
@@ -1134,7 +1257,7 @@ void JITServerAOTCache::printStats(FILE *f) const
 {
     fprintf(f,
         "JITServer AOT cache %s statistics:\n"
-        "\tstored methods: %zu\n"
+        "\tstored methods: %zu (%zu not yet read from snapshot, %zu read on demand)\n"
         "\tclass loader records: %zu\n"
         "\tclass records: %zu (%zu generated)\n"
         "\tmethod records: %zu\n"
@@ -1146,7 +1269,8 @@ void JITServerAOTCache::printStats(FILE *f) const
         "\tcache misses: %zu\n"
         "\tdeserialized methods: %zu\n"
         "\tdeserialization failures: %zu\n",
-        _name.c_str(), _cachedMethodMap.size(), _classLoaderMap.size(), _classMap.size(), _numGeneratedClasses,
+        _name.c_str(), _cachedMethodMap.size() + _snapshotMethodMap.size(), _snapshotMethodMap.size(),
+        _numSnapshotMethodsLoaded, _classLoaderMap.size(), _classMap.size(), _numGeneratedClasses,
         _methodMap.size(), _classChainMap.size(), _wellKnownClassesMap.size(), _aotHeaderMap.size(), _numCacheBypasses,
         _numCacheHits, _numCacheMisses, _numDeserializedMethods, _numDeserializationFailures);
 }
@@ -1192,6 +1316,45 @@ static bool writeCachedMethodList(FILE *f, const CachedAOTMethod *head, size_t n
     return true;
 }
 
+// Write the index entries for at most numRecordsToWrite methods from the linked list starting at head, followed by
+// the entries for the methods that have not been read from the snapshot yet. The methods themselves are written in
+// the same order after the index, starting at offset methodsOffset.
+static bool writeCachedMethodIndex(FILE *f, const CachedAOTMethod *head, size_t numRecordsToWrite,
+    const PersistentVector<JITServerAOTCacheMethodIndexEntry> &snapshotMethods, uint64_t methodsOffset)
+{
+    const CachedAOTMethod *current = head;
+    uint64_t offset = methodsOffset;
+    for (size_t i = 0; current && (i < numRecordsToWrite); ++i, current = current->getNextRecord()) {
+        const SerializedAOTMethod &method = current->data();
+        JITServerAOTCacheMethodIndexEntry entry = { 0 };
+        entry._definingClassChainId = method.definingClassChainId();
+        entry._aotHeaderId = method.aotHeaderId();
+        entry._offset = offset;
+        entry._size = method.size();
+        entry._index = method.index();
+        entry._optLevel = method.optLevel();
+        if (1 != fwrite(&entry, sizeof(entry), 1, f)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write method index entry");
+            return false;
+        }
+        offset += entry._size;
+    }
+
+    for (size_t i = 0; i < snapshotMethods.size(); ++i) {
+        JITServerAOTCacheMethodIndexEntry entry = snapshotMethods[i];
+        entry._offset = offset;
+        if (1 != fwrite(&entry, sizeof(entry), 1, f)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write method index entry");
+            return false;
+        }
+        offset += entry._size;
+    }
+
+    return true;
+}
+
 static void getCurrentAOTCacheVersion(JITServerAOTCacheVersion &version)
 {
     memcpy(version._eyeCatcher, JITSERVER_AOTCACHE_EYECATCHER, JITSERVER_AOTCACHE_EYECATCHER_LENGTH);
@@ -1204,7 +1367,8 @@ static void getCurrentAOTCacheVersion(JITServerAOTCacheVersion &version)
 // record traversal is written directly to the stream in sections, since the full AOT record
 // can be reconstructed from only this information. These sections are ordered so that, when
 // reading the snapshot, the dependencies of each record will already have been read by the
-// time we get to that record.
+// time we get to that record. The cached methods are preceded by an index that allows
+// reading them on demand from a memory-mapped snapshot.
 // Return the number of AOT methods written to the snapshot or 0 on failure.
 size_t JITServerAOTCache::writeCache(FILE *f) const
 {
@@ -1212,12 +1376,30 @@ size_t JITServerAOTCache::writeCache(FILE *f) const
     getCurrentAOTCacheVersion(header._version);
     header._serverUID = TR::CompilationInfo::get()->getPersistentInfo()->getServerUID();
 
+    // Methods that have not been read yet from the snapshot this cache was loaded from are copied from
+    // the mapped snapshot. If they are read concurrently, they are appended to the traversal after the
+    // methods that are written from it, so they cannot be written twice.
+    PersistentVector<JITServerAOTCacheMethodIndexEntry> snapshotMethods(TR::Compiler->persistentGlobalAllocator());
+    size_t numLoadedMethods = 0;
+
     // It is possible for a record and its dependencies to be added between .size() calls,
     // so we must reverse the order in which we read the map sizes (compared to their write order)
     // to ensure that those dependencies are not excluded from serialization.
     {
         OMR::CriticalSection cs(_cachedMethodMonitor);
-        header._numCachedAOTMethods = _cachedMethodMap.size();
+        numLoadedMethods = _cachedMethodMap.size();
+        snapshotMethods.reserve(_snapshotMethodMap.size());
+        for (auto &kv : _snapshotMethodMap) {
+            JITServerAOTCacheMethodIndexEntry entry = { 0 };
+            entry._definingClassChainId = std::get<0>(kv.first)->data().id();
+            entry._index = std::get<1>(kv.first);
+            entry._optLevel = std::get<2>(kv.first);
+            entry._aotHeaderId = std::get<3>(kv.first)->data().id();
+            entry._offset = kv.second._offset; // offset in the snapshot being read
+            entry._size = kv.second._size;
+            snapshotMethods.push_back(entry);
+        }
+        header._numCachedAOTMethods = numLoadedMethods + snapshotMethods.size();
     }
     if (header._numCachedAOTMethods == 0) {
         TR_ASSERT_FATAL(false, "Expected to write at least one method to the AOT cache file");
@@ -1279,8 +1461,26 @@ size_t JITServerAOTCache::writeCache(FILE *f) const
         return 0;
     if (!writeRecordList(f, _thunkHead, header._numThunkRecords))
         return 0;
-    if (!writeCachedMethodList(f, _cachedMethodHead, header._numCachedAOTMethods))
+
+    long indexOffset = ftell(f);
+    if (indexOffset < 0) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to determine cache file position");
+        return 0;
+    }
+    uint64_t methodsOffset
+        = (uint64_t)indexOffset + header._numCachedAOTMethods * sizeof(JITServerAOTCacheMethodIndexEntry);
+    if (!writeCachedMethodIndex(f, _cachedMethodHead, numLoadedMethods, snapshotMethods, methodsOffset))
         return 0;
+    if (!writeCachedMethodList(f, _cachedMethodHead, numLoadedMethods))
+        return 0;
+    for (size_t i = 0; i < snapshotMethods.size(); ++i) {
+        if (1 != fwrite(_snapshotData + snapshotMethods[i]._offset, snapshotMethods[i]._size, 1, f)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write record to cache file");
+            return 0;
+        }
+    }
 
     return header._numCachedAOTMethods;
 }
@@ -1298,7 +1498,7 @@ static bool isCompatibleSnapshotVersion(const JITServerAOTCacheVersion &version)
 
 // Read an AOT cache snapshot, returning NULL if the cache is ill-formed or
 // incompatible with the running server.
-JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name, TR_Memory &trMemory)
+JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name)
 {
     if (!JITServerAOTCacheMap::cacheHasSpace())
         return NULL;
@@ -1336,7 +1536,7 @@ JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name
 
     bool readSuccess = false;
     try {
-        readSuccess = cache->readCache(f, header, trMemory);
+        readSuccess = cache->readCache(f, header);
     } catch (const std::exception &e) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache reading failed with exception: %s", e.what());
@@ -1356,7 +1556,7 @@ JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name
 // updating the map, record traversal, and scratch Vector associated with V.
 template<typename K, typename V, typename H>
 bool JITServerAOTCache::readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecordsToRead,
-    PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, Vector<V *> &records)
+    PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, PersistentVector<V *> &records)
 {
     for (size_t i = 0; i < numRecordsToRead; ++i) {
         if (!JITServerAOTCacheMap::cacheHasSpace())
@@ -1382,7 +1582,7 @@ bool JITServerAOTCache::readRecords(FILE *f, JITServerAOTCacheReadContext &conte
     return true;
 }
 
-bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header, TR_Memory &trMemory)
+bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header)
 {
     _classLoaderMap.reserve(header._numClassLoaderRecords);
     _classMap.reserve(header._numClassRecords);
@@ -1391,7 +1591,6 @@ bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header
     _wellKnownClassesMap.reserve(header._numWellKnownClassesRecords);
     _aotHeaderMap.reserve(header._numAOTHeaderRecords);
     _thunkMap.reserve(header._numThunkRecords);
-    _cachedMethodMap.reserve(header._numCachedAOTMethods);
 
     _nextClassLoaderId = header._nextClassLoaderId;
     _nextClassId = header._nextClassId;
@@ -1401,8 +1600,9 @@ bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header
     _nextAOTHeaderId = header._nextAOTHeaderId;
     _nextThunkId = header._nextThunkId;
 
-    TR::StackMemoryRegion stackMemoryRegion(trMemory);
-    JITServerAOTCacheReadContext context(header, stackMemoryRegion);
+    // The context is owned by the cache so that it is freed by the destructor if reading fails
+    _snapshotContext = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCacheReadContext(header);
+    JITServerAOTCacheReadContext &context = *_snapshotContext;
 
     if (!readRecords(f, context, header._numClassLoaderRecords, _classLoaderMap, _classLoaderHead, _classLoaderTail,
             context._classLoaderRecords))
@@ -1424,6 +1624,20 @@ bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header
     if (!readRecords(f, context, header._numThunkRecords, _thunkMap, _thunkHead, _thunkTail, context._thunkRecords))
         return false;
 
+    // Normally only the index of the cached methods is read here, and the methods themselves
+    // are read from the memory-mapped snapshot when they are first looked up
+    static const bool disableLazyLoad = feGetEnv("TR_DisableJITServerAOTCacheLazyLoad") != NULL;
+    if (!disableLazyLoad && mapSnapshot(f))
+        return readCachedMethodIndex(f, header);
+
+    // Otherwise skip the index and read all the cached methods right away
+    if (0 != fseek(f, header._numCachedAOTMethods * sizeof(JITServerAOTCacheMethodIndexEntry), SEEK_CUR)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to skip cached method index");
+        return false;
+    }
+
+    _cachedMethodMap.reserve(header._numCachedAOTMethods);
     for (size_t i = 0; i < header._numCachedAOTMethods; ++i) {
         if (!JITServerAOTCacheMap::cacheHasSpace())
             return false;
@@ -1441,13 +1655,87 @@ bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header
         }
     }
 
+    // The read context is no longer needed
+    _snapshotContext->~JITServerAOTCacheReadContext();
+    TR::Compiler->persistentGlobalMemory()->freePersistentMemory(_snapshotContext);
+    _snapshotContext = NULL;
+
+    return true;
+}
+
+bool JITServerAOTCache::mapSnapshot(FILE *f)
+{
+    struct stat fileStat;
+    if ((0 != fstat(fileno(f), &fileStat)) || (fileStat.st_size <= 0))
+        return false;
+
+    void *data = mmap(NULL, fileStat.st_size, PROT_READ, MAP_SHARED, fileno(f), 0);
+    if (MAP_FAILED == data) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "AOT cache %s: Unable to map cache file: %s. Cached methods will be read right away", _name.c_str(),
+                strerror(errno));
+        return false;
+    }
+
+    _snapshotData = (const uint8_t *)data;
+    _snapshotSize = fileStat.st_size;
+    return true;
+}
+
+bool JITServerAOTCache::readCachedMethodIndex(FILE *f, const JITServerAOTCacheHeader &header)
+{
+    const JITServerAOTCacheReadContext &context = *_snapshotContext;
+
+    long indexOffset = ftell(f);
+    if (indexOffset < 0)
+        return false;
+    uint64_t methodsOffset
+        = (uint64_t)indexOffset + header._numCachedAOTMethods * sizeof(JITServerAOTCacheMethodIndexEntry);
+
+    _snapshotMethodMap.reserve(header._numCachedAOTMethods);
+    for (size_t i = 0; i < header._numCachedAOTMethods; ++i) {
+        if (!JITServerAOTCacheMap::cacheHasSpace())
+            return false;
+
+        JITServerAOTCacheMethodIndexEntry entry;
+        if (1 != fread(&entry, sizeof(entry), 1, f)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Could not read cached method index");
+            return false;
+        }
+
+        // The method must lie within the file after the index, and the records it is identified by must exist
+        if ((entry._offset < methodsOffset) || (entry._offset % sizeof(size_t)) || (entry._offset > _snapshotSize)
+            || (entry._size < sizeof(SerializedAOTMethod)) || (entry._size > _snapshotSize - entry._offset)
+            || (entry._optLevel >= TR_Hotness::numHotnessLevels)
+            || (entry._definingClassChainId >= context._classChainRecords.size())
+            || !context._classChainRecords[entry._definingClassChainId]
+            || (entry._aotHeaderId >= context._aotHeaderRecords.size())
+            || !context._aotHeaderRecords[entry._aotHeaderId]) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Cached method index entry %zu is invalid",
+                    i);
+            return false;
+        }
+
+        CachedMethodKey key(context._classChainRecords[entry._definingClassChainId], entry._index,
+            (TR_Hotness)entry._optLevel, context._aotHeaderRecords[entry._aotHeaderId]);
+        if (!_snapshotMethodMap.insert({ key, { entry._offset, entry._size } }).second) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "AOT cache: Cached method index entry %zu is a duplicate", i);
+            return false;
+        }
+    }
+
     return true;
 }
 
 size_t JITServerAOTCache::getNumCachedMethods() const
 {
     OMR::CriticalSection cs(_cachedMethodMonitor);
-    return _cachedMethodMap.size();
+    return _cachedMethodMap.size() + _snapshotMethodMap.size();
 }
 
 bool JITServerAOTCache::triggerAOTCacheStoreToFileIfNeeded()
@@ -1461,7 +1749,7 @@ bool JITServerAOTCache::triggerAOTCacheStoreToFileIfNeeded()
             return false;
 
         // Check whether enough new methods were added to the in-memory cache to be worth attempting a save operation
-        if (_cachedMethodMap.size() < _minNumAOTMethodsToSave)
+        if (_cachedMethodMap.size() + _snapshotMethodMap.size() < _minNumAOTMethodsToSave)
             return false;
 
         // Prevent saving to file too often; wait some time between consecutive saves
@@ -1751,7 +2039,7 @@ bool JITServerAOTCacheMap::saveNextQueuedAOTCacheToFile()
     return success;
 }
 
-void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider &scratchSegmentProvider)
+void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile()
 {
     std::string cacheName;
     {
@@ -1781,17 +2069,8 @@ void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                     "AOT cache: t=%llu Opened file %s to load cache '%s' from file",
                     compInfo->getPersistentInfo()->getElapsedTime(), cacheFileName.c_str(), cacheName.c_str());
-            size_t segmentSize = scratchSegmentProvider.getPreferredSegmentSize();
-            if (!segmentSize)
-                segmentSize = 1 << 24 /*16 MB*/;
-            TR::RawAllocator rawAllocator(compInfo->getJITConfig()->javaVM);
-            J9::SystemSegmentProvider segmentProvider(1 << 16 /*64 KB*/, segmentSize,
-                TR::Options::getScratchSpaceLimit(), scratchSegmentProvider, rawAllocator);
-            TR::Region region(segmentProvider, rawAllocator);
-            TR_Memory trMemory(*compInfo->persistentMemory(), region);
-
-            cache = JITServerAOTCache::readCache(cacheFile, cacheName, trMemory); // This should not throw
-            fclose(cacheFile); // filestream not needed anymore
+            cache = JITServerAOTCache::readCache(cacheFile, cacheName); // This should not throw
+            fclose(cacheFile); // filestream not needed anymore; the cache keeps its own mapping of the file
             cacheFile = NULL;
 
             if (cache) {
@@ -1927,3 +2206,10 @@ void JITServerAOTCacheMap::printStats(FILE *f) const
     for (auto &it : _map)
         it.second->printStats(f);
 }
+
+void JITServerAOTCacheMap::forEachCache(const std::function<void(const JITServerAOTCache &)> &func) const
+{
+    OMR::CriticalSection cs(_monitor);
+    for (auto &it : _map)
+        func(*it.second);
+}
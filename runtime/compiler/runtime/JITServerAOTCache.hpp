@@ -32,7 +32,7 @@
 
 class JITServerSharedProfileCache;
 
-static const uint32_t JITSERVER_AOTCACHE_VERSION = 1;
+static const uint32_t JITSERVER_AOTCACHE_VERSION = 2;
 static const char JITSERVER_AOTCACHE_EYECATCHER[] = "AOTCACHE";
 // the eye-catcher is not null-terminated in the snapshot files
 static const size_t JITSERVER_AOTCACHE_EYECATCHER_LENGTH = sizeof(JITSERVER_AOTCACHE_EYECATCHER) - 1;
@@ -74,6 +74,18 @@ struct JITServerAOTCacheHeader {
     size_t _nextThunkId;
 };
 
+// An entry in the index of cached AOT methods in a snapshot, which is written right after the
+// records that the methods depend on. The entry identifies the method and the location of its
+// SerializedAOTMethod data in the file, so that a method is only read when it is first looked up.
+struct JITServerAOTCacheMethodIndexEntry {
+    uintptr_t _definingClassChainId;
+    uintptr_t _aotHeaderId;
+    uint64_t _offset; // from the start of the snapshot file
+    uint64_t _size;
+    uint32_t _index;
+    uint32_t _optLevel;
+};
+
 struct AOTCacheClassLoaderRecord;
 struct AOTCacheClassRecord;
 struct AOTCacheMethodRecord;
@@ -120,6 +132,8 @@ public:
     static void free(void *ptr);
 
     template<class R> static R *readRecord(FILE *f, const JITServerAOTCacheReadContext &context);
+    template<class R>
+    static R *readRecord(const uint8_t *buffer, size_t bufferSize, const JITServerAOTCacheReadContext &context);
 
     AOTCacheRecord *getNextRecord() const { return _nextRecord; }
 
@@ -428,6 +442,8 @@ private:
     using SerializationRecord = SerializedAOTMethod;
 
     friend CachedAOTMethod *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend CachedAOTMethod *AOTCacheRecord::readRecord<>(const uint8_t *buffer, size_t bufferSize,
+        const JITServerAOTCacheReadContext &context);
 
     CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index, TR_Hotness optLevel,
         const AOTCacheAOTHeaderRecord *aotHeaderRecord,
@@ -531,6 +547,10 @@ public:
 
     void incNumCacheMisses() { ++_numCacheMisses; }
 
+    size_t getNumCacheHits() const { return _numCacheHits; }
+
+    size_t getNumCacheMisses() const { return _numCacheMisses; }
+
     size_t getNumDeserializedMethods() const { return _numDeserializedMethods; }
 
     void incNumDeserializedMethods() { ++_numDeserializedMethods; }
@@ -540,9 +560,14 @@ public:
     void printStats(FILE *f) const;
 
     size_t writeCache(FILE *f) const;
-    static JITServerAOTCache *readCache(FILE *f, const std::string &name, TR_Memory &trMemory);
+    static JITServerAOTCache *readCache(FILE *f, const std::string &name);
     size_t getNumCachedMethods() const;
 
+    // Calls f(m) for each serialized AOT method in the cache, including the methods that
+    // have not been read yet from the snapshot this cache was loaded from.
+    // Acquires the _cachedMethodMonitor.
+    void serializedMethodsDo(const std::function<void(const SerializedAOTMethod &)> &f) const;
+
     void setMinNumAOTMethodsToSave(size_t num) { _minNumAOTMethodsToSave = num; }
 
     /**
@@ -675,11 +700,20 @@ private:
     void addRecord(const AOTCacheRecord *record, Vector<const AOTSerializationRecord *> &result,
         UnorderedSet<const AOTCacheRecord *> &newRecords, const KnownIdSet &knownIds) const;
     // Read a cache snapshot into an empty cache
-    bool readCache(FILE *f, const JITServerAOTCacheHeader &header, TR_Memory &trMemory);
+    bool readCache(FILE *f, const JITServerAOTCacheHeader &header);
+    // Map the snapshot file read-only so that cached methods can be read from it on demand
+    bool mapSnapshot(FILE *f);
+    // Read the index of cached methods in a mapped snapshot
+    bool readCachedMethodIndex(FILE *f, const JITServerAOTCacheHeader &header);
 
     template<typename K, typename V, typename H>
     static bool readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecordsToRead,
-        PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, Vector<V *> &records);
+        PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail,
+        PersistentVector<V *> &records);
+
+    // Read the cached method with the given key from the snapshot if it has not been read yet.
+    // Must be called with the _cachedMethodMonitor in hand.
+    CachedAOTMethod *loadSnapshotMethod(const CachedMethodKey &key);
 
     const std::string _name;
     JITServerSharedProfileCache * const _sharedProfileCache;
@@ -734,6 +768,19 @@ private:
     CachedAOTMethod *_cachedMethodTail;
     TR::Monitor * const _cachedMethodMonitor;
 
+    // Cached methods that are in the memory-mapped snapshot this cache was loaded from, but have not been
+    // looked up yet. Also protected by the _cachedMethodMonitor. The mapping and the read context that
+    // resolves record IDs to records are kept for the lifetime of the cache.
+    struct SnapshotMethodLocation {
+        uint64_t _offset;
+        uint64_t _size;
+    };
+
+    PersistentUnorderedMap<CachedMethodKey, SnapshotMethodLocation> _snapshotMethodMap;
+    const uint8_t *_snapshotData;
+    size_t _snapshotSize;
+    JITServerAOTCacheReadContext *_snapshotContext;
+
     uint64_t _timePrevSaveOperation; // Millis when this cache was last saved to file
     size_t _minNumAOTMethodsToSave; // Minimum number of AOT methods present in the cache before considering a save
                                     // operation
@@ -747,6 +794,7 @@ private:
     size_t _numDeserializedMethods;
     size_t _numDeserializationFailures;
     size_t _numGeneratedClasses;
+    size_t _numSnapshotMethodsLoaded;
 };
 
 // Maps AOT cache names to JITServerAOTCache instances
@@ -774,7 +822,7 @@ public:
        Any exceptions thrown by this method are caught and logged.
        This method acquires the AOTCacheMap monitor.
     */
-    void loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider &scratchSegmentProvider);
+    void loadNextQueuedAOTCacheFromFile();
 
     /**
        @brief Obtain a pointer to a named AOT cache. If it doesn't exist, attempt to create one.
@@ -798,6 +846,9 @@ public:
 
     void printStats(FILE *f) const;
 
+    // Invoke func on each named AOT cache while holding the AOTCacheMap monitor
+    void forEachCache(const std::function<void(const JITServerAOTCache &)> &func) const;
+
 private:
     static std::string buildCacheFileName(const std::string &cacheDir, const std::string &cacheName);
 
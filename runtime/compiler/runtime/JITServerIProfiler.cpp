@@ -845,6 +845,46 @@ void JITClientIProfiler::gatherUncachedClassesUsedInCGEntry(TR_IPBCDataCallGraph
     }
 }
 
+/**
+ * @brief Code to be executed on the JITClient to collect the classes profiled at the call sites
+ *        and type checks of a method, which the server does not have yet
+ *
+ * The receiver classes seen by the IProfiler are the likely inlining candidates when compiling
+ * the method, so sending them together with the compilation request saves the server from
+ * asking for each of them in a separate round trip.
+ * The caller must hold VM access, so that the profiled classes cannot be unloaded.
+ *
+ * @param method J9Method in question
+ * @param comp The compilation object
+ * @param uncachedClasses OUTPUT. Vector of classes that server needs but does not have
+ * @param classInfos OUTPUT. Vector of ClassInfos corresponding to elements in `uncachedClasses`
+ */
+void JITClientIProfiler::gatherUncachedClassesUsedInMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp,
+    std::vector<J9Class *> &uncachedClasses, std::vector<JITServerHelpers::ClassInfoTuple> &classInfos)
+{
+    TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+    TR_ResolvedJ9Method resolvedj9method = TR_ResolvedJ9Method(method, comp->fej9(), comp->trMemory());
+    TR_J9ByteCodeIterator bci(NULL, &resolvedj9method, static_cast<TR_J9VMBase *>(comp->fej9()), comp);
+    for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown; bc = bci.next()) {
+        switch (bc) {
+            case J9BCinvokevirtual:
+            case J9BCinvokeinterface:
+            case J9BCinvokeinterface2:
+            case J9BCcheckcast:
+            case J9BCinstanceof: {
+                TR_IPBytecodeHashTableEntry *entry = profilingSample(method, bci.bcIndex(), comp, 0, /*addIt=*/false);
+                if (entry && !entry->isInvalid()) {
+                    if (TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph())
+                        gatherUncachedClassesUsedInCGEntry(cgEntry, comp, uncachedClasses, classInfos);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
 /**
  * @brief Code to be executed on the JITClient to serialize IP data of a method
  *
@@ -168,6 +168,8 @@ public:
     std::string serializeFaninMethodEntry(TR_OpaqueMethodBlock *omb);
     void gatherUncachedClassesUsedInCGEntry(TR_IPBCDataCallGraph *cgEntry, TR::Compilation *comp,
         std::vector<J9Class *> &uncachedClasses, std::vector<JITServerHelpers::ClassInfoTuple> &classInfos);
+    void gatherUncachedClassesUsedInMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp,
+        std::vector<J9Class *> &uncachedClasses, std::vector<JITServerHelpers::ClassInfoTuple> &classInfos);
 
 private:
     uint32_t walkILTreeForIProfilingEntries(uintptr_t *pcEntries, uint32_t &numEntries,
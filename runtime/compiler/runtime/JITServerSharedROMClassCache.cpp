@@ -70,6 +70,7 @@ struct JITServerSharedROMClassCache::Partition {
         , _monitor(monitor)
         , _map(decltype(_map)::allocator_type(persistentMemory->_persistentAllocator.get()))
         , _maxSize(0)
+        , _numBytes(0)
     {}
 
     ~Partition()
@@ -89,6 +90,7 @@ struct JITServerSharedROMClassCache::Partition {
     // the critical section, and key hashing and comparison are very quick.
     PersistentUnorderedMap<JITServerROMClassHash, Entry *> _map;
     size_t _maxSize;
+    volatile size_t _numBytes; // Total size of the ROMClasses in _map; updated with _monitor in hand
 };
 
 JITServerSharedROMClassCache::JITServerSharedROMClassCache(size_t numPartitions)
@@ -224,6 +226,17 @@ const JITServerROMClassHash &JITServerSharedROMClassCache::getHash(const J9ROMCl
     return *Entry::get(romClass)->_hash;
 }
 
+size_t JITServerSharedROMClassCache::getNumBytes() const
+{
+    if (!isInitialized())
+        return 0;
+
+    size_t numBytes = 0;
+    for (size_t i = 0; i < _numPartitions; ++i)
+        numBytes += _partitions[i]._numBytes;
+    return numBytes;
+}
+
 void JITServerSharedROMClassCache::printContent() const
 {
     fprintf(stderr, "Print SharedROMClassCache content:\n");
@@ -275,6 +288,7 @@ J9ROMClass *JITServerSharedROMClassCache::Partition::getOrCreate(const J9ROMClas
         if (it.second) {
             entry->_hash = &it.first->first;
             _maxSize = std::max(_maxSize, _map.size());
+            _numBytes += romClass->romSize;
         } else {
             // Another thread already created this entry; reuse it
             romClass = it.first->second->acquire();
@@ -306,6 +320,7 @@ void JITServerSharedROMClassCache::Partition::release(JITServerSharedROMClassCac
         TR_ASSERT(it != _map.end(), "Entry to be removed not found");
         TR_ASSERT(it->second == entry, "Duplicate entry");
         _map.erase(it);
+        _numBytes -= ((J9ROMClass *)entry->_data)->romSize;
     }
 
     _persistentMemory->freePersistentMemory(entry);
@@ -53,6 +53,10 @@ public:
 
     bool isInitialized() const { return _persistentMemory != NULL; }
 
+    // Total size of the cached ROMClasses. The partition counters are read without
+    // acquiring their monitors, so the result may be slightly stale; only meant for statistics.
+    size_t getNumBytes() const;
+
     // Print cache content for debugging purposes (ROMMethods pointers, names and hashes)
     void printContent() const;
 
@@ -27,7 +27,7 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h> /* for TCP_NODELAY option */
 #include <openssl/err.h>
-#include <poll.h>
+#include <sys/epoll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -38,6 +38,7 @@
 #include "env/TRMemory.hpp"
 #include "env/VMJ9.h"
 #include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
 #include "net/CommunicationStream.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/ServerStream.hpp"
@@ -167,14 +168,100 @@ static int openCommunicationSocket(uint32_t port, uint32_t &boundPort)
     return sockfd;
 }
 
+// Values of epoll_event.data.ptr that identify the two listening sockets in the epoll set.
+// Any other value is a pointer to an idle ServerStream added by parkIdleConnection().
+static char compilationSocketTag;
+static char healthSocketTag;
+
+static bool addToEpollSet(int epollfd, int fd, uint32_t events, void *tag)
+{
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = events;
+    event.data.ptr = tag;
+    return epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
 TR_Listener::TR_Listener()
     : _listenerThread(NULL)
     , _listenerMonitor(NULL)
     , _listenerOSThread(NULL)
     , _listenerThreadAttachAttempted(false)
     , _listenerThreadExitFlag(false)
+    , _parkedConnectionsMonitor(NULL)
+    , _epollfd(-1)
+    , _parkedStreams(PersistentUnorderedSet<JITServer::ServerStream *>::allocator_type(TR::Compiler->persistentAllocator()))
+    , _numParkedConnections(0)
+    , _numParkedConnectionsClosedAtShutdown(0)
+    , _useConnectionReactor(feGetEnv("TR_DisableJITServerConnectionReactor") == NULL)
 {}
 
+bool TR_Listener::parkIdleConnection(JITServer::ServerStream *stream)
+{
+    if (!_useConnectionReactor || !_parkedConnectionsMonitor || stream->hasPendingSSLData())
+        return false;
+
+    OMR::CriticalSection parkingConnection(_parkedConnectionsMonitor);
+    // The listener thread sets _epollfd to -1 under the monitor before closing the epoll instance
+    if ((_epollfd < 0) || getListenerThreadExitFlag())
+        return false;
+
+    // Record the stream before it becomes visible to the listener thread.
+    // EPOLLONESHOT guarantees that the stream is handed to the listener thread only once;
+    // the listener removes it from the epoll set before passing it to the compilation handler.
+    _parkedStreams.insert(stream);
+    if (!addToEpollSet(_epollfd, stream->getConnectionFD(), EPOLLIN | EPOLLRDHUP | EPOLLONESHOT, stream)) {
+        _parkedStreams.erase(stream);
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Cannot park idle connection for stream %p: errno=%d: %s",
+                stream, errno, strerror(errno));
+        return false;
+    }
+    _numParkedConnections++;
+    return true;
+}
+
+bool TR_Listener::unparkConnection(JITServer::ServerStream *stream)
+{
+    OMR::CriticalSection unparkingConnection(_parkedConnectionsMonitor);
+    if (_parkedStreams.erase(stream) == 0)
+        return false;
+    epoll_ctl(_epollfd, EPOLL_CTL_DEL, stream->getConnectionFD(), NULL);
+    _numParkedConnections--;
+    return true;
+}
+
+bool TR_Listener::rearmParkedConnection(JITServer::ServerStream *stream)
+{
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    event.data.ptr = stream;
+    return epoll_ctl(_epollfd, EPOLL_CTL_MOD, stream->getConnectionFD(), &event) == 0;
+}
+
+void TR_Listener::closeParkedConnections(int epollfd)
+{
+    if (_parkedConnectionsMonitor) {
+        OMR::CriticalSection closingConnections(_parkedConnectionsMonitor);
+        // No compilation thread can park a connection once _epollfd is -1
+        _epollfd = -1;
+        for (auto it = _parkedStreams.begin(); it != _parkedStreams.end(); ++it) {
+            JITServer::ServerStream *stream = *it;
+            // The destructor closes the socket, which tells the client that the server went away
+            stream->~ServerStream();
+            TR::Compiler->persistentGlobalAllocator().deallocate(stream);
+        }
+        _numParkedConnectionsClosedAtShutdown = _parkedStreams.size();
+        _parkedStreams.clear();
+        _numParkedConnections = 0;
+    }
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Closed %" OMR_PRIuPTR " parked connections at shutdown",
+            _numParkedConnectionsClosedAtShutdown);
+    close(epollfd);
+}
+
 void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
 {
     TR::CompilationInfo *compInfo = getCompilationInfo(jitConfig);
@@ -224,14 +311,26 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
         }
     }
 
-    // The following array accomodates two descriptors: healthSockfd and sockfd.
-    // The first one is used for readiness/liveness probes, the second one is used for compilation requests.
-    // If we don't want to use readiness/liveness probes, healthSockfd will be -1 and will be ignored by poll().
-    struct pollfd pfd[2] = {
-        { .fd = healthSockfd, .events = POLLIN, .revents = 0 },
-        {       .fd = sockfd, .events = POLLIN, .revents = 0 }
-    };
-    static const size_t numFds = sizeof(pfd) / sizeof(pfd[0]);
+    // The epoll set contains healthSockfd and sockfd, as well as all the connections that are waiting
+    // for the next request from their client. healthSockfd is used for readiness/liveness probes,
+    // sockfd is used for compilation requests. If we don't want to use readiness/liveness probes,
+    // healthSockfd will be -1 and will not be added to the epoll set.
+    int epollfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollfd < 0) {
+        perror("can't create epoll instance");
+        exit(1);
+    }
+    if (!addToEpollSet(epollfd, sockfd, EPOLLIN, &compilationSocketTag)
+        || ((healthSockfd >= 0) && !addToEpollSet(epollfd, healthSockfd, EPOLLIN, &healthSocketTag))) {
+        perror("can't add listening socket to the epoll set");
+        exit(1);
+    }
+    if (_parkedConnectionsMonitor) {
+        OMR::CriticalSection publishingEpollSet(_parkedConnectionsMonitor);
+        _epollfd = epollfd;
+    }
+
+    struct epoll_event events[OPENJ9_LISTENER_MAX_EVENTS];
 
     while (!getListenerThreadExitFlag()) {
         int32_t rc = 0;
@@ -239,11 +338,11 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
         socklen_t clilen = sizeof(cli_addr);
         int connfd = -1;
 
-        rc = poll(pfd, numFds, OPENJ9_LISTENER_POLL_TIMEOUT);
-        if (getListenerThreadExitFlag()) // if we are exiting, no need to check poll() status
+        rc = epoll_wait(epollfd, events, OPENJ9_LISTENER_MAX_EVENTS, OPENJ9_LISTENER_POLL_TIMEOUT);
+        if (getListenerThreadExitFlag()) // if we are exiting, no need to check epoll_wait() status
         {
             break;
-        } else if (0 == rc) // poll() timed out and no fd is ready
+        } else if (0 == rc) // epoll_wait() timed out and no fd is ready
         {
             continue;
         } else if (rc < 0) {
@@ -254,19 +353,32 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
                 exit(1);
             }
         }
-        // Check which file descriptor is ready
-        for (size_t fdIndex = 0; fdIndex < numFds; fdIndex++) {
-            if (pfd[fdIndex].revents == 0) // No event on this file descriptor
+        // Check which file descriptors are ready
+        for (int32_t eventIndex = 0; eventIndex < rc; eventIndex++) {
+            void *tag = events[eventIndex].data.ptr;
+            if ((tag != &compilationSocketTag) && (tag != &healthSocketTag)) {
+                // An idle connection received data or was closed by the client.
+                // Buffer what has arrived, so that the compilation thread never blocks
+                // reading the rest of a request sent in several parts.
+                JITServer::ServerStream *stream = (JITServer::ServerStream *)tag;
+                if (!stream->readPendingRequest() && rearmParkedConnection(stream))
+                    continue;
+                // The one-shot registration is now disarmed; take the socket out of the
+                // epoll set so that the stream can be parked again after the compilation.
+                if (unparkConnection(stream))
+                    compiler->compile(stream);
                 continue;
-            // We have an event and that event can only be POLLIN
-            TR_ASSERT_FATAL(pfd[fdIndex].revents == POLLIN,
-                "Unexpected event occurred during poll for new connection: socketIndex=%zu revents=%d\n", fdIndex,
-                pfd[fdIndex].revents);
+            }
+
+            bool isHealthSocket = (tag == &healthSocketTag);
+            // We have an event on a listening socket and that event can only be EPOLLIN
+            TR_ASSERT_FATAL(events[eventIndex].events == EPOLLIN,
+                "Unexpected event occurred during poll for new connection: healthSocket=%d events=%u\n",
+                isHealthSocket, events[eventIndex].events);
 
             // At this stage we should have a valid request for a new connection
-            pfd[fdIndex].revents = 0; // Reset the event for the next poll operation
             do {
-                connfd = accept(pfd[fdIndex].fd, (struct sockaddr *)&cli_addr, &clilen);
+                connfd = accept(isHealthSocket ? healthSockfd : sockfd, (struct sockaddr *)&cli_addr, &clilen);
                 if (connfd < 0) {
                     if ((EAGAIN != errno) && (EWOULDBLOCK != errno)) {
                         if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
@@ -276,7 +388,7 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
                     }
                 } else // accept() succeeded
                 {
-                    if (fdIndex == 0) // readiness/liveness probe socket
+                    if (isHealthSocket) // readiness/liveness probe socket
                     {
                         close(connfd);
                         connfd = -1;
@@ -300,7 +412,10 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
 
                         JITServer::ServerStream *stream
                             = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
-                        compiler->compile(stream);
+                        // Wait for the first request of the client in the epoll set, unless
+                        // the stream must be handed to a compilation thread right away
+                        if (!parkIdleConnection(stream))
+                            compiler->compile(stream);
                     }
                 }
             } while ((connfd >= 0) && !getListenerThreadExitFlag());
@@ -308,6 +423,8 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
     } //  while (!getListenerThreadExitFlag())
 
     // The following piece of code will be executed only if the server shuts down properly
+    // Connections still parked in the epoll set have no request in progress, so they can be closed
+    closeParkedConnections(epollfd);
     close(sockfd);
     if (sslCtx) {
         (*OSSL_CTX_free)(sslCtx);
@@ -403,6 +520,10 @@ void TR_Listener::startListenerThread(J9JavaVM *javaVM)
     priority = J9THREAD_PRIORITY_NORMAL;
 
     _listenerMonitor = TR::Monitor::create("JITServer-ListenerMonitor");
+    if (_useConnectionReactor) {
+        // Never destroyed: compilation threads may try to park connections until they are stopped
+        _parkedConnectionsMonitor = TR::Monitor::create("JITServer-ParkedConnectionsMonitor");
+    }
     if (_listenerMonitor) {
         // create the thread for listening to a Client compilation request
         const UDATA defaultOSStackSize = javaVM->defaultOSStackSize; // 256KB stack size
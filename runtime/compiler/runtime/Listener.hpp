@@ -24,6 +24,7 @@
 #define LISTENER_HPP
 
 #include "j9.h"
+#include "env/PersistentCollections.hpp"
 #include "infra/Monitor.hpp" // TR::Monitor
 #include "net/ServerStream.hpp"
 
@@ -35,9 +36,14 @@
    Typical sequence executed by a JITServer is:
    (1) Create a TR_Listener object with "allocate()" function
    (2) Start a listener thread with  listener->startListenerThread(javaVM);
+
+   Besides the listening sockets, the listener thread also monitors idle client connections
+   (see parkIdleConnection()), so that compilation threads do not sit blocked in read()
+   waiting for the next compilation request of a mostly idle client.
 */
 
 #define OPENJ9_LISTENER_POLL_TIMEOUT 100 // in milliseconds
+#define OPENJ9_LISTENER_MAX_EVENTS 64 // max number of events retrieved by one epoll_wait() call
 
 class BaseCompileDispatcher;
 
@@ -51,12 +57,15 @@ public:
        @brief Function called to deal with incoming connection requests
 
        This function opens a socket (non-blocking), binds it and then waits for incoming
-       connection by polling on it with a timeout (see OPENJ9_LISTENER_POLL_TIMEOUT).
+       connection by polling on it with epoll and a timeout (see OPENJ9_LISTENER_POLL_TIMEOUT).
        If it ever comes out of polling (due to timeout or a new connection request),
        it checks the exit flag. If the flag is set, then the thread exits.
        Otherwise, it establishes the connection using accept().
        Once a connection is accepted a ServerStream object is created (receiving the newly
-       opened socket descriptor as a parameter) and passed to the compilation handler.
+       opened socket descriptor as a parameter) and parked in the epoll set until the client
+       sends its first request. When a parked connection becomes readable, the listener reads
+       what has arrived without blocking; once the whole request is buffered, the stream is taken
+       out of the epoll set and passed to the compilation handler.
        Typically, the compilation handler places the ServerStream object in a queue and
        returns immediately so that other connection requests can be accepted.
        Note: it must be executed on a separate thread as it needs to keep listening for new connections.
@@ -66,6 +75,23 @@ public:
     void serveRemoteCompilationRequests(BaseCompileDispatcher *compiler);
     int32_t waitForListenerThreadExit(J9JavaVM *javaVM);
 
+    /**
+       @brief Hand an idle connection over to the listener thread
+
+       The socket of the stream is added to the epoll set of the listener (one-shot), and the
+       stream is passed to the compilation handler only when the whole next request of the client
+       has been received, or the connection is closed. Can be called from any thread.
+
+       @param [in] stream The stream of a connection that has no request in progress
+       @return true if the stream was parked, false if the caller must queue the stream itself
+               (connection reactor disabled, listener not running, or SSL data already buffered)
+    */
+    bool parkIdleConnection(JITServer::ServerStream *stream);
+
+    uintptr_t getNumParkedConnections() const { return _numParkedConnections; }
+
+    uintptr_t getNumParkedConnectionsClosedAtShutdown() const { return _numParkedConnectionsClosedAtShutdown; }
+
     void setAttachAttempted(bool b) { _listenerThreadAttachAttempted = b; }
 
     bool getAttachAttempted() const { return _listenerThreadAttachAttempted; }
@@ -83,11 +109,36 @@ public:
     void setListenerThreadExitFlag() { _listenerThreadExitFlag = true; }
 
 private:
+    /**
+       @brief Take a stream that became readable out of the epoll set
+       @return true if the stream was parked and must now be passed to the compilation handler
+    */
+    bool unparkConnection(JITServer::ServerStream *stream);
+
+    /**
+       @brief Wait again in the epoll set for the rest of the request of a parked stream
+       @return true if the stream is still parked
+    */
+    bool rearmParkedConnection(JITServer::ServerStream *stream);
+
+    /**
+       @brief Close the epoll set and destroy the streams still parked in it; called by the listener thread on exit
+    */
+    void closeParkedConnections(int epollfd);
+
     J9VMThread *_listenerThread;
     TR::Monitor *_listenerMonitor;
     j9thread_t _listenerOSThread;
     volatile bool _listenerThreadAttachAttempted;
     volatile bool _listenerThreadExitFlag;
+    // Protects _epollfd and _parkedStreams, so that compilation threads never add a connection to
+    // the epoll set while the listener thread is closing it at shutdown
+    TR::Monitor *_parkedConnectionsMonitor;
+    int _epollfd; // epoll instance monitoring the listening sockets and the idle connections
+    PersistentUnorderedSet<JITServer::ServerStream *> _parkedStreams; // streams currently in the epoll set
+    uintptr_t _numParkedConnections;
+    uintptr_t _numParkedConnectionsClosedAtShutdown;
+    bool _useConnectionReactor; // whether idle connections are parked in the epoll set
 };
 
 /**
@@ -33,6 +33,8 @@
 #include <stdlib.h>
 #include <unistd.h> // read, write
 
+#include "AtomicSupport.hpp"
+#include "compile/Compilation.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp"
 #include "env/TRMemory.hpp"
@@ -40,6 +42,8 @@
 #include "env/VerboseLog.hpp"
 #include "env/VMJ9.h"
 #include "net/ServerStream.hpp"
+#include "runtime/JITServerAOTCache.hpp"
+#include "runtime/JITServerSharedROMClassCache.hpp"
 #include "runtime/MetricsServer.hpp"
 
 bool MetricsServer::useSSL(TR::CompilationInfo *compInfo)
@@ -132,6 +136,169 @@ double ActiveThreadsMetric::computeValue(TR::CompilationInfo *compInfo)
     return getValue();
 }
 
+// Bucket upper bounds of the compilation histograms; times are in usec
+static const uint64_t compilationTimeBounds[] = { 1000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000,
+    2500000, 5000000, 10000000 };
+static const uint64_t queueTimeBounds[] = { 100, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000,
+    10000000 };
+static const uint64_t messagesPerCompilationBounds[] = { 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+#define HISTOGRAM_BOUNDS(bounds) bounds, sizeof(bounds) / sizeof(bounds[0])
+
+PrometheusHistogram CompilationMetrics::_compilationTime[] = {
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // noOpt
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // cold
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // warm
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // hot
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // veryHot
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // scorching
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // reducedWarm
+    PrometheusHistogram(HISTOGRAM_BOUNDS(compilationTimeBounds)), // unknownHotness
+};
+PrometheusHistogram CompilationMetrics::_queueTime(HISTOGRAM_BOUNDS(queueTimeBounds));
+PrometheusHistogram CompilationMetrics::_messagesPerCompilation(HISTOGRAM_BOUNDS(messagesPerCompilationBounds));
+volatile uintptr_t CompilationMetrics::_bytesReceived = 0;
+volatile uintptr_t CompilationMetrics::_bytesSent = 0;
+
+PrometheusHistogram::PrometheusHistogram(const uint64_t *upperBounds, size_t numBuckets)
+    : _upperBounds(upperBounds)
+    , _numBuckets(numBuckets)
+    , _sum(0)
+{
+    TR_ASSERT_FATAL(numBuckets <= MAX_BUCKETS, "Too many histogram buckets: %zu", numBuckets);
+    for (size_t i = 0; i <= MAX_BUCKETS; ++i)
+        _bucketCounts[i] = 0;
+}
+
+void PrometheusHistogram::observe(uint64_t value)
+{
+    // The number of buckets is small, so a linear search is as fast as a binary one
+    size_t i = 0;
+    while ((i < _numBuckets) && (value > _upperBounds[i]))
+        ++i;
+    VM_AtomicSupport::add(&_bucketCounts[i], 1);
+    VM_AtomicSupport::add(&_sum, (uintptr_t)value);
+}
+
+std::string PrometheusHistogram::serialize(const std::string &name, const std::string &labels, double scale) const
+{
+    std::string separator = labels.empty() ? "" : ",";
+    std::string output;
+    uint64_t count = 0;
+    char bound[32];
+    for (size_t i = 0; i < _numBuckets; ++i) {
+        count += _bucketCounts[i];
+        snprintf(bound, sizeof(bound), "%g", _upperBounds[i] * scale);
+        output += name + "_bucket{" + labels + separator + "le=\"" + bound + "\"} " + std::to_string(count) + "\n";
+    }
+    // The +Inf bucket must be equal to the _count series, so derive the latter from the buckets
+    count += _bucketCounts[_numBuckets];
+    output += name + "_bucket{" + labels + separator + "le=\"+Inf\"} " + std::to_string(count) + "\n";
+
+    std::string series = labels.empty() ? "" : "{" + labels + "}";
+    output += name + "_sum" + series + " " + std::to_string(_sum * scale) + "\n";
+    output += name + "_count" + series + " " + std::to_string(count) + "\n";
+    return output;
+}
+
+bool CompilationMetrics::isEnabled(TR::CompilationInfo *compInfo)
+{
+    return compInfo->getPersistentInfo()->getJITServerMetricsPort() != 0;
+}
+
+void CompilationMetrics::recordCompilation(TR_Hotness optLevel, uint64_t compTimeUs, uint64_t numMessages,
+    uint64_t bytesReceived, uint64_t bytesSent)
+{
+    static_assert(sizeof(_compilationTime) / sizeof(_compilationTime[0]) == numHotnessLevels,
+        "Need one compilation time histogram for each optimization level");
+    if (optLevel < numHotnessLevels)
+        _compilationTime[optLevel].observe(compTimeUs);
+    _messagesPerCompilation.observe(numMessages);
+    VM_AtomicSupport::add(&_bytesReceived, (uintptr_t)bytesReceived);
+    VM_AtomicSupport::add(&_bytesSent, (uintptr_t)bytesSent);
+}
+
+std::string CompilationTimeMetric::serialize()
+{
+    std::string output = serializeHeader("histogram");
+    for (int i = 0; i < numHotnessLevels; i++) {
+        std::string labels = std::string("opt_level=\"") + TR::Compilation::getHotnessName((TR_Hotness)i) + "\"";
+        output += CompilationMetrics::getCompilationTime((TR_Hotness)i).serialize(getName(), labels, 1e-6);
+    }
+    return output;
+}
+
+std::string QueueTimeMetric::serialize()
+{
+    return serializeHeader("histogram") + CompilationMetrics::getQueueTime().serialize(getName(), "", 1e-6);
+}
+
+std::string MessagesPerCompilationMetric::serialize()
+{
+    return serializeHeader("histogram") + CompilationMetrics::getMessagesPerCompilation().serialize(getName(), "", 1);
+}
+
+double BytesReceivedMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue(CompilationMetrics::getBytesReceived());
+    return getValue();
+}
+
+std::string BytesReceivedMetric::serialize()
+{
+    return serializeHeader("counter") + getName() + " " + std::to_string(CompilationMetrics::getBytesReceived())
+        + "\n";
+}
+
+double BytesSentMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue(CompilationMetrics::getBytesSent());
+    return getValue();
+}
+
+std::string BytesSentMetric::serialize()
+{
+    return serializeHeader("counter") + getName() + " " + std::to_string(CompilationMetrics::getBytesSent()) + "\n";
+}
+
+// Escape the characters that are not allowed verbatim in a Prometheus label value
+static std::string escapeLabelValue(const std::string &value)
+{
+    std::string escaped;
+    for (char c : value) {
+        if (c == '\\' || c == '"')
+            escaped += '\\';
+        if (c == '\n')
+            escaped += "\\n";
+        else
+            escaped += c;
+    }
+    return escaped;
+}
+
+double AOTCacheLookupsMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    _serializedValue = serializeHeader("counter");
+    size_t numLookups = 0;
+    if (auto aotCacheMap = compInfo->getJITServerAOTCacheMap()) {
+        aotCacheMap->forEachCache([&](const JITServerAOTCache &cache) {
+            std::string cacheLabel = getName() + "{cache=\"" + escapeLabelValue(cache.name()) + "\",result=";
+            _serializedValue += cacheLabel + "\"hit\"} " + std::to_string(cache.getNumCacheHits()) + "\n";
+            _serializedValue += cacheLabel + "\"miss\"} " + std::to_string(cache.getNumCacheMisses()) + "\n";
+            numLookups += cache.getNumCacheHits() + cache.getNumCacheMisses();
+        });
+    }
+    setValue(numLookups);
+    return getValue();
+}
+
+double SharedROMClassCacheSizeMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    auto sharedROMClassCache = compInfo->getJITServerSharedROMClassCache();
+    setValue(sharedROMClassCache ? sharedROMClassCache->getNumBytes() : 0);
+    return getValue();
+}
+
 MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
     : _compInfo(compInfo)
 {
@@ -139,7 +306,14 @@ MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
     _metrics[1] = new (PERSISTENT_NEW) AvailableMemoryMetric();
     _metrics[2] = new (PERSISTENT_NEW) ConnectedClientsMetric();
     _metrics[3] = new (PERSISTENT_NEW) ActiveThreadsMetric();
-    static_assert(3 == MAX_METRICS - 1, "Unsupported number of metrics");
+    _metrics[4] = new (PERSISTENT_NEW) CompilationTimeMetric();
+    _metrics[5] = new (PERSISTENT_NEW) QueueTimeMetric();
+    _metrics[6] = new (PERSISTENT_NEW) MessagesPerCompilationMetric();
+    _metrics[7] = new (PERSISTENT_NEW) BytesReceivedMetric();
+    _metrics[8] = new (PERSISTENT_NEW) BytesSentMetric();
+    _metrics[9] = new (PERSISTENT_NEW) AOTCacheLookupsMetric();
+    _metrics[10] = new (PERSISTENT_NEW) SharedROMClassCacheSizeMetric();
+    static_assert(10 == MAX_METRICS - 1, "Unsupported number of metrics");
 }
 
 MetricsDatabase::~MetricsDatabase()
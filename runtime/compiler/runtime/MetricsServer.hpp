@@ -26,6 +26,7 @@
 #include <poll.h> // for struct pollfd
 #include <string>
 #include "j9.h" // for J9JavaVM
+#include "compile/CompilationTypes.hpp" // for TR_Hotness
 #include "infra/Monitor.hpp" // for TR::Monitor
 
 namespace TR {
@@ -45,6 +46,7 @@ public:
     PrometheusMetric(const std::string &name, const std::string &help)
         : _name(name)
         , _help(help)
+        , _value(0)
     {}
 
     virtual ~PrometheusMetric() {}
@@ -68,13 +70,17 @@ public:
        @brief Build a std::string that encodes the value of the metric in a format understood by Prometheus
        @return Serialized value of the metric (as a std::string)
     */
-    std::string serialize()
+    virtual std::string serialize()
     {
-        return "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " gauge\n" + getName() + " "
-            + std::to_string(getValue()) + "\n";
+        return serializeHeader("gauge") + getName() + " " + std::to_string(getValue()) + "\n";
     }
 
 protected:
+    std::string serializeHeader(const char *type) const
+    {
+        return "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " " + type + "\n";
+    }
+
     const std::string _name;
     const std::string _help;
     double _value;
@@ -129,18 +135,203 @@ public:
     virtual double computeValue(TR::CompilationInfo *compInfo);
 }; // class ActiveThreadsMetric
 
+/**
+   @class PrometheusHistogram
+   @brief Fixed-bucket histogram that can be updated by compilation threads without acquiring any lock
+
+   An observation only increments the (non-cumulative) counter of the bucket it falls into and the running
+   sum, using atomic adds. The cumulative bucket counts required by Prometheus are computed only when the
+   histogram is serialized, i.e. when "/metrics" is scraped. Values are recorded as integers (e.g. usec)
+   and are multiplied by a scale factor (e.g. 1e-6 to report seconds) at serialization time.
+   The counters are read without synchronization when serializing; a scrape that races with an
+   observation may see it in the bucket counts but not yet in the sum, which is acceptable for monitoring.
+ */
+class PrometheusHistogram {
+public:
+    static const size_t MAX_BUCKETS = 16; // Maximum number of finite upper bounds
+
+    PrometheusHistogram(const uint64_t *upperBounds, size_t numBuckets);
+
+    /**
+       @brief Record one observation; lock-free and safe to call from any thread
+    */
+    void observe(uint64_t value);
+
+    /**
+       @brief Build the _bucket, _sum and _count series of this histogram
+       @param name Name of the metric this histogram belongs to
+       @param labels Comma separated labels (e.g. opt_level="warm") identifying the series; may be empty
+       @param scale Factor applied to the bucket bounds and to the sum
+    */
+    std::string serialize(const std::string &name, const std::string &labels, double scale) const;
+
+private:
+    const uint64_t * const _upperBounds; // Ascending upper bounds of the finite buckets
+    const size_t _numBuckets;
+    volatile uintptr_t _bucketCounts[MAX_BUCKETS + 1]; // Last entry is the +Inf bucket
+    volatile uintptr_t _sum;
+}; // class PrometheusHistogram
+
+/**
+   @class CompilationMetrics
+   @brief Statistics about the compilations performed by this JITServer, exposed through the MetricsServer
+
+   The statistics are updated by the compilation threads at the end of each compilation request,
+   only when the MetricsServer is enabled. Updates use atomic operations exclusively, so that
+   compilation threads never contend on a lock because of the metrics.
+ */
+class CompilationMetrics {
+public:
+    static bool isEnabled(TR::CompilationInfo *compInfo);
+
+    /**
+       @brief Record the time a compilation request waited in the queue before being picked up by a thread
+    */
+    static void recordQueueTime(uint64_t queueTimeUs) { _queueTime.observe(queueTimeUs); }
+
+    /**
+       @brief Record the statistics of one compilation request once its response has been sent to the client
+
+       @param optLevel Optimization level of the compilation
+       @param compTimeUs Time spent compiling (or serving the method from the AOT cache), in usec
+       @param numMessages Number of messages received from the client while serving the request
+       @param bytesReceived Number of bytes received from the client while serving the request
+       @param bytesSent Number of bytes sent to the client while serving the request
+     */
+    static void recordCompilation(TR_Hotness optLevel, uint64_t compTimeUs, uint64_t numMessages,
+        uint64_t bytesReceived, uint64_t bytesSent);
+
+    static const PrometheusHistogram &getCompilationTime(TR_Hotness optLevel) { return _compilationTime[optLevel]; }
+
+    static const PrometheusHistogram &getQueueTime() { return _queueTime; }
+
+    static const PrometheusHistogram &getMessagesPerCompilation() { return _messagesPerCompilation; }
+
+    static uint64_t getBytesReceived() { return _bytesReceived; }
+
+    static uint64_t getBytesSent() { return _bytesSent; }
+
+private:
+    static PrometheusHistogram _compilationTime[numHotnessLevels];
+    static PrometheusHistogram _queueTime;
+    static PrometheusHistogram _messagesPerCompilation;
+    static volatile uintptr_t _bytesReceived;
+    static volatile uintptr_t _bytesSent;
+}; // class CompilationMetrics
+
+/**
+   @brief Class used to serialize the histogram of compilation times for each optimization level
+ */
+class CompilationTimeMetric : public PrometheusMetric {
+public:
+    CompilationTimeMetric()
+        : PrometheusMetric("jitserver_compilation_duration_seconds", "Duration of compilations per optimization level")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo) { return getValue(); }
+
+    virtual std::string serialize();
+}; // class CompilationTimeMetric
+
+/**
+   @brief Class used to serialize the histogram of times spent by compilation requests in the queue
+ */
+class QueueTimeMetric : public PrometheusMetric {
+public:
+    QueueTimeMetric()
+        : PrometheusMetric("jitserver_queue_wait_seconds", "Time spent by compilation requests in the queue")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo) { return getValue(); }
+
+    virtual std::string serialize();
+}; // class QueueTimeMetric
+
+/**
+   @brief Class used to serialize the histogram of client round-trips needed by each compilation
+ */
+class MessagesPerCompilationMetric : public PrometheusMetric {
+public:
+    MessagesPerCompilationMetric()
+        : PrometheusMetric("jitserver_messages_per_compilation",
+              "Number of messages received from the client per compilation")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo) { return getValue(); }
+
+    virtual std::string serialize();
+}; // class MessagesPerCompilationMetric
+
+/**
+   @brief Class used to serialize the number of bytes received from clients during compilations
+ */
+class BytesReceivedMetric : public PrometheusMetric {
+public:
+    BytesReceivedMetric()
+        : PrometheusMetric("jitserver_received_bytes_total", "Bytes received from clients during compilations")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+
+    virtual std::string serialize();
+}; // class BytesReceivedMetric
+
+/**
+   @brief Class used to serialize the number of bytes sent to clients during compilations
+ */
+class BytesSentMetric : public PrometheusMetric {
+public:
+    BytesSentMetric()
+        : PrometheusMetric("jitserver_sent_bytes_total", "Bytes sent to clients during compilations")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+
+    virtual std::string serialize();
+}; // class BytesSentMetric
+
+/**
+   @brief Class used to serialize the number of hits and misses of each named AOT cache
+ */
+class AOTCacheLookupsMetric : public PrometheusMetric {
+public:
+    AOTCacheLookupsMetric()
+        : PrometheusMetric("jitserver_aot_cache_lookups_total", "Method lookups in the JITServer AOT caches")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+
+    virtual std::string serialize() { return _serializedValue; }
+
+private:
+    std::string _serializedValue; // Series for all the caches, built by computeValue()
+}; // class AOTCacheLookupsMetric
+
+/**
+   @brief Class used to serialize the size of the ROMClass cache shared between clients
+ */
+class SharedROMClassCacheSizeMetric : public PrometheusMetric {
+public:
+    SharedROMClassCacheSizeMetric()
+        : PrometheusMetric("jitserver_shared_romclass_cache_bytes", "Size of the ROMClass cache shared by clients")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class SharedROMClassCacheSizeMetric
+
 /**
    @class MetricsDatabase
    @brief Collection of metrics that need to be sent to Prometheus on demand
 
    In order to add a new metric, derive a new class from PrometheusMetric and implement its
-   computeValue() method. Increment the MAX_METRICS constant accordingly. Change the constructor
+   computeValue() method, as well as serialize() if the metric is not a single gauge.
+   Increment the MAX_METRICS constant accordingly. Change the constructor
    of this class to dynamically allocate an instance of the new metric and store a pointer
    of this metric instance into the _metrics array
  */
 class MetricsDatabase {
 public:
-    static const size_t MAX_METRICS = 4; // Maximum number of metrics our database can hold
+    static const size_t MAX_METRICS = 11; // Maximum number of metrics our database can hold
     MetricsDatabase(TR::CompilationInfo *compInfo);
     ~MetricsDatabase();
 
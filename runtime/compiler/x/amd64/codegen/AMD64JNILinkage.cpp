@@ -48,10 +48,12 @@
 #include "infra/Assert.hpp"
 #include "env/VMJ9.h"
 #include "runtime/Runtime.hpp"
+#include "x/amd64/runtime/AMD64CRC32.hpp"
 #include "x/codegen/CheckFailureSnippet.hpp"
 #include "x/codegen/HelperCallSnippet.hpp"
 #include "x/codegen/X86Instruction.hpp"
 #include "x/codegen/J9LinkageUtils.hpp"
+#include "x/codegen/OutlinedInstructions.hpp"
 
 TR::Register *J9::X86::AMD64::JNILinkage::processJNIReferenceArg(TR::Node *child)
 {
@@ -656,8 +658,49 @@ void J9::X86::AMD64::JNILinkage::buildOutgoingJNIArgsAndDependencies(TR::Node *c
     buildJNIMergeLabelDependencies(callNode, killNonVolatileGPRs);
 }
 
+/**
+ * @brief Returns the address of an accelerated replacement for a java/util/zip/CRC32 native,
+ *        or 0 if the JNI method itself must be called.
+ *
+ * The replacements read the byte array directly, so they require contiguous on-heap arrays.
+ * Their addresses are only valid in this process, so they cannot be used for AOT or
+ * out-of-process compilations.
+ */
+static uintptr_t getCRC32ReplacementAddress(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymbol)
+{
+    static const bool disableCRC32 = feGetEnv("TR_x86DisableCRC32") != NULL;
+    if (disableCRC32 || !comp->target().cpu.supportsFeature(OMR_FEATURE_X86_PCLMULQDQ)
+        || !comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_1) || comp->compileRelocatableCode()
+        || TR::Compiler->om.canGenerateArraylets() || TR::Compiler->om.isOffHeapAllocationEnabled())
+        return 0;
+
+#ifdef J9VM_OPT_JITSERVER
+    if (comp->isOutOfProcessCompilation())
+        return 0;
+#endif
+
+    switch (methodSymbol->getRecognizedMethod()) {
+        case TR::java_util_zip_CRC32_update:
+            return (uintptr_t)crc32UpdateAMD64;
+#if JAVA_SPEC_VERSION >= 9
+        case TR::java_util_zip_CRC32_updateBytes0:
+#else
+        case TR::java_util_zip_CRC32_updateBytes:
+#endif
+            return (uintptr_t)crc32UpdateBytesAMD64;
+#if JAVA_SPEC_VERSION >= 9
+        case TR::java_util_zip_CRC32_updateByteBuffer0:
+#else
+        case TR::java_util_zip_CRC32_updateByteBuffer:
+#endif
+            return (uintptr_t)crc32UpdateByteBufferAMD64;
+        default:
+            return 0;
+    }
+}
+
 TR::Instruction *J9::X86::AMD64::JNILinkage::generateMethodDispatch(TR::Node *callNode, bool isJNIGCPoint,
-    uintptr_t targetAddress)
+    uintptr_t targetAddress, bool isJNICallSite)
 {
     TR::ResolvedMethodSymbol *callSymbol = callNode->getSymbol()->castToResolvedMethodSymbol();
     TR::RealRegister *espReal = machine()->getRealRegister(TR::RealRegister::esp);
@@ -696,12 +739,16 @@ TR::Instruction *J9::X86::AMD64::JNILinkage::generateMethodDispatch(TR::Node *ca
     TR_ASSERT(reloTypes[reloType] != TR_NoRelocation, "There shouldn't be direct JNI interface calls!");
 
     TR::X86RegInstruction *patchedInstr = generateRegImm64Instruction(TR::InstOpCode::MOV8RegImm64, callNode,
-        _JNIDispatchInfo.dispatchTrampolineRegister, targetAddress, cg(), reloTypes[reloType]);
+        _JNIDispatchInfo.dispatchTrampolineRegister, targetAddress, cg(),
+        isJNICallSite ? reloTypes[reloType] : TR_NoRelocation);
 
     TR::X86RegInstruction *instr = generateRegInstruction(TR::InstOpCode::CALLReg, callNode,
         _JNIDispatchInfo.dispatchTrampolineRegister, _JNIDispatchInfo.callPostDeps, cg());
-    cg()->getJNICallSites().push_front(new (trHeapMemory())
-            TR_Pair<TR_ResolvedMethod, TR::Instruction>(callSymbol->getResolvedMethod(), patchedInstr));
+
+    // Replacement targets must not be patched when the native method is (re)registered
+    if (isJNICallSite)
+        cg()->getJNICallSites().push_front(new (trHeapMemory())
+                TR_Pair<TR_ResolvedMethod, TR::Instruction>(callSymbol->getResolvedMethod(), patchedInstr));
 
     if (isJNIGCPoint)
         instr->setNeedsGCMap(_systemLinkage->getProperties().getPreservedRegisterMapForGC());
@@ -1181,9 +1228,12 @@ TR::Register *J9::X86::AMD64::JNILinkage::buildDirectJNIDispatch(TR::Node *callN
 
     populateJNIDispatchInfo();
 
+    // The CRC32 replacements run with VM access held and do not need a JNI frame
+    uintptr_t crc32ReplacementAddress = isGPUHelper ? 0 : getCRC32ReplacementAddress(comp(), resolvedMethodSymbol);
+
     static char *disablePureFn = feGetEnv("TR_DISABLE_PURE_FUNC_RECOGNITION");
     if (!isGPUHelper) {
-        if (resolvedMethodSymbol->canDirectNativeCall()) {
+        if (resolvedMethodSymbol->canDirectNativeCall() || crc32ReplacementAddress) {
             dropVMAccess = false;
             killNonVolatileGPRs = false;
             isJNIGCPoint = false;
@@ -1264,10 +1314,13 @@ TR::Register *J9::X86::AMD64::JNILinkage::buildDirectJNIDispatch(TR::Node *callN
         targetAddress = (uintptr_t)callSymbol->getMethodAddress();
     } else {
         TR::ResolvedMethodSymbol *callSymbol1 = callNode->getSymbol()->castToResolvedMethodSymbol();
-        targetAddress = (uintptr_t)callSymbol1->getResolvedMethod()->startAddressForJNIMethod(comp());
+        targetAddress = crc32ReplacementAddress
+            ? crc32ReplacementAddress
+            : (uintptr_t)callSymbol1->getResolvedMethod()->startAddressForJNIMethod(comp());
     }
 
-    TR::Instruction *callInstr = generateMethodDispatch(callNode, isJNIGCPoint, targetAddress);
+    TR::Instruction *callInstr
+        = generateMethodDispatch(callNode, isJNIGCPoint, targetAddress, crc32ReplacementAddress == 0);
 
     if (isGPUHelper)
         callNode->setSymbolReference(callSymRef); // change back to callSymRef afterwards
@@ -1363,4 +1416,332 @@ TR::Register *J9::X86::AMD64::JNILinkage::buildDirectJNIDispatch(TR::Node *callN
     return _JNIDispatchInfo.JNIReturnRegister;
 }
 
+
+#if JAVA_SPEC_VERSION >= 16
+// The children of a call to InternalDowncallHandler.invokeNative, counted back from the last one.
+// Child 0 is the receiver.
+//
+#if JAVA_SPEC_VERSION >= 24
+#define DOWNCALL_CHILD_COUNT 10
+#elif JAVA_SPEC_VERSION >= 22
+#define DOWNCALL_CHILD_COUNT 9
+#elif JAVA_SPEC_VERSION >= 21
+#define DOWNCALL_CHILD_COUNT 7
+#else
+#define DOWNCALL_CHILD_COUNT 5
+#endif
+#define DOWNCALL_ARG_VALUES_CHILD (DOWNCALL_CHILD_COUNT - 1)
+#define DOWNCALL_CIF_CHILD (DOWNCALL_CHILD_COUNT - 2)
+#define DOWNCALL_FUNCTION_CHILD (DOWNCALL_CHILD_COUNT - 3)
+#define DOWNCALL_RETURN_STRUCT_CHILD (DOWNCALL_CHILD_COUNT - 4)
+#define DOWNCALL_RETURN_STATE_CHILD (DOWNCALL_CHILD_COUNT - 5)
+#define DOWNCALL_CRITICAL_CHILD (DOWNCALL_CHILD_COUNT - 6)
+#define DOWNCALL_BASES_CHILD (DOWNCALL_CHILD_COUNT - 8)
+#define DOWNCALL_RETURN_STATE_BASE_CHILD (DOWNCALL_CHILD_COUNT - 9)
+#endif /* JAVA_SPEC_VERSION >= 16 */
+
+/**
+ * @brief Returns true if a call to InternalDowncallHandler.invokeNative can be dispatched
+ *        by buildDirectDowncallDispatch().
+ *
+ * The sequence reads the argument array directly, so it requires contiguous on-heap arrays.
+ * The address of invokeDowncallFromJIT() is only valid in this process, so it cannot be used
+ * for AOT or out-of-process compilations.
+ */
+bool J9::X86::AMD64::JNILinkage::canInlineDowncall(TR::Compilation *comp, TR::Node *callNode)
+{
+#if JAVA_SPEC_VERSION >= 16
+    static const bool disableInlineDowncall = feGetEnv("TR_DisableInlineDowncall") != NULL;
+    if (disableInlineDowncall || !comp->target().isLinux() || comp->compileRelocatableCode()
+        || TR::Compiler->om.canGenerateArraylets() || TR::Compiler->om.isOffHeapAllocationEnabled()
+        || (callNode->getNumChildren() != DOWNCALL_CHILD_COUNT))
+        return false;
+
+#ifdef J9VM_OPT_JITSERVER
+    if (comp->isOutOfProcessCompilation())
+        return false;
+#endif
+
+    return true;
+#else
+    return false;
+#endif /* JAVA_SPEC_VERSION >= 16 */
+}
+
+/**
+ * @brief Dispatches a call to InternalDowncallHandler.invokeNative without going through the interpreter.
+ *
+ * The downcalls that pass heap memory, use the critical linker option or capture the call state
+ * are left to the VM internal native in an outlined call. Otherwise the arguments are copied from
+ * the argument array onto the C stack while VM access is still held, VM access is released inline
+ * and invokeDowncallFromJIT() calls the native function directly or via ffi_call.
+ */
+TR::Register *J9::X86::AMD64::JNILinkage::buildDirectDowncallDispatch(TR::Node *callNode)
+{
+#if JAVA_SPEC_VERSION >= 16
+    TR::Register *vmThreadReg = cg()->getMethodMetaDataRegister();
+    TR::RealRegister *espReal = machine()->getRealRegister(TR::RealRegister::esp);
+    TR_J9VMBase *fej9 = (TR_J9VMBase *)(fe());
+
+    // One slot for each copied argument plus one to keep the C stack 16-aligned along with the VMThread pointer.
+    //
+    const int32_t argBufferSize = (J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT + 1) * TR::Compiler->om.sizeofReferenceAddress();
+    const int32_t arraySizeOffset = (int32_t)fej9->getOffsetOfContiguousArraySizeField();
+    const int32_t arrayHeaderSize = (int32_t)TR::Compiler->om.contiguousArrayHeaderSizeInBytes();
+
+    // The outlined call reuses the registers of the children, so evaluate all of them first.
+    //
+    TR::Register *childRegs[DOWNCALL_CHILD_COUNT];
+    for (int32_t i = 0; i < DOWNCALL_CHILD_COUNT; i++)
+        childRegs[i] = cg()->evaluate(callNode->getChild(i));
+
+    TR::Register *argValuesReg = childRegs[DOWNCALL_ARG_VALUES_CHILD];
+
+    populateJNIDispatchInfo();
+
+    TR::LabelSymbol *startLabel = generateLabelSymbol(cg());
+    TR::LabelSymbol *fallbackLabel = generateLabelSymbol(cg());
+    TR::LabelSymbol *restartLabel = generateLabelSymbol(cg());
+    TR::LabelSymbol *returnAddrLabel = generateLabelSymbol(cg());
+    startLabel->setStartInternalControlFlow();
+    restartLabel->setEndInternalControlFlow();
+
+    generateLabelInstruction(TR::InstOpCode::label, callNode, startLabel, cg());
+
+#if JAVA_SPEC_VERSION >= 21
+    TR::Register *criticalReg = childRegs[DOWNCALL_CRITICAL_CHILD];
+    generateRegRegInstruction(TR::InstOpCode::TEST4RegReg, callNode, criticalReg, criticalReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JNE4, callNode, fallbackLabel, cg());
+
+    TR::Register *returnStateReg = childRegs[DOWNCALL_RETURN_STATE_CHILD];
+    generateRegRegInstruction(TR::InstOpCode::TEST8RegReg, callNode, returnStateReg, returnStateReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JNE4, callNode, fallbackLabel, cg());
+#endif /* JAVA_SPEC_VERSION >= 21 */
+
+#if JAVA_SPEC_VERSION >= 24
+    TR::Register *returnStateBaseReg = childRegs[DOWNCALL_RETURN_STATE_BASE_CHILD];
+    generateRegRegInstruction(TR::InstOpCode::TESTRegReg(), callNode, returnStateBaseReg, returnStateBaseReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JNE4, callNode, fallbackLabel, cg());
+#endif /* JAVA_SPEC_VERSION >= 24 */
+
+    TR::Register *indexReg = cg()->allocateRegister();
+
+#if JAVA_SPEC_VERSION >= 22
+    // A non-null element of the heap base array denotes a heap segment passed as a pointer.
+    //
+    //    test  bases, bases
+    //    je    basesDone
+    //    mov   index, [bases + size]
+    // basesLoop:
+    //    test  index, index
+    //    je    basesDone
+    //    sub   index, 1
+    //    cmp   [bases + index * refSize + header], 0
+    //    jne   fallback
+    //    jmp   basesLoop
+    // basesDone:
+    //
+    TR::Register *basesReg = childRegs[DOWNCALL_BASES_CHILD];
+    TR::LabelSymbol *basesLoopLabel = generateLabelSymbol(cg());
+    TR::LabelSymbol *basesDoneLabel = generateLabelSymbol(cg());
+    bool useCompressedPointers = comp()->useCompressedPointers();
+
+    generateRegRegInstruction(TR::InstOpCode::TESTRegReg(), callNode, basesReg, basesReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JE4, callNode, basesDoneLabel, cg());
+    generateRegMemInstruction(TR::InstOpCode::L4RegMem, callNode, indexReg,
+        generateX86MemoryReference(basesReg, arraySizeOffset, cg()), cg());
+    generateLabelInstruction(TR::InstOpCode::label, callNode, basesLoopLabel, cg());
+    generateRegRegInstruction(TR::InstOpCode::TEST4RegReg, callNode, indexReg, indexReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JE4, callNode, basesDoneLabel, cg());
+    generateRegImmInstruction(TR::InstOpCode::SUB4RegImms, callNode, indexReg, 1, cg());
+    generateMemImmInstruction(useCompressedPointers ? TR::InstOpCode::CMP4MemImms : TR::InstOpCode::CMP8MemImms,
+        callNode,
+        generateX86MemoryReference(basesReg, indexReg, useCompressedPointers ? 2 : 3, arrayHeaderSize, cg()), 0,
+        cg());
+    generateLabelInstruction(TR::InstOpCode::JNE4, callNode, fallbackLabel, cg());
+    generateLabelInstruction(TR::InstOpCode::JMP4, callNode, basesLoopLabel, cg());
+    generateLabelInstruction(TR::InstOpCode::label, callNode, basesDoneLabel, cg());
+#endif /* JAVA_SPEC_VERSION >= 22 */
+
+    // The arguments must fit in the buffer on the C stack.
+    //
+    generateRegMemInstruction(TR::InstOpCode::L4RegMem, callNode, indexReg,
+        generateX86MemoryReference(argValuesReg, arraySizeOffset, cg()), cg());
+    generateRegImmInstruction(TR::InstOpCode::CMP4RegImms, callNode, indexReg, J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT,
+        cg());
+    generateLabelInstruction(TR::InstOpCode::JA4, callNode, fallbackLabel, cg());
+
+    // Anchor the Java frame before the stack pointer is adjusted, as for JNI calls.
+    //
+    TR::X86VFPDedicateInstruction *vfpDedicateInstruction = generateVFPDedicateInstruction(
+        machine()->getRealRegister(_JNIDispatchInfo.dedicatedFrameRegisterIndex), callNode, cg());
+
+    buildJNICallOutFrame(callNode, returnAddrLabel);
+
+#if JAVA_SPEC_VERSION >= 19
+    generateMemInstruction(TR::InstOpCode::INC8Mem, callNode,
+        generateX86MemoryReference(vmThreadReg, fej9->thisThreadGetCallOutCountOffset(), cg()), cg());
+#endif
+
+    TR::J9LinkageUtils::switchToMachineCStack(callNode, cg());
+    generateRegInstruction(TR::InstOpCode::PUSHReg, callNode, vmThreadReg, cg());
+    generateRegImmInstruction(TR::InstOpCode::SUBRegImm4(), callNode, espReal, argBufferSize, cg());
+    _JNIDispatchInfo.argSize = TR::Compiler->om.sizeofReferenceAddress() + argBufferSize;
+
+    // Copy the arguments out of the array while VM access is still held.
+    //
+    //    copyLoop:
+    //    test  index, index
+    //    je    copyDone
+    //    sub   index, 1
+    //    mov   scratch, [argValues + index * 8 + header]
+    //    mov   [rsp + index * 8], scratch
+    //    jmp   copyLoop
+    //    copyDone:
+    //
+    TR::Register *scratchReg = cg()->allocateRegister();
+    TR::LabelSymbol *copyLoopLabel = generateLabelSymbol(cg());
+    TR::LabelSymbol *copyDoneLabel = generateLabelSymbol(cg());
+
+    generateLabelInstruction(TR::InstOpCode::label, callNode, copyLoopLabel, cg());
+    generateRegRegInstruction(TR::InstOpCode::TEST4RegReg, callNode, indexReg, indexReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JE4, callNode, copyDoneLabel, cg());
+    generateRegImmInstruction(TR::InstOpCode::SUB4RegImms, callNode, indexReg, 1, cg());
+    generateRegMemInstruction(TR::InstOpCode::L8RegMem, callNode, scratchReg,
+        generateX86MemoryReference(argValuesReg, indexReg, 3, arrayHeaderSize, cg()), cg());
+    generateMemRegInstruction(TR::InstOpCode::S8MemReg, callNode,
+        generateX86MemoryReference(espReal, indexReg, 3, 0, cg()), scratchReg, cg());
+    generateLabelInstruction(TR::InstOpCode::JMP4, callNode, copyLoopLabel, cg());
+    generateLabelInstruction(TR::InstOpCode::label, callNode, copyDoneLabel, cg());
+
+    cg()->stopUsingRegister(scratchReg);
+    cg()->stopUsingRegister(indexReg);
+
+    // Pass the VMThread, the cif, the function, the copied arguments and the struct return memory
+    // to invokeDowncallFromJIT().
+    //
+    const int32_t numArgs = 5;
+    TR::Register *argRegs[numArgs];
+    for (int32_t i = 0; i < numArgs; i++)
+        argRegs[i] = cg()->allocateRegister();
+
+    generateRegRegInstruction(TR::InstOpCode::MOVRegReg(), callNode, argRegs[0], vmThreadReg, cg());
+    generateRegRegInstruction(TR::InstOpCode::MOVRegReg(), callNode, argRegs[1], childRegs[DOWNCALL_CIF_CHILD], cg());
+    generateRegRegInstruction(TR::InstOpCode::MOVRegReg(), callNode, argRegs[2], childRegs[DOWNCALL_FUNCTION_CHILD],
+        cg());
+    generateRegRegInstruction(TR::InstOpCode::MOVRegReg(), callNode, argRegs[3], espReal, cg());
+    generateRegRegInstruction(TR::InstOpCode::MOVRegReg(), callNode, argRegs[4],
+        childRegs[DOWNCALL_RETURN_STRUCT_CHILD], cg());
+
+    uint32_t callPost = _systemLinkage->getProperties().getNumVolatileRegisters() + 1 + 1;
+    uint32_t labelPost = _systemLinkage->getProperties().getNumVolatileRegisters()
+        + _systemLinkage->getProperties().getNumPreservedRegisters() + 1 + 1;
+
+    _JNIDispatchInfo.callPostDeps = generateRegisterDependencyConditions(numArgs, callPost, cg());
+    _JNIDispatchInfo.mergeLabelPostDeps = generateRegisterDependencyConditions(0, labelPost, cg());
+
+    for (int32_t i = 0; i < numArgs; i++) {
+        _JNIDispatchInfo.callPostDeps->addPreCondition(argRegs[i],
+            _systemLinkage->getProperties().getIntegerArgumentRegister(i), cg());
+        cg()->stopUsingRegister(argRegs[i]);
+    }
+    _JNIDispatchInfo.callPostDeps->stopAddingPreConditions();
+
+    _JNIDispatchInfo.linkageReturnRegister
+        = buildVolatileAndReturnDependencies(callNode, _JNIDispatchInfo.callPostDeps, true);
+
+    for (int32_t i = 0; i < callPost; i++) {
+        TR::RegisterDependency *dep = _JNIDispatchInfo.callPostDeps->getPostConditions()->getRegisterDependency(i);
+        if (dep->getRealRegister() == _systemLinkage->getProperties().getIntegerScratchRegister(1)) {
+            _JNIDispatchInfo.dispatchTrampolineRegister = dep->getRegister();
+            break;
+        }
+    }
+
+    buildJNIMergeLabelDependencies(callNode, true);
+
+    TR::Register *targetReg = _JNIDispatchInfo.JNIReturnRegister;
+
+    // The downcalls not handled here, and any downcall while the argument count is out of range,
+    // go through the VM internal native.
+    //
+    TR_OutlinedInstructions *outlinedCall = new (trHeapMemory())
+        TR_OutlinedInstructions(callNode, TR::lcall, targetReg, fallbackLabel, restartLabel, cg());
+    cg()->getOutlinedInstructionsList().push_front(outlinedCall);
+
+#ifdef J9VM_INTERP_ATOMIC_FREE_JNI
+    releaseVMAccessAtomicFree(callNode);
+#else
+    releaseVMAccess(callNode);
+#endif
+
+    // Load machine bp as for JNI calls.
+    //
+    generateRegMemInstruction(TR::InstOpCode::LRegMem(), callNode, vmThreadReg,
+        generateX86MemoryReference(espReal, offsetof(J9CInterpreterStackFrame, machineBP) + _JNIDispatchInfo.argSize,
+            cg()),
+        cg());
+
+    uintptr_t targetAddress = (uintptr_t)fej9->getJ9JITConfig()->javaVM->internalVMFunctions->invokeDowncallFromJIT;
+    generateRegImm64Instruction(TR::InstOpCode::MOV8RegImm64, callNode, _JNIDispatchInfo.dispatchTrampolineRegister,
+        targetAddress, cg());
+    TR::Instruction *callInstr = generateRegInstruction(TR::InstOpCode::CALLReg, callNode,
+        _JNIDispatchInfo.dispatchTrampolineRegister, _JNIDispatchInfo.callPostDeps, cg());
+    callInstr->setNeedsGCMap(_systemLinkage->getProperties().getPreservedRegisterMapForGC());
+    cg()->stopUsingRegister(_JNIDispatchInfo.dispatchTrampolineRegister);
+
+    generateLabelInstruction(callInstr, TR::InstOpCode::label, returnAddrLabel, cg());
+
+    generateRegRegInstruction(TR::InstOpCode::MOVRegReg(), callNode, targetReg, _JNIDispatchInfo.linkageReturnRegister,
+        cg());
+    cg()->stopUsingRegister(_JNIDispatchInfo.linkageReturnRegister);
+
+    // Release the argument buffer and restore the VMThread back from the C stack.
+    //
+    generateRegImmInstruction(TR::InstOpCode::ADDRegImm4(), callNode, espReal, argBufferSize, cg());
+    generateRegInstruction(TR::InstOpCode::POPReg, callNode, vmThreadReg, cg());
+
+#ifdef J9VM_INTERP_ATOMIC_FREE_JNI
+    acquireVMAccessAtomicFree(callNode);
+#else
+    acquireVMAccess(callNode);
+#endif
+
+    generateMemRegInstruction(TR::InstOpCode::SMemReg(), callNode,
+        generateX86MemoryReference(vmThreadReg, fej9->thisThreadGetMachineSPOffset(), cg()), espReal, cg());
+
+    TR::J9LinkageUtils::switchToJavaStack(callNode, cg());
+
+#if JAVA_SPEC_VERSION >= 19
+    generateMemInstruction(TR::InstOpCode::DEC8Mem, callNode,
+        generateX86MemoryReference(vmThreadReg, fej9->thisThreadGetCallOutCountOffset(), cg()), cg());
+#endif
+
+    generateRegMemInstruction(TR::InstOpCode::ADDRegMem(), callNode, espReal,
+        generateX86MemoryReference(vmThreadReg, fej9->thisThreadGetJavaLiteralsOffset(), cg()), cg());
+
+    cleanupJNIRefPool(callNode);
+
+    generateRegImmInstruction(TR::InstOpCode::ADDRegImms(), callNode, espReal,
+        _JNIDispatchInfo.numJNIFrameSlotsPushed * TR::Compiler->om.sizeofReferenceAddress(), cg());
+
+    // An exception thrown in an upcall is pending once the native function returns.
+    //
+    checkForJNIExceptions(callNode);
+
+    generateVFPReleaseInstruction(vfpDedicateInstruction, callNode, cg());
+
+    generateLabelInstruction(TR::InstOpCode::label, callNode, restartLabel, _JNIDispatchInfo.mergeLabelPostDeps, cg());
+
+    for (int32_t i = 0; i < DOWNCALL_CHILD_COUNT; i++)
+        cg()->decReferenceCount(callNode->getChild(i));
+
+    callNode->setRegister(targetReg);
+    return targetReg;
+#else
+    TR_ASSERT_FATAL(false, "Downcalls are not supported before Java 16");
+    return NULL;
+#endif /* JAVA_SPEC_VERSION >= 16 */
+}
+
 #endif
@@ -32,6 +32,7 @@
 
 namespace TR {
 class CodeGenerator;
+class Compilation;
 class Instruction;
 class LabelSymbol;
 class Node;
@@ -65,7 +66,8 @@ public:
     void buildOutgoingJNIArgsAndDependencies(TR::Node *callNode, bool passThread = true, bool passReceiver = true,
         bool killNonVolatileGPRs = true);
     TR::Register *processJNIReferenceArg(TR::Node *child);
-    TR::Instruction *generateMethodDispatch(TR::Node *callNode, bool isJNIGCPoint = true, uintptr_t targetAddress = 0);
+    TR::Instruction *generateMethodDispatch(TR::Node *callNode, bool isJNIGCPoint = true, uintptr_t targetAddress = 0,
+        bool isJNICallSite = true);
     void releaseVMAccess(TR::Node *callNode);
     void acquireVMAccess(TR::Node *callNode);
 #ifdef J9VM_INTERP_ATOMIC_FREE_JNI
@@ -76,6 +78,9 @@ public:
     void cleanupJNIRefPool(TR::Node *callNode);
     void populateJNIDispatchInfo();
 
+    static bool canInlineDowncall(TR::Compilation *comp, TR::Node *callNode);
+    TR::Register *buildDirectDowncallDispatch(TR::Node *callNode);
+
 private:
     TR::Register *buildDirectJNIDispatch(TR::Node *callNode);
     TR::AMD64SystemLinkage *_systemLinkage;
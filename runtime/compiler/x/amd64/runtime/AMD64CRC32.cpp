@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Replacements for the java/util/zip/CRC32 natives, called directly from JIT compiled code
+ * (see J9::X86::AMD64::JNILinkage::buildDirectJNIDispatch). They keep the JNI signature of
+ * the methods they replace, but run with VM access held and without a JNI frame, so they
+ * must not call back into the VM.
+ *
+ * Buffers of at least 64 bytes are folded 64 bytes at a time using carry-less multiplication,
+ * as described in "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ * (Intel, 2009). The remaining tail bytes are processed one bit at a time.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <immintrin.h>
+#include "j9.h"
+#include "x/amd64/runtime/AMD64CRC32.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CRC32_FOLD_TARGET __attribute__((target("sse4.1,pclmul")))
+#else
+#define CRC32_FOLD_TARGET
+#endif
+
+static const uint32_t CRC32_POLYNOMIAL_REFLECTED = 0xEDB88320;
+
+static uint32_t crc32Bitwise(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    while (len--) {
+        crc ^= *buf++;
+        for (int i = 0; i < 8; i++)
+            crc = (crc >> 1) ^ (CRC32_POLYNOMIAL_REFLECTED & (0 - (crc & 1)));
+    }
+    return crc;
+}
+
+/*
+ * Fold len bytes into the (pre-inverted) crc. len must be a multiple of 16 and at least 64.
+ */
+CRC32_FOLD_TARGET static uint32_t crc32Fold(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    static const uint64_t k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+    static const uint64_t k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+    static const uint64_t k5k0[] = { 0x0163cd6124, 0x0000000000 };
+    static const uint64_t poly[] = { 0x01db710641, 0x01f7011641 };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_loadu_si128((const __m128i *)k1k2);
+    buf += 64;
+    len -= 64;
+
+    // Fold 512 bits at a time
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(buf + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(buf + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(buf + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(buf + 0x30)));
+        buf += 64;
+        len -= 64;
+    }
+
+    // Fold the four accumulators into 128 bits
+    x0 = _mm_loadu_si128((const __m128i *)k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold the remaining 128-bit blocks
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *)buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        buf += 16;
+        len -= 16;
+    }
+
+    // Fold 128 bits into 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_loadu_si128((const __m128i *)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    crc = ~crc;
+    if (len >= 64) {
+        size_t foldLen = len & ~(size_t)15;
+        crc = crc32Fold(crc, buf, foldLen);
+        buf += foldLen;
+        len -= foldLen;
+    }
+    return ~crc32Bitwise(crc, buf, len);
+}
+
+extern "C" {
+
+jint JNICALL crc32UpdateAMD64(JNIEnv *env, jclass clazz, jint crc, jint b)
+{
+    uint8_t byte = (uint8_t)b;
+    return (jint)crc32Update((uint32_t)crc, &byte, 1);
+}
+
+jint JNICALL crc32UpdateBytesAMD64(JNIEnv *env, jclass clazz, jint crc, jarray b, jint off, jint len)
+{
+    J9VMThread *vmThread = (J9VMThread *)env;
+    j9object_t array = J9_JNI_UNWRAP_REFERENCE(b);
+    const uint8_t *buf = (const uint8_t *)J9JAVAARRAYCONTIGUOUS_BASE_EA(vmThread, array, off, uint8_t);
+    return (jint)crc32Update((uint32_t)crc, buf, (size_t)len);
+}
+
+jint JNICALL crc32UpdateByteBufferAMD64(JNIEnv *env, jclass clazz, jint crc, jlong address, jint off, jint len)
+{
+    const uint8_t *buf = (const uint8_t *)(uintptr_t)address + off;
+    return (jint)crc32Update((uint32_t)crc, buf, (size_t)len);
+}
+}
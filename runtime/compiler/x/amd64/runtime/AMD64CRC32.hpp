@@ -0,0 +1,38 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef AMD64_CRC32_INCL
+#define AMD64_CRC32_INCL
+
+#include "jni.h"
+
+/*
+ * Accelerated replacements for the java/util/zip/CRC32 natives. They have the same
+ * signature as the JNI methods they replace and require SSE4.1 and PCLMULQDQ.
+ */
+extern "C" {
+jint JNICALL crc32UpdateAMD64(JNIEnv *env, jclass clazz, jint crc, jint b);
+jint JNICALL crc32UpdateBytesAMD64(JNIEnv *env, jclass clazz, jint crc, jarray b, jint off, jint len);
+jint JNICALL crc32UpdateByteBufferAMD64(JNIEnv *env, jclass clazz, jint crc, jlong address, jint off, jint len);
+}
+
+#endif
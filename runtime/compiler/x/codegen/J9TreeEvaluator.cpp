@@ -81,6 +81,7 @@
 #include "codegen/X86FPConversionSnippet.hpp"
 
 #ifdef TR_TARGET_64BIT
+#include "codegen/AMD64JNILinkage.hpp"
 #include "codegen/AMD64PrivateLinkage.hpp"
 #endif
 #ifdef TR_TARGET_32BIT
@@ -12496,6 +12497,16 @@ TR::Register *J9::X86::TreeEvaluator::directCallEvaluator(TR::Node *node, TR::Co
 
             callInlined = true;
             break;
+#if defined(TR_TARGET_64BIT) && (JAVA_SPEC_VERSION >= 16)
+        case TR::openj9_internal_foreign_abi_InternalDowncallHandler_invokeNative:
+            if (J9::X86::AMD64::JNILinkage::canInlineDowncall(comp, node)) {
+                J9::X86::AMD64::JNILinkage *jniLinkage
+                    = static_cast<J9::X86::AMD64::JNILinkage *>(cg->getLinkage(TR_J9JNILinkage));
+                returnRegister = jniLinkage->buildDirectDowncallDispatch(node);
+                callInlined = true;
+            }
+            break;
+#endif /* defined(TR_TARGET_64BIT) && (JAVA_SPEC_VERSION >= 16) */
 
         default:
             break;
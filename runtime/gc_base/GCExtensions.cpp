@@ -40,6 +40,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "StandardAccessBarrier.hpp"
+#include "StringDeduplicator.hpp"
 #include "ObjectModel.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
 #include "SublistPool.hpp"
@@ -177,6 +178,11 @@ MM_GCExtensions::tearDown(MM_EnvironmentBase *env)
 		*tmpHookInterface = NULL; /* avoid issues with double teardowns */
 	}
 
+	if (NULL != stringDeduplicator) {
+		stringDeduplicator->kill(env);
+		stringDeduplicator = NULL;
+	}
+
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	if (NULL != idleGCManager) {
 		idleGCManager->kill(env);
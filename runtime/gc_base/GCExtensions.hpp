@@ -58,6 +58,7 @@ class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
 class MM_ContinuationObjectList;
+class MM_StringDeduplicator;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
 class MM_Wildcard;
@@ -97,6 +98,7 @@ private:
 	MM_ContinuationObjectList* continuationObjectLists; /**< The global linked list of continuation object lists. */
 public:
 	MM_StringTable* stringTable; /**< top level String Table structure (internally organized as a set of hash sub-tables */
+	MM_StringDeduplicator* stringDeduplicator; /**< shares identical String backing arrays during collections (NULL unless stringDeduplication is enabled) */
 
 	void* gcchkExtensions;
 
@@ -216,6 +218,12 @@ public:
 	};
 	JitStringDeDupPolicy stringDedupPolicy;
 
+	bool stringDeduplication; /**< true if collectors should share the backing arrays of Strings with identical contents */
+	uintptr_t stringDeduplicationAge; /**< minimum region logical age of a String to be a deduplication candidate (balanced) */
+	uintptr_t stringDeduplicationQueueSize; /**< maximum number of String deduplication candidates processed per collection */
+
+	volatile uintptr_t allocationSamplingIntervals[J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT]; /**< sampling interval requested by each requester, UDATA_MAX if it does not sample. objectSamplingBytesGranularity is the smallest of them */
+
 	intptr_t _asyncCallbackKey; /**< the key for async callback used in Concurrent Marking for threads to scan their own stacks */
 	intptr_t _TLHAsyncCallbackKey; /**< the key for async callback used to support instrumentable allocations */
 
@@ -277,6 +285,12 @@ public:
 	 */
 	MMINLINE MM_StringTable* getStringTable() { return stringTable; }
 
+	/**
+	 * Fetch the String deduplicator.
+	 * @return the String deduplicator, or NULL if String deduplication is disabled
+	 */
+	MMINLINE MM_StringDeduplicator* getStringDeduplicator() { return stringDeduplicator; }
+
 	MMINLINE uintptr_t getDynamicMaxSoftReferenceAge()
 	{
 		return dynamicMaxSoftReferenceAge;
@@ -388,6 +402,7 @@ public:
 		, ownableSynchronizerObjectLists(NULL)
 		, continuationObjectLists(NULL)
 		, stringTable(NULL)
+		, stringDeduplicator(NULL)
 		, gcchkExtensions(NULL)
 		, tgcExtensions(NULL)
 #if defined(J9VM_GC_FINALIZATION)
@@ -421,6 +436,9 @@ public:
 		, virtualLargeObjectHeap()
 		, dynamicHeapAdjustmentForRestore(false)
 		, stringDedupPolicy(J9_JIT_STRING_DEDUP_POLICY_UNDEFINED)
+		, stringDeduplication(false)
+		, stringDeduplicationAge(3)
+		, stringDeduplicationQueueSize(64 * 1024)
 		, _asyncCallbackKey(-1)
 		, _TLHAsyncCallbackKey(-1)
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
@@ -441,6 +459,9 @@ public:
 		, enableOriginalJDK8HeapSizeCompatibilityOption(false)
 	{
 		_typeId = __FUNCTION__;
+		for (uintptr_t i = 0; i < J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT; i++) {
+			allocationSamplingIntervals[i] = UDATA_MAX;
+		}
 	}
 };
 
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "StringDeduplicator.hpp"
+
+#include <string.h>
+
+#include "j2sever.h"
+#include "j9consts.h"
+#include "modron.h"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensions.hpp"
+
+MM_StringDeduplicator *
+MM_StringDeduplicator::newInstance(MM_EnvironmentBase *env, uintptr_t candidateCapacity)
+{
+	MM_StringDeduplicator *stringDeduplicator = (MM_StringDeduplicator *)env->getForge()->allocate(sizeof(MM_StringDeduplicator), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != stringDeduplicator) {
+		new(stringDeduplicator) MM_StringDeduplicator(env, candidateCapacity);
+		if (!stringDeduplicator->initialize(env)) {
+			stringDeduplicator->kill(env);
+			stringDeduplicator = NULL;
+		}
+	}
+	return stringDeduplicator;
+}
+
+bool
+MM_StringDeduplicator::initialize(MM_EnvironmentBase *env)
+{
+	_extensions = MM_GCExtensions::getExtensions(env);
+
+	if (0 == _candidateCapacity) {
+		return false;
+	}
+
+	_candidates = (j9object_t *)env->getForge()->allocate(sizeof(j9object_t) * _candidateCapacity, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+
+	/* keep the table at most half full so that probe sequences stay short */
+	uintptr_t tableSize = 1;
+	while (tableSize < (2 * _candidateCapacity)) {
+		tableSize <<= 1;
+	}
+	_table = (volatile uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * tableSize, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	_tableMask = tableSize - 1;
+	memset((void *)_table, 0, sizeof(uintptr_t) * tableSize);
+
+	return true;
+}
+
+void
+MM_StringDeduplicator::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		env->getForge()->free((void *)_table);
+		_table = NULL;
+	}
+	if (NULL != _candidates) {
+		env->getForge()->free(_candidates);
+		_candidates = NULL;
+	}
+}
+
+void
+MM_StringDeduplicator::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_StringDeduplicator::reset(MM_EnvironmentBase *env)
+{
+	if (0 != _candidateCount) {
+		/* nothing can have been inserted if nothing was queued */
+		memset((void *)_table, 0, sizeof(uintptr_t) * (_tableMask + 1));
+	}
+	_candidateCount = 0;
+	_stringClass = J9VMJAVALANGSTRING_OR_NULL(_extensions->getJavaVM());
+}
+
+bool
+MM_StringDeduplicator::isShareableArray(j9object_t array)
+{
+	GC_ArrayObjectModel *indexableObjectModel = &_extensions->indexableObjectModel;
+	J9IndexableObject *indexable = (J9IndexableObject *)array;
+	bool result = indexableObjectModel->isInlineContiguousArraylet(indexable);
+#if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
+	if (result && indexableObjectModel->isVirtualLargeObjectHeapEnabled()) {
+		/* off-heap data has its own lifetime management; leave it alone */
+		result = indexableObjectModel->isDataAdjacentToHeader(indexable);
+	}
+#endif /* defined(J9VM_GC_SPARSE_HEAP_ALLOCATION) */
+	return result;
+}
+
+uintptr_t
+MM_StringDeduplicator::hashArrayData(const uint8_t *data, uintptr_t size)
+{
+	/* FNV-1a */
+	uintptr_t hash = (uintptr_t)2166136261U;
+	for (uintptr_t i = 0; i < size; i++) {
+		hash = (hash ^ data[i]) * (uintptr_t)16777619U;
+	}
+	return hash ^ (hash >> 16);
+}
+
+j9object_t
+MM_StringDeduplicator::findCanonicalArray(MM_EnvironmentBase *env, j9object_t array)
+{
+	if (!isShareableArray(array)) {
+		return array;
+	}
+
+	GC_ArrayObjectModel *indexableObjectModel = &_extensions->indexableObjectModel;
+	J9Class *arrayClass = J9GC_J9OBJECT_CLAZZ(array, env);
+	uintptr_t elementCount = indexableObjectModel->getSizeInElements((J9IndexableObject *)array);
+	uintptr_t dataSize = elementCount * J9ARRAYCLASS_GET_STRIDE(arrayClass);
+	const uint8_t *data = (const uint8_t *)indexableObjectModel->getDataPointerForContiguous((J9IndexableObject *)array);
+
+	uintptr_t index = hashArrayData(data, dataSize) & _tableMask;
+	for (;;) {
+		uintptr_t entry = _table[index];
+		if (0 == entry) {
+			entry = MM_AtomicOperations::lockCompareExchange(&_table[index], 0, (uintptr_t)array);
+			if (0 == entry) {
+				/* array is now canonical for its contents */
+				return array;
+			}
+			/* lost the race for this slot; compare against the winner */
+		}
+
+		j9object_t candidate = (j9object_t)entry;
+		if (candidate == array) {
+			return array;
+		}
+		if ((J9GC_J9OBJECT_CLAZZ(candidate, env) == arrayClass)
+			&& (indexableObjectModel->getSizeInElements((J9IndexableObject *)candidate) == elementCount)
+			&& (0 == memcmp(indexableObjectModel->getDataPointerForContiguous((J9IndexableObject *)candidate), data, dataSize))
+		) {
+			return candidate;
+		}
+
+		/* the table holds at most one array per candidate and is at least twice as large, so this terminates */
+		index = (index + 1) & _tableMask;
+	}
+}
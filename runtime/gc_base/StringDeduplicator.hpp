@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(STRINGDEDUPLICATOR_HPP_)
+#define STRINGDEDUPLICATOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+/**
+ * Collects java.lang.String objects found by a collector during tracing and shares identical
+ * String backing arrays between them.
+ *
+ * Candidates are queued by the tracing threads of a collection (including concurrent mark helpers)
+ * and are processed by the GC worker threads once tracing is complete, while the heap is stable.
+ * Arrays are canonicalized through an open addressing table keyed by their contents, which only
+ * lives for a single collection, so only Strings queued in the same cycle are deduplicated against
+ * each other. The queue has a fixed capacity; candidates found once it is full are dropped for the cycle.
+ *
+ * The collector owns the policy: which Strings are candidates, whether the String and its array are
+ * live, and how the updated value slot is recorded (card, remembered set).
+ * @ingroup GC_Base
+ */
+class MM_StringDeduplicator : public MM_BaseVirtual {
+private:
+	MM_GCExtensions *_extensions; /**< cached GC global extensions */
+	J9Class *_stringClass; /**< java.lang.String, cached at the start of each cycle (NULL until it is loaded) */
+	j9object_t *_candidates; /**< queue of String objects to process this cycle */
+	uintptr_t _candidateCapacity; /**< maximum number of candidates per cycle */
+	volatile uintptr_t _candidateCount; /**< number of candidates offered this cycle (may exceed _candidateCapacity) */
+	volatile uintptr_t *_table; /**< canonical backing arrays, indexed by content hash */
+	uintptr_t _tableMask; /**< table size (a power of two) minus one */
+
+public:
+	static const uintptr_t CANDIDATES_PER_WORK_UNIT = 256; /**< candidates processed by a GC thread per work unit */
+
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @param array a String backing array
+	 * @return true if the array can be shared: it is contiguous, not empty and its data is in the heap
+	 */
+	bool isShareableArray(j9object_t array);
+
+	/**
+	 * @return a hash of the data of a contiguous array
+	 */
+	static uintptr_t hashArrayData(const uint8_t *data, uintptr_t size);
+
+public:
+	static MM_StringDeduplicator *newInstance(MM_EnvironmentBase *env, uintptr_t candidateCapacity);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the candidates and canonical arrays of the previous cycle.
+	 * Must be called while no thread is queueing or processing candidates.
+	 */
+	void reset(MM_EnvironmentBase *env);
+
+	/**
+	 * @param clazz the class of an object being traced
+	 * @return true if objects of the class are String deduplication candidates
+	 */
+	MMINLINE bool isStringClass(J9Class *clazz) { return clazz == _stringClass; }
+
+	/**
+	 * Queue a String for deduplication at the end of the cycle. Safe to call from multiple threads.
+	 * @param string a live String object which will not move before the candidates are processed
+	 */
+	MMINLINE void
+	addCandidate(j9object_t string)
+	{
+		if (_candidateCount < _candidateCapacity) {
+			uintptr_t index = MM_AtomicOperations::add(&_candidateCount, 1) - 1;
+			if (index < _candidateCapacity) {
+				_candidates[index] = string;
+			}
+		}
+	}
+
+	/**
+	 * @return the number of queued candidates. Only valid once all tracing threads have synchronized.
+	 */
+	MMINLINE uintptr_t getCandidateCount() { return OMR_MIN(_candidateCount, _candidateCapacity); }
+
+	/**
+	 * @return the number of candidates which did not fit in the queue this cycle
+	 */
+	MMINLINE uintptr_t getDroppedCandidateCount() { return (_candidateCount > _candidateCapacity) ? (_candidateCount - _candidateCapacity) : 0; }
+
+	MMINLINE j9object_t getCandidate(uintptr_t index) { return _candidates[index]; }
+
+	/**
+	 * Find the array which Strings with the same contents as array should share, making array
+	 * the canonical one if no such array has been seen yet this cycle. Safe to call from multiple threads.
+	 * @param array a live String backing array which will not move before the end of the cycle
+	 * @return the canonical array, or array itself if it is canonical or cannot be shared
+	 */
+	j9object_t findCanonicalArray(MM_EnvironmentBase *env, j9object_t array);
+
+	MM_StringDeduplicator(MM_EnvironmentBase *env, uintptr_t candidateCapacity)
+		: MM_BaseVirtual()
+		, _extensions(NULL)
+		, _stringClass(NULL)
+		, _candidates(NULL)
+		, _candidateCapacity(candidateCapacity)
+		, _candidateCount(0)
+		, _table(NULL)
+		, _tableMask(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* STRINGDEDUPLICATOR_HPP_ */
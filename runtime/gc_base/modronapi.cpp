@@ -31,6 +31,7 @@
 #include "modronopt.h"
 #include "modronnls.h"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "HeapMemorySnapshot.hpp"
@@ -1095,31 +1096,51 @@ j9gc_allocation_threshold_changed(J9VMThread *currentThread)
 }
 
 /**
- * Set the allocation sampling interval to trigger a J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING event
+ * Set the allocation sampling interval of a requester to trigger a J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING event
+ * 
+ * JVMTI and JFR sample allocations independently, so each requester has its own interval and
+ * the GC samples at the smallest interval of the requesters that are sampling. Each thread counts
+ * the bytes it allocates for every requester, and the event reports in its requesters field which
+ * of them have reached their own interval. Disabling the sampling of one requester restores the
+ * interval of the others.
  * 
  * Examples:
  * 	To trigger an event whenever 4K objects have been allocated:
- *		j9gc_set_allocation_sampling_interval(vm, (UDATA)4096);
+ *		j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, (UDATA)4096);
  *	To trigger an event for every object allocation:
- *		j9gc_set_allocation_sampling_interval(vm, (UDATA)0);
- *	To disable allocation sampling
- *		j9gc_set_allocation_sampling_interval(vm, UDATA_MAX);
+ *		j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, (UDATA)0);
+ *	To disable allocation sampling for a requester:
+ *		j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, UDATA_MAX);
  * The initial MM_GCExtensionsBase::objectSamplingBytesGranularity value is UDATA_MAX.
  * 
  * @parm[in] vm The J9JavaVM
+ * @parm[in] requester The J9_GC_ALLOCATION_SAMPLING_REQUESTER_* setting the interval
  * @parm[in] samplingInterval The allocation sampling interval.
  */
 void 
-j9gc_set_allocation_sampling_interval(J9JavaVM *vm, UDATA samplingInterval)
+j9gc_set_allocation_sampling_interval(J9JavaVM *vm, UDATA requester, UDATA samplingInterval)
 {
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	Assert_MM_true(requester < J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT);
 	if (0 == samplingInterval) {
 		/* avoid (env->_traceAllocationBytes) % 0 which could be undefined. */
 		samplingInterval = 1;
 	}
 
-	if (samplingInterval != extensions->objectSamplingBytesGranularity) {
-		extensions->objectSamplingBytesGranularity = samplingInterval;
+	extensions->allocationSamplingIntervals[requester] = samplingInterval;
+	MM_AtomicOperations::sync();
+
+	/* Requesters may race; whoever changes the granularity last re-reads every interval, so the smallest one wins. */
+	for (;;) {
+		UDATA combinedInterval = UDATA_MAX;
+		for (UDATA i = 0; i < J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT; i++) {
+			combinedInterval = OMR_MIN(combinedInterval, extensions->allocationSamplingIntervals[i]);
+		}
+		if (combinedInterval == extensions->objectSamplingBytesGranularity) {
+			break;
+		}
+		extensions->objectSamplingBytesGranularity = combinedInterval;
+		MM_AtomicOperations::sync();
 		J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
 		j9gc_allocation_threshold_changed(currentThread);
 	}
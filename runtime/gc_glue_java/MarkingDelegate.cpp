@@ -126,6 +126,9 @@ MM_MarkingDelegate::mainSetupForWalk(MM_EnvironmentBase *env)
 
 	/* treat all interned strings as roots for the purposes of a heap walk */
 	_collectStringConstantsEnabled = false;
+
+	/* a heap walk must not queue String deduplication candidates */
+	_stringDeduplicator = NULL;
 }
 
 void
@@ -163,6 +166,44 @@ MM_MarkingDelegate::workerCompleteGC(MM_EnvironmentBase *env)
 	MM_MarkingSchemeRootClearer rootClearer(env, _markingScheme, this);
 	rootClearer.setStringTableAsRoot(!_collectStringConstantsEnabled);
 	rootClearer.scanClearable(env);
+
+	if (NULL != _stringDeduplicator) {
+		/* clearable processing may have marked (and queued) resurrected objects; wait until it is complete on all threads */
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		deduplicateStrings(env);
+	}
+}
+
+void
+MM_MarkingDelegate::deduplicateStrings(MM_EnvironmentBase *env)
+{
+	MM_MarkJavaStats *markJavaStats = &(env->getGCEnvironment()->_markJavaStats);
+	uintptr_t candidateCount = _stringDeduplicator->getCandidateCount();
+	for (uintptr_t base = 0; base < candidateCount; base += MM_StringDeduplicator::CANDIDATES_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t top = OMR_MIN(base + MM_StringDeduplicator::CANDIDATES_PER_WORK_UNIT, candidateCount);
+			for (uintptr_t index = base; index < top; index++) {
+				omrobjectptr_t string = _stringDeduplicator->getCandidate(index);
+				/* candidates queued before an aborted concurrent cycle may have died since */
+				if (_markingScheme->isMarked(string)) {
+					GC_SlotObject valueSlot(_omrVM, J9GC_J9VMJAVALANGSTRING_VALUE_ADDRESS(env, string));
+					_markingScheme->fixupForwardedSlot(&valueSlot);
+					omrobjectptr_t array = valueSlot.readReferenceFromSlot();
+					if ((NULL != array) && isTenuredForStringDeduplication(array)) {
+						Assert_MM_true(_markingScheme->isMarked(array));
+						markJavaStats->_stringDeduplicationCandidates += 1;
+						omrobjectptr_t canonicalArray = _stringDeduplicator->findCanonicalArray(env, array);
+						if (canonicalArray != array) {
+							/* both objects are tenured and marked, so no barrier or remembered set update is required */
+							valueSlot.writeReferenceToSlot(canonicalArray);
+							markJavaStats->_stringDeduplicationShared += 1;
+							markJavaStats->_stringDeduplicationBytesSaved += _extensions->indexableObjectModel.getSizeInBytesWithHeader((J9IndexableObject *)array);
+						}
+					}
+				}
+			}
+		}
+	}
 }
 
 void
@@ -194,11 +235,21 @@ MM_MarkingDelegate::mainSetupForGC(MM_EnvironmentBase *env)
 
 	_collectStringConstantsEnabled = _extensions->collectStringConstants;
 	_extensions->continuationStats.clear();
+
+	_stringDeduplicator = _extensions->getStringDeduplicator();
+	if (NULL != _stringDeduplicator) {
+		_stringDeduplicator->reset(env);
+	}
 }
 
 void
 MM_MarkingDelegate::mainCleanupAfterGC(MM_EnvironmentBase *env)
 {
+	/* candidates must not outlive the cycle, since objects may move before the next one */
+	if (NULL != _stringDeduplicator) {
+		_stringDeduplicator->reset(env);
+	}
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	_markMap = (_extensions->dynamicClassUnloading != MM_GCExtensions::DYNAMIC_CLASS_UNLOADING_NEVER) ? _markingScheme->getMarkMap() : NULL;
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
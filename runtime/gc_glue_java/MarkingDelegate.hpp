@@ -35,6 +35,7 @@
 #include "ModronTypes.hpp"
 #include "ReferenceObjectScanner.hpp"
 #include "PointerArrayObjectScanner.hpp"
+#include "StringDeduplicator.hpp"
 
 #if JAVA_SPEC_VERSION >= 24
 class GC_ContinuationSlotIterator;
@@ -56,6 +57,7 @@ private:
 	bool _shouldScanUnfinalizedObjects;
 	bool _shouldScanOwnableSynchronizerObjects;
 	bool _shouldScanContinuationObjects;
+	MM_StringDeduplicator *_stringDeduplicator;	/**< Set while a collection may queue String deduplication candidates, NULL otherwise */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	MM_MarkMap *_markMap;							/**< This is set when dynamic class loading is enabled, NULL otherwise */
 	volatile bool _anotherClassMarkPass;			/**< Used in completeClassMark for another scanning request*/
@@ -91,6 +93,33 @@ private:
 	 */
 	void markPermanentClassloader(MM_EnvironmentBase *env, J9ClassLoader *classLoader);
 
+	/**
+	 * Only tenured Strings and arrays are deduplicated when a scavenger is present, since the scavenger
+	 * would otherwise have to preserve the sharing (and nursery Strings are mostly short lived).
+	 *
+	 * @param objectPtr the object to check
+	 * @return true if objectPtr may take part in String deduplication
+	 */
+	MMINLINE bool
+	isTenuredForStringDeduplication(omrobjectptr_t objectPtr)
+	{
+		bool result = true;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		if (_extensions->scavengerEnabled) {
+			result = _extensions->isOld(objectPtr);
+		}
+#endif /* defined(J9VM_GC_MODRON_SCAVENGER) */
+		return result;
+	}
+
+	/**
+	 * Share identical backing arrays between the String deduplication candidates queued during this cycle.
+	 * Must be called by all GC threads once marking is complete.
+	 *
+	 * @param env environment for calling thread
+	 */
+	void deduplicateStrings(MM_EnvironmentBase *env);
+
 
 protected:
 
@@ -103,6 +132,7 @@ public:
 		, _shouldScanUnfinalizedObjects(false)
 		, _shouldScanOwnableSynchronizerObjects(false)
 		, _shouldScanContinuationObjects(false)
+		, _stringDeduplicator(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, _markMap(NULL)
 		, _anotherClassMarkPass(false)
@@ -167,6 +197,11 @@ public:
 		case GC_ObjectModel::SCAN_OWNABLESYNCHRONIZER_OBJECT:
 		case GC_ObjectModel::SCAN_CLASS_OBJECT:
 		case GC_ObjectModel::SCAN_CLASSLOADER_OBJECT:
+			if ((NULL != _stringDeduplicator) && (SCAN_REASON_PACKET == reason) && _stringDeduplicator->isStringClass(clazz)) {
+				if (isTenuredForStringDeduplication(objectPtr)) {
+					_stringDeduplicator->addCandidate(objectPtr);
+				}
+			}
 			objectScanner = GC_MixedObjectScanner::newInstance(env, objectPtr, scannerSpace, 0);
 			*sizeToDo = referenceSize + ((GC_MixedObjectScanner *)objectScanner)->getBytesRemaining();
 			break;
@@ -261,7 +261,11 @@ traceAllocateObject(J9VMThread *vmThread, J9Object * object, J9Class* clazz, uin
 		 * after seeing large objects
 		 */
 		uintptr_t allocSizeInsideTLH = env->getAllocatedSizeInsideTLH();
+		uintptr_t countedBytes = env->_traceAllocationBytes + allocSizeInsideTLH - env->_traceAllocationBytesCurrentTLH;
 		uintptr_t remainder = (env->_traceAllocationBytes + allocSizeInsideTLH) % byteGranularity;
+		/* The bytes counted when the previous event fired were carried over, they were reported then */
+		uintptr_t allocatedBytes = countedBytes - OMR_MIN(countedBytes, vmThread->allocationSamplingCarriedBytes);
+		uintptr_t requesters = 0;
 		env->_traceAllocationBytesCurrentTLH = allocSizeInsideTLH + (env->_traceAllocationBytes % byteGranularity) - remainder;
 		env->_traceAllocationBytes = (env->_traceAllocationBytes) % byteGranularity;
 
@@ -269,6 +273,21 @@ traceAllocateObject(J9VMThread *vmThread, J9Object * object, J9Class* clazz, uin
 
 			env->setTLHSamplingTop(byteGranularity - remainder);
 		}
+		vmThread->allocationSamplingCarriedBytes = remainder;
+
+		/* The GC samples at the smallest interval, each requester counts its own bytes to find whether its interval has been reached */
+		for (uintptr_t i = 0; i < J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT; i++) {
+			uintptr_t samplingInterval = extensions->allocationSamplingIntervals[i];
+			if (UDATA_MAX == samplingInterval) {
+				vmThread->allocationSamplingBytes[i] = 0;
+			} else {
+				vmThread->allocationSamplingBytes[i] += allocatedBytes;
+				if (vmThread->allocationSamplingBytes[i] >= samplingInterval) {
+					vmThread->allocationSamplingBytes[i] %= samplingInterval;
+					requesters |= (uintptr_t)1 << i;
+				}
+			}
+		}
 
 		TRIGGER_J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING(
 			extensions->hookInterface,
@@ -277,7 +296,9 @@ traceAllocateObject(J9VMThread *vmThread, J9Object * object, J9Class* clazz, uin
 			J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING,
 			object,
 			clazz,
-			objSize);
+			objSize,
+			allocatedBytes,
+			requesters);
 	}
 	return object;
 }
@@ -752,6 +773,7 @@ memoryManagerTLHAsyncCallbackHandler(J9VMThread *vmThread, IDATA handlerKey, voi
 			if (UDATA_MAX != extensions->objectSamplingBytesGranularity) {
 				env->_traceAllocationBytes = 0;
 				env->_traceAllocationBytesCurrentTLH = 0;
+				vmThread->allocationSamplingCarriedBytes = env->getAllocatedSizeInsideTLH();
 				env->setTLHSamplingTop(samplingBytesGranularity);
 			} else if (!env->isInlineTLHAllocateEnabled()) {
 				env->resetTLHSamplingTop();
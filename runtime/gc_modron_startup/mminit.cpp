@@ -102,6 +102,7 @@
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_REALTIME */
 #include "Scavenger.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
@@ -512,6 +513,13 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
+	if (extensions->stringDeduplication && (extensions->isStandardGC() || extensions->isVLHGC())) {
+		extensions->stringDeduplicator = MM_StringDeduplicator::newInstance(&env, extensions->stringDeduplicationQueueSize);
+		if (NULL == extensions->stringDeduplicator) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Initialize statistic locks */
 	if (omrthread_monitor_init_with_name(&extensions->gcStatsMutex, 0, "MM_GCExtensions::gcStats")) {
 		vm->internalVMFunctions->setErrorJ9dll(
@@ -1603,6 +1603,38 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+
+		if (try_scan(&scan_start, "stringDeduplicationAge=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->stringDeduplicationAge, "stringDeduplicationAge=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "stringDeduplicationQueueSize=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->stringDeduplicationQueueSize, "stringDeduplicationQueueSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->stringDeduplicationQueueSize) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-XXgc:stringDeduplicationQueueSize", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "stringDeduplication")) {
+			extensions->stringDeduplication = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noStringDeduplication")) {
+			extensions->stringDeduplication = false;
+			continue;
+		}
+
 		if (try_scan(&scan_start, "darkMatterSampleRate=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->darkMatterSampleRate), "darkMatterSampleRate=")) {
 				returnValue = JNI_EINVAL;
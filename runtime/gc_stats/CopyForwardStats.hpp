@@ -70,6 +70,10 @@ public:
 	uintptr_t _monitorReferenceCleared; /**< The number of monitor references that have been cleared during marking */
 	uintptr_t _monitorReferenceCandidates; /**< The number of monitor references that have been visited in monitor table during marking */
 
+	uintptr_t _stringDeduplicationCandidates; /**< The number of Strings considered for backing array deduplication */
+	uintptr_t _stringDeduplicationShared; /**< The number of Strings re-pointed to an identical backing array */
+	uintptr_t _stringDeduplicationBytesSaved; /**< The size of the backing arrays no longer referenced by the re-pointed Strings */
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 	uintptr_t _offHeapRegionsCleared; /**< The number of sparse heap allocated regions that have been cleared during marking */
 	uintptr_t _offHeapRegionCandidates; /**< The number of sparse heap allocated regions that have been visited during marking */
@@ -111,6 +115,10 @@ public:
 		_monitorReferenceCleared = 0;
 		_monitorReferenceCandidates = 0;
 
+		_stringDeduplicationCandidates = 0;
+		_stringDeduplicationShared = 0;
+		_stringDeduplicationBytesSaved = 0;
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		_offHeapRegionsCleared = 0;
 		_offHeapRegionCandidates = 0;
@@ -144,6 +152,10 @@ public:
 		_monitorReferenceCleared += stats->_monitorReferenceCleared;
 		_monitorReferenceCandidates += stats->_monitorReferenceCandidates;
 
+		_stringDeduplicationCandidates += stats->_stringDeduplicationCandidates;
+		_stringDeduplicationShared += stats->_stringDeduplicationShared;
+		_stringDeduplicationBytesSaved += stats->_stringDeduplicationBytesSaved;
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		_offHeapRegionsCleared += stats->_offHeapRegionsCleared;
 		_offHeapRegionCandidates += stats->_offHeapRegionCandidates;
@@ -169,6 +181,9 @@ public:
 		, _stringConstantsCandidates(0)
 		, _monitorReferenceCleared(0)
 		, _monitorReferenceCandidates(0)
+		, _stringDeduplicationCandidates(0)
+		, _stringDeduplicationShared(0)
+		, _stringDeduplicationBytesSaved(0)
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		, _offHeapRegionsCleared(0)
 		, _offHeapRegionCandidates(0)
@@ -48,6 +48,10 @@ MM_MarkJavaStats::clear()
 	_monitorReferenceCleared = 0;
 	_monitorReferenceCandidates = 0;
 
+	_stringDeduplicationCandidates = 0;
+	_stringDeduplicationShared = 0;
+	_stringDeduplicationBytesSaved = 0;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	splitArraysProcessed = 0;
 	splitArraysAmount = 0;
@@ -76,6 +80,10 @@ MM_MarkJavaStats::merge(MM_MarkJavaStats* statsToMerge)
 	_monitorReferenceCleared += statsToMerge->_monitorReferenceCleared;
 	_monitorReferenceCandidates += statsToMerge->_monitorReferenceCandidates;
 
+	_stringDeduplicationCandidates += statsToMerge->_stringDeduplicationCandidates;
+	_stringDeduplicationShared += statsToMerge->_stringDeduplicationShared;
+	_stringDeduplicationBytesSaved += statsToMerge->_stringDeduplicationBytesSaved;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	splitArraysProcessed += statsToMerge->splitArraysProcessed;
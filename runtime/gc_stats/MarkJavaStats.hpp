@@ -59,6 +59,10 @@ public:
 	uintptr_t _monitorReferenceCleared; /**< The number of monitor references that have been cleared during marking */
 	uintptr_t _monitorReferenceCandidates; /**< The number of monitor references that have been visited in monitor table during marking */
 
+	uintptr_t _stringDeduplicationCandidates; /**< The number of Strings considered for backing array deduplication */
+	uintptr_t _stringDeduplicationShared; /**< The number of Strings re-pointed to an identical backing array */
+	uintptr_t _stringDeduplicationBytesSaved; /**< The size of the backing arrays no longer referenced by the re-pointed Strings */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t splitArraysProcessed; /**< The number of array chunks (not counting parts smaller than the split size) processed by this thread */
 	uintptr_t splitArraysAmount;
@@ -86,6 +90,9 @@ public:
 		, _stringConstantsCandidates(0)
 		, _monitorReferenceCleared(0)
 		, _monitorReferenceCandidates(0)
+		, _stringDeduplicationCandidates(0)
+		, _stringDeduplicationShared(0)
+		, _stringDeduplicationBytesSaved(0)
 	{
 		clear();
 	}
@@ -142,6 +142,14 @@ MM_VerboseHandlerOutputStandardJava::outputContinuationInfo(MM_EnvironmentBase *
 	}
 }
 
+void
+MM_VerboseHandlerOutputStandardJava::outputStringDeduplicationInfo(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t candidates, uintptr_t shared, uintptr_t bytesSaved)
+{
+	if (0 != candidates) {
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<stringDeduplication candidates=\"%zu\" shared=\"%zu\" bytesSaved=\"%zu\" />", candidates, shared, bytesSaved);
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandardJava::outputContinuationObjectInfo(MM_EnvironmentBase *env, uintptr_t indent)
 {
@@ -184,6 +192,7 @@ MM_VerboseHandlerOutputStandardJava::handleMarkEndInternal(MM_EnvironmentBase* e
 
 	outputStringConstantInfo(env, 1, markJavaStats->_stringConstantsCandidates, markJavaStats->_stringConstantsCleared);
 	outputMonitorReferenceInfo(env, 1, markJavaStats->_monitorReferenceCandidates, markJavaStats->_monitorReferenceCleared);
+	outputStringDeduplicationInfo(env, 1, markJavaStats->_stringDeduplicationCandidates, markJavaStats->_stringDeduplicationShared, markJavaStats->_stringDeduplicationBytesSaved);
 
 	if (workPacketStats->getSTWWorkStackOverflowOccured()) {
 		_manager->getWriterChain()->formatAndOutput(env, 1, "<warning details=\"work packet overflow\" count=\"%zu\" packetcount=\"%zu\" />",
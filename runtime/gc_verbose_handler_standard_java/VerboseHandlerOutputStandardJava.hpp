@@ -55,6 +55,16 @@ private:
 	 */
 	void outputOwnableSynchronizerInfo(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t ownableSynchronizerCandidates, uintptr_t ownableSynchronizerCleared);
 	void outputContinuationInfo(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t continuationCandidates, uintptr_t continuationCleared);
+
+	/**
+	 * Output String deduplication summary.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param candidates number of Strings considered for deduplication.
+	 * @param shared number of Strings re-pointed to an identical backing array.
+	 * @param bytesSaved size of the backing arrays no longer referenced by the re-pointed Strings.
+	 */
+	void outputStringDeduplicationInfo(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t candidates, uintptr_t shared, uintptr_t bytesSaved);
 	void outputContinuationObjectInfo(MM_EnvironmentBase *env, uintptr_t indent);
 
 	/**
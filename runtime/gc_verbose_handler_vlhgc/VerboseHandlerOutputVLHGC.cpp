@@ -286,6 +286,14 @@ MM_VerboseHandlerOutputVLHGC::outputContinuationInfo(MM_EnvironmentBase *env, UD
 	}
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::outputStringDeduplicationInfo(MM_EnvironmentBase *env, UDATA indent, UDATA candidates, UDATA shared, UDATA bytesSaved)
+{
+	if (0 != candidates) {
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<stringDeduplication candidates=\"%zu\" shared=\"%zu\" bytesSaved=\"%zu\" />", candidates, shared, bytesSaved);
+	}
+}
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 void
 MM_VerboseHandlerOutputVLHGC::outputOffHeapInfo(MM_EnvironmentBase *env, UDATA indent, UDATA offHeapRegionCandidates, UDATA offHeapRegionsCleared)
@@ -473,6 +481,7 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 
 	outputStringConstantInfo(env, 1, copyForwardStats->_stringConstantsCandidates, copyForwardStats->_stringConstantsCleared);
 	outputMonitorReferenceInfo(env, 1, copyForwardStats->_monitorReferenceCandidates, copyForwardStats->_monitorReferenceCleared);
+	outputStringDeduplicationInfo(env, 1, copyForwardStats->_stringDeduplicationCandidates, copyForwardStats->_stringDeduplicationShared, copyForwardStats->_stringDeduplicationBytesSaved);
 
 	if(0 != copyForwardStats->_heapExpandedCount) {
 		U_64 expansionMicros = j9time_hires_delta(0, copyForwardStats->_heapExpandedTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
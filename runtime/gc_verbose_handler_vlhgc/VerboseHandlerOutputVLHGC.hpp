@@ -64,6 +64,16 @@ private:
 	 */
 	void outputOwnableSynchronizerInfo(MM_EnvironmentBase *env, UDATA indent, UDATA ownableSynchronizerCandidates, UDATA ownableSynchronizerCleared);
 	void outputContinuationInfo(MM_EnvironmentBase *env, UDATA indent, UDATA continuationCandidates, UDATA continuationCleared);
+
+	/**
+	 * Output String deduplication summary.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param candidates number of Strings considered for deduplication.
+	 * @param shared number of Strings re-pointed to an identical backing array.
+	 * @param bytesSaved size of the backing arrays no longer referenced by the re-pointed Strings.
+	 */
+	void outputStringDeduplicationInfo(MM_EnvironmentBase *env, UDATA indent, UDATA candidates, UDATA shared, UDATA bytesSaved);
 	void outputContinuationObjectInfo(MM_EnvironmentBase *env, uintptr_t indent);
 
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
@@ -104,6 +104,7 @@
 #include "SparseAddressOrderedFixedSizeDataPool.hpp"
 #endif /* defined(J9VM_GC_SPARSE_HEAP_ALLOCATION) */
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -186,6 +187,7 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _dynamicClassUnloadingEnabled(false)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	, _collectStringConstantsEnabled(false)
+	, _stringDeduplicator(NULL)
 	, _tracingEnabled(false)
 	, _commonContext(NULL)
 	, _compactGroupBlock(NULL)
@@ -1454,6 +1456,15 @@ MM_CopyForwardScheme::mainSetupForCopyForward(MM_EnvironmentVLHGC *env)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	_collectStringConstantsEnabled = _extensions->collectStringConstants;
 
+	/* A GMP in progress would have to be told about the re-pointed slots, so deduplication only runs between GMPs */
+	_stringDeduplicator = NULL;
+	if (NULL == env->_cycleState->_externalCycleState) {
+		_stringDeduplicator = _extensions->getStringDeduplicator();
+		if (NULL != _stringDeduplicator) {
+			_stringDeduplicator->reset(env);
+		}
+	}
+
 	/* ensure heap base is aligned to region size */
 	uintptr_t heapBase = (uintptr_t)_extensions->heap->getHeapBase();
 	uintptr_t regionSize = _regionManager->getRegionSize();
@@ -3024,6 +3035,9 @@ MM_CopyForwardScheme::scanObject(MM_EnvironmentVLHGC *env, MM_AllocationContextT
 	case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
 	case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
 	case GC_ObjectModel::SCAN_MIXED_OBJECT:
+		if (SCAN_REASON_DIRTY_CARD != reason) {
+			rememberStringDeduplicationCandidate(env, objectPtr, clazz);
+		}
 		scanMixedObjectSlots(env, reservingContext, objectPtr, reason);
 		break;
 	case GC_ObjectModel::SCAN_OWNABLESYNCHRONIZER_OBJECT:
@@ -3056,6 +3070,44 @@ MM_CopyForwardScheme::scanObject(MM_EnvironmentVLHGC *env, MM_AllocationContextT
 	}
 }
 
+MMINLINE void
+MM_CopyForwardScheme::rememberStringDeduplicationCandidate(MM_EnvironmentVLHGC *env, J9Object *objectPtr, J9Class *clazz)
+{
+	if ((NULL != _stringDeduplicator) && _stringDeduplicator->isStringClass(clazz)) {
+		MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(objectPtr);
+		if (region->getLogicalAge() >= _extensions->stringDeduplicationAge) {
+			_stringDeduplicator->addCandidate(objectPtr);
+		}
+	}
+}
+
+void
+MM_CopyForwardScheme::deduplicateStrings(MM_EnvironmentVLHGC *env)
+{
+	uintptr_t candidateCount = _stringDeduplicator->getCandidateCount();
+	for (uintptr_t base = 0; base < candidateCount; base += MM_StringDeduplicator::CANDIDATES_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t top = OMR_MIN(base + MM_StringDeduplicator::CANDIDATES_PER_WORK_UNIT, candidateCount);
+			for (uintptr_t index = base; index < top; index++) {
+				J9Object *string = _stringDeduplicator->getCandidate(index);
+				GC_SlotObject valueSlot(_javaVM->omrVM, J9GC_J9VMJAVALANGSTRING_VALUE_ADDRESS(env, string));
+				J9Object *array = valueSlot.readReferenceFromSlot();
+				if (NULL != array) {
+					/* the String has been scanned, so its value slot already refers to the final location of the array */
+					env->_copyForwardStats._stringDeduplicationCandidates += 1;
+					J9Object *canonicalArray = _stringDeduplicator->findCanonicalArray(env, array);
+					if (canonicalArray != array) {
+						valueSlot.writeReferenceToSlot(canonicalArray);
+						_interRegionRememberedSet->rememberReferenceForCopyForward(env, string, canonicalArray);
+						env->_copyForwardStats._stringDeduplicationShared += 1;
+						env->_copyForwardStats._stringDeduplicationBytesSaved += _extensions->indexableObjectModel.getSizeInBytesWithHeader((J9IndexableObject *)array);
+					}
+				}
+			}
+		}
+	}
+}
+
 MMINLINE void
 MM_CopyForwardScheme::updateScanStats(MM_EnvironmentVLHGC *env, J9Object *objectPtr, ScanReason reason)
 {
@@ -3310,6 +3362,10 @@ MM_CopyForwardScheme::incrementalScanCacheBySlot(MM_EnvironmentVLHGC *env)
 				case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
 				case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
 				case GC_ObjectModel::SCAN_MIXED_OBJECT:
+					if (!hasPartiallyScannedObject) {
+						rememberStringDeduplicationCandidate(env, objectPtr, J9GC_J9OBJECT_CLAZZ(objectPtr, env));
+					}
+					/* fall through */
 				case GC_ObjectModel::SCAN_OWNABLESYNCHRONIZER_OBJECT:
 				case GC_ObjectModel::SCAN_CONTINUATION_OBJECT:
 					hasPartiallyScannedObject = incrementalScanMixedObjectSlots(env, reservingContext, scanCache, objectPtr, hasPartiallyScannedObject, &nextScanCache);
@@ -4473,6 +4529,12 @@ MM_CopyForwardScheme::workThreadGarbageCollect(MM_EnvironmentVLHGC *env)
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
+	/* An aborted copy-forward recovers by scanning objects in place, so a queued String or its value slot may not be final; skip sharing this cycle */
+	if ((NULL != _stringDeduplicator) && !abortFlagRaised()) {
+		/* clearable processing may have scanned (and queued) resurrected objects; it is complete on all threads now */
+		deduplicateStrings(env);
+	}
+
 	if (!abortFlagRaised()) {
 		clearCardTableForPartialCollect(env);
 	}
@@ -57,6 +57,7 @@ class MM_InterRegionRememberedSet;
 class MM_MarkMap;
 class MM_MemoryPoolAddressOrderedList;
 class MM_ReferenceStats;
+class MM_StringDeduplicator;
 /* Forward declaration of classes defined within the cpp */
 class MM_CopyForwardSchemeAbortScanner;
 class MM_CopyForwardSchemeRootScanner;
@@ -147,6 +148,7 @@ private:
 	bool _dynamicClassUnloadingEnabled;  /**< Local cached value from cycle state for performance reasons (TODO: Reevaluate) */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	bool _collectStringConstantsEnabled;  /**< Local cached value which determines whether string constants are roots */
+	MM_StringDeduplicator *_stringDeduplicator; /**< String deduplicator for this cycle (NULL if disabled or a GMP is in progress) */
 
 	bool _tracingEnabled;  /**< Temporary variable to enable tracing of activity */
 	MM_AllocationContextTarok *_commonContext;	/**< The common context is used as an opaque token to represent cases where we don't want to relocate objects during NUMA-aware copy-forward since relocating to the common context is currently disabled */
@@ -666,6 +668,21 @@ private:
 	 */
 	MMINLINE void scanObject(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, ScanReason reason);
 
+	/**
+	 * Queue the given object for String deduplication if it is an old enough String.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] a live object being scanned for the first time, in its final location for this cycle
+	 * @param clazz[in] the class of objectPtr
+	 */
+	MMINLINE void rememberStringDeduplicationCandidate(MM_EnvironmentVLHGC *env, J9Object *objectPtr, J9Class *clazz);
+
+	/**
+	 * Share identical backing arrays between the String deduplication candidates queued during this cycle.
+	 * Must be called by all GC threads once scanning, including clearable processing, is complete.
+	 * @param env[in] the current thread
+	 */
+	void deduplicateStrings(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Update scan for abort phase (workstack phase)
 	 * @param env[in] the current thread
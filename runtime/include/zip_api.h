@@ -52,6 +52,10 @@ extern "C" {
 /* Accept the file as a zip file even if it does not start with a local header */
 #define J9ZIP_OPEN_ALLOW_NONSTANDARD_ZIP 2
 
+/* Map the file read-only when a new cache is built and serve directory scans and entry data from the mapping.
+ * The file is read through the file descriptor if it cannot be mapped.  Only used when a cache pool is supplied. */
+#define J9ZIP_OPEN_MAP_FILE 4
+
 /* Empty set of options */
 #define J9ZIP_GETENTRY_NO_FLAGS 0
 
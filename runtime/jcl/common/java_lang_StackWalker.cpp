@@ -272,7 +272,7 @@ Java_java_lang_StackWalker_getImpl(JNIEnv *env, jobject clazz, jlong walkStateP)
 
 			result = vmFuncs->j9jni_createLocalRef(env, frame);
 			UDATA bytecodeOffset = walkState->bytecodePCOffset; /* need this for StackFrame */
-			UDATA lineNumber = getLineNumberForROMClassFromROMMethod(vm, romMethod, romClass, classLoader, bytecodeOffset);
+			UDATA lineNumber = vmFuncs->getLineNumberForStackWalkFrame(walkState, romMethod, romClass, classLoader);
 			PUSH_OBJECT_IN_SPECIAL_FRAME(vmThread, frame);
 
 			/* set the class object if requested */
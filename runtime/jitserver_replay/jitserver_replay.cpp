@@ -0,0 +1,628 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * jitserver_replay: drive a JITServer with compilation traffic recorded by a client
+ * started with -XX:JITServerRecordTraffic=<file>, without running the client JVM.
+ *
+ * Each simulated client opens its own connection and session with the server and replays
+ * the recorded compilations one after the other. The compilation requests are sent as
+ * recorded, except for the client UID and the sequence numbers. The queries sent back
+ * by the server are answered with the response the client gave to the same query
+ * when the traffic was recorded.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <errno.h>
+#include <map>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <random>
+#include <stdio.h>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "net/MessageTypes.hpp"
+#include "net/TrafficRecord.hpp"
+
+using namespace JITServer;
+
+namespace {
+
+typedef TrafficRecordMessageHeader MessageHeader;
+typedef TrafficRecordDataDescriptor DataDescriptor;
+
+static const uint32_t CAPABILITIES_MASK = 0xFFFF0000; // JITServerCapabilitiesMask
+static const uint32_t COMPRESSED_MESSAGE_FLAG = 0x80000000; // CommunicationStream::COMPRESSED_MESSAGE_FLAG
+
+// Data points of the compilation request rewritten for each replayed compilation
+enum CompilationRequestDataPoint {
+    REQUEST_CLIENT_UID = 0,
+    REQUEST_SEQ_NO = 1,
+    REQUEST_CRITICAL_SEQ_NO = 2,
+};
+
+struct RecordedMessage {
+    const char *_data;
+    uint32_t _size;
+
+    MessageType type() const { return ((const MessageHeader *)_data)->_type; }
+};
+
+// A query sent by the server and the response the client gave to it
+struct RecordedExchange {
+    RecordedMessage _query;
+    RecordedMessage _response;
+};
+
+struct RecordedCompilation {
+    RecordedMessage _request;
+    std::vector<RecordedExchange> _exchanges;
+    MessageType _finalType;
+    uint32_t _seqNo;
+    uint32_t _criticalSeqNo;
+};
+
+struct ReplayOptions {
+    const char *_fileName = NULL;
+    std::string _address = "localhost";
+    uint32_t _port = 38400;
+    uint32_t _timeoutMs = 30000;
+    uint32_t _numClients = 1;
+    uint32_t _numIterations = 1;
+    long _serverPid = 0;
+};
+
+struct ReplayStats {
+    uint64_t _numSucceeded = 0; // The server sent code or an AOT method
+    uint64_t _numFailed = 0; // The server sent a compilation failure
+    uint64_t _numUnmatched = 0; // The server sent a query that was not part of the recording
+    uint64_t _numErrors = 0; // Connection or protocol errors
+    std::vector<uint64_t> _latenciesUs;
+};
+
+void fatal(const char *format, const char *arg)
+{
+    fprintf(stderr, "jitserver_replay: ");
+    fprintf(stderr, format, arg);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+DataDescriptor *getDescriptor(char *message, uint32_t index)
+{
+    DataDescriptor *desc = (DataDescriptor *)(message + sizeof(MessageHeader));
+    for (uint32_t i = 0; i < index; ++i)
+        desc = (DataDescriptor *)((char *)(desc + 1) + desc->_size);
+    return desc;
+}
+
+template<typename T> T getDataPoint(const char *message, uint32_t index)
+{
+    DataDescriptor *desc = getDescriptor(const_cast<char *>(message), index);
+    T value;
+    memcpy(&value, (char *)(desc + 1) + desc->_dataOffset, sizeof(T));
+    return value;
+}
+
+template<typename T> void setDataPoint(char *message, uint32_t index, T value)
+{
+    DataDescriptor *desc = getDescriptor(message, index);
+    memcpy((char *)(desc + 1) + desc->_dataOffset, &value, sizeof(T));
+}
+
+bool isFinalResponse(MessageType type)
+{
+    switch (type) {
+        case MessageType::compilationCode:
+        case MessageType::compilationFailure:
+        case MessageType::AOTCache_storedAOTMethod:
+        case MessageType::AOTCache_serializedAOTMethod:
+        case MessageType::AOTCache_failure:
+        case MessageType::compilationThreadCrashed:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isSuccessfulResponse(MessageType type)
+{
+    return (MessageType::compilationCode == type) || (MessageType::AOTCache_storedAOTMethod == type)
+        || (MessageType::AOTCache_serializedAOTMethod == type);
+}
+
+// Compare two messages, ignoring the version and configuration in their metadata
+bool sameMessage(const char *message1, uint32_t size1, const char *message2, uint32_t size2)
+{
+    size_t start = offsetof(MessageHeader, _type);
+    return (size1 == size2) && (0 == memcmp(message1 + start, message2 + start, size1 - start));
+}
+
+class Recording {
+public:
+    void load(const char *fileName);
+
+    const TrafficRecordHeader &header() const { return _header; }
+
+    const std::vector<RecordedCompilation> &compilations() const { return _compilations; }
+
+private:
+    TrafficRecordHeader _header;
+    std::vector<char> _data;
+    std::vector<RecordedCompilation> _compilations;
+};
+
+void Recording::load(const char *fileName)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (!file)
+        fatal("Cannot open %s", fileName);
+    if ((1 != fread(&_header, sizeof(_header), 1, file))
+        || (0 != memcmp(_header._eyeCatcher, TRAFFIC_RECORD_EYECATCHER, sizeof(_header._eyeCatcher))))
+        fatal("%s is not a JITServer traffic recording", fileName);
+    if (TRAFFIC_RECORD_FORMAT_VERSION != _header._formatVersion)
+        fatal("Unsupported format version of %s", fileName);
+    if (sizeof(void *) != _header._pointerSize)
+        fatal("%s was recorded on a platform with a different pointer size", fileName);
+
+    char buffer[64 * 1024];
+    size_t bytesRead;
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        _data.insert(_data.end(), buffer, buffer + bytesRead);
+    fclose(file);
+
+    // Split the compilations into the request, the exchanges and the final response
+    size_t offset = 0;
+    while (offset + sizeof(TrafficRecordCompilation) <= _data.size()) {
+        TrafficRecordCompilation compilation;
+        memcpy(&compilation, &_data[offset], sizeof(compilation));
+        offset += sizeof(compilation);
+        size_t end = offset + compilation._size;
+        if (end > _data.size())
+            break; // Truncated recording
+
+        RecordedCompilation replayed;
+        bool valid = true;
+        bool haveQuery = false;
+        RecordedMessage query;
+        for (uint32_t i = 0; valid && (i < compilation._numMessages); ++i) {
+            uint32_t direction;
+            RecordedMessage message;
+            memcpy(&direction, &_data[offset], sizeof(direction));
+            message._data = &_data[offset + sizeof(direction)];
+            memcpy(&message._size, message._data, sizeof(message._size));
+            offset += sizeof(direction) + message._size;
+            if ((message._size < sizeof(MessageHeader)) || (offset > end)) {
+                valid = false;
+            } else if (0 == i) {
+                valid = (FROM_CLIENT == direction) && (MessageType::compilationRequest == message.type());
+                replayed._request = message;
+            } else if (FROM_SERVER == direction) {
+                query = message;
+                haveQuery = true;
+            } else if (haveQuery) {
+                replayed._exchanges.push_back({ query, message });
+                haveQuery = false;
+            }
+        }
+        if (valid && haveQuery && isFinalResponse(query.type())) {
+            replayed._finalType = query.type();
+            replayed._seqNo = getDataPoint<uint32_t>(replayed._request._data, REQUEST_SEQ_NO);
+            replayed._criticalSeqNo = getDataPoint<uint32_t>(replayed._request._data, REQUEST_CRITICAL_SEQ_NO);
+            _compilations.push_back(replayed);
+        }
+        offset = end;
+    }
+}
+
+/**
+   @brief A simulated client replaying the recorded compilations over its own connection
+
+   Every iteration over the recording uses a new client session, so that the server
+   does not reuse the information it cached during the previous iterations.
+*/
+class ReplayClient {
+public:
+    ReplayClient(const Recording &recording, const ReplayOptions &options)
+        : _recording(recording)
+        , _options(options)
+        , _fd(-1)
+        , _isNewConnection(false)
+    {}
+
+    ~ReplayClient() { disconnect(); }
+
+    void run(ReplayStats &stats);
+
+private:
+    void replayCompilation(const RecordedCompilation &compilation, ReplayStats &stats);
+
+    uint32_t mapCriticalSeqNo(uint32_t recordedCriticalSeqNo) const;
+
+    void connect();
+    void disconnect();
+    void sendMessage(const char *data, uint32_t size);
+    void receiveMessage(std::string &message);
+    void sendClientSessionTerminate();
+
+    const Recording &_recording;
+    const ReplayOptions &_options;
+    int _fd;
+    bool _isNewConnection;
+    uint64_t _clientUID;
+    uint32_t _seqNo;
+    std::map<uint32_t, uint32_t> _replayedSeqNos; // Recorded seqNo -> replayed seqNo
+    std::string _sendBuffer;
+    std::string _receiveBuffer;
+};
+
+void ReplayClient::run(ReplayStats &stats)
+{
+    std::random_device random;
+    for (uint32_t iteration = 0; iteration < _options._numIterations; ++iteration) {
+        do {
+            _clientUID = ((uint64_t)random() << 32) | random();
+        } while (0 == _clientUID);
+        _seqNo = 0;
+        _replayedSeqNos.clear();
+
+        for (const RecordedCompilation &compilation : _recording.compilations())
+            replayCompilation(compilation, stats);
+
+        try {
+            sendClientSessionTerminate();
+        } catch (const std::exception &e) {
+            stats._numErrors++;
+            disconnect();
+        }
+    }
+    disconnect();
+}
+
+uint32_t ReplayClient::mapCriticalSeqNo(uint32_t recordedCriticalSeqNo) const
+{
+    if (0 == recordedCriticalSeqNo)
+        return 0;
+    // The request the compilation depends on may not have been recorded (e.g. it was interrupted);
+    // depend on the latest replayed request that precedes it instead
+    auto it = _replayedSeqNos.upper_bound(recordedCriticalSeqNo);
+    if (it == _replayedSeqNos.begin())
+        return 0;
+    return (--it)->second;
+}
+
+void ReplayClient::replayCompilation(const RecordedCompilation &compilation, ReplayStats &stats)
+{
+    uint32_t seqNo = ++_seqNo;
+    uint32_t criticalSeqNo = mapCriticalSeqNo(compilation._criticalSeqNo);
+    _replayedSeqNos[compilation._seqNo] = seqNo;
+
+    _sendBuffer.assign(compilation._request._data, compilation._request._size);
+    setDataPoint<uint64_t>(&_sendBuffer[0], REQUEST_CLIENT_UID, _clientUID);
+    setDataPoint<uint32_t>(&_sendBuffer[0], REQUEST_SEQ_NO, seqNo);
+    setDataPoint<uint32_t>(&_sendBuffer[0], REQUEST_CRITICAL_SEQ_NO, criticalSeqNo);
+
+    std::vector<bool> used(compilation._exchanges.size(), false);
+    auto start = std::chrono::steady_clock::now();
+    try {
+        sendMessage(_sendBuffer.data(), _sendBuffer.size());
+        while (true) {
+            receiveMessage(_receiveBuffer);
+            const MessageHeader *query = (const MessageHeader *)_receiveBuffer.data();
+            if (isFinalResponse(query->_type)) {
+                if (isSuccessfulResponse(query->_type))
+                    stats._numSucceeded++;
+                else
+                    stats._numFailed++;
+                break;
+            }
+
+            // Prefer the recorded query with identical contents, then any query of the same type
+            size_t match = compilation._exchanges.size();
+            for (size_t i = 0; i < compilation._exchanges.size(); ++i) {
+                const RecordedMessage &recorded = compilation._exchanges[i]._query;
+                if (used[i] || (recorded.type() != query->_type))
+                    continue;
+                if (sameMessage(recorded._data, recorded._size, _receiveBuffer.data(), _receiveBuffer.size())) {
+                    match = i;
+                    break;
+                }
+                if (match == compilation._exchanges.size())
+                    match = i;
+            }
+            if (match == compilation._exchanges.size()) {
+                // The server is waiting for an answer that cannot be given; abandon the connection
+                stats._numUnmatched++;
+                disconnect();
+                return;
+            }
+            used[match] = true;
+            const RecordedMessage &response = compilation._exchanges[match]._response;
+            sendMessage(response._data, response._size);
+        }
+    } catch (const std::exception &e) {
+        stats._numErrors++;
+        disconnect();
+        return;
+    }
+    auto end = std::chrono::steady_clock::now();
+    stats._latenciesUs.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
+void ReplayClient::connect()
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    std::string portName = std::to_string(_options._port);
+    struct addrinfo *addrList = NULL;
+    int res = getaddrinfo(_options._address.c_str(), portName.c_str(), &hints, &addrList);
+    if (res != 0)
+        throw std::runtime_error("Cannot resolve server name: " + std::string(gai_strerror(res)));
+
+    int fd = socket(addrList->ai_family, addrList->ai_socktype, addrList->ai_protocol);
+    if (fd < 0) {
+        freeaddrinfo(addrList);
+        throw std::runtime_error("Cannot create socket: " + std::string(strerror(errno)));
+    }
+    int flag = 1;
+    struct timeval timeout = { _options._timeoutMs / 1000, (_options._timeoutMs % 1000) * 1000 };
+    if ((setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag)) < 0)
+        || (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0)
+        || (setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) < 0)
+        || (::connect(fd, addrList->ai_addr, addrList->ai_addrlen) < 0)) {
+        int err = errno;
+        freeaddrinfo(addrList);
+        close(fd);
+        throw std::runtime_error("Connect failed: " + std::string(strerror(err)));
+    }
+    freeaddrinfo(addrList);
+    _fd = fd;
+    _isNewConnection = true;
+}
+
+void ReplayClient::disconnect()
+{
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+void ReplayClient::sendMessage(const char *data, uint32_t size)
+{
+    if (_fd < 0)
+        connect();
+
+    // Only the first message on a connection carries the version, which the server checks.
+    // Capabilities such as compression are never requested, since the replay does not implement them.
+    MessageHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (_isNewConnection) {
+        header._version = (uint32_t)_recording.header()._fullVersion;
+        header._config = (uint32_t)(_recording.header()._fullVersion >> 32) & ~CAPABILITIES_MASK;
+        _isNewConnection = false;
+    } else {
+        header._version = 0;
+        header._config = 0;
+    }
+
+    struct Part {
+        const char *_data;
+        size_t _size;
+    } parts[] = {
+        { (const char *)&header, sizeof(header) },
+        { data + sizeof(header), size - sizeof(header) },
+    };
+    for (auto &part : parts) {
+        size_t written = 0;
+        while (written < part._size) {
+            ssize_t n = ::write(_fd, part._data + written, part._size - written);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                throw std::runtime_error("Write failed: " + std::string(strerror(errno)));
+            written += n;
+        }
+    }
+}
+
+void ReplayClient::receiveMessage(std::string &message)
+{
+    auto readFully = [this](char *buffer, size_t size) {
+        size_t bytesRead = 0;
+        while (bytesRead < size) {
+            ssize_t n = ::read(_fd, buffer + bytesRead, size - bytesRead);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                throw std::runtime_error("Read failed");
+            bytesRead += n;
+        }
+    };
+
+    uint32_t size;
+    readFully((char *)&size, sizeof(size));
+    if (size & COMPRESSED_MESSAGE_FLAG)
+        throw std::runtime_error("Unexpected compressed message");
+    if (size < sizeof(MessageHeader))
+        throw std::runtime_error("Message too small");
+    message.resize(size);
+    memcpy(&message[0], &size, sizeof(size));
+    readFully(&message[sizeof(size)], size - sizeof(size));
+}
+
+void ReplayClient::sendClientSessionTerminate()
+{
+    struct {
+        MessageHeader _header;
+        DataDescriptor _desc;
+        uint64_t _clientUID;
+    } message;
+    static_assert(sizeof(message) == 32, "Unexpected layout of clientSessionTerminate");
+
+    memset(&message, 0, sizeof(message));
+    message._header._size = sizeof(message);
+    message._header._type = MessageType::clientSessionTerminate;
+    message._header._numDataPoints = 1;
+    message._desc._type = TRAFFIC_RECORD_DATA_TYPE_UINT64;
+    message._desc._size = sizeof(message._clientUID);
+    message._clientUID = _clientUID;
+    sendMessage((const char *)&message, sizeof(message));
+}
+
+// Resident set size of a process in KB, or 0 if it cannot be determined
+uint64_t getResidentSetSizeKB(long pid)
+{
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "/proc/%ld/status", pid);
+    FILE *file = fopen(fileName, "r");
+    if (!file)
+        return 0;
+    char line[256];
+    unsigned long long rss = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (1 == sscanf(line, "VmRSS: %llu kB", &rss))
+            break;
+    }
+    fclose(file);
+    return rss;
+}
+
+void printUsage()
+{
+    fprintf(stderr,
+        "Usage: jitserver_replay -file <recording> [options]\n"
+        "  -address <host>    JITServer address (default localhost)\n"
+        "  -port <port>       JITServer port (default 38400)\n"
+        "  -timeout <ms>      socket timeout (default 30000)\n"
+        "  -clients <n>       number of simulated clients replaying concurrently (default 1)\n"
+        "  -iterations <n>    number of times each client replays the recording (default 1)\n"
+        "  -pid <pid>         report the resident memory of the JITServer process with this pid\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ReplayOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!value) {
+            printUsage();
+            return 1;
+        }
+        if (0 == strcmp(arg, "-file"))
+            options._fileName = value;
+        else if (0 == strcmp(arg, "-address"))
+            options._address = value;
+        else if (0 == strcmp(arg, "-port"))
+            options._port = strtoul(value, NULL, 10);
+        else if (0 == strcmp(arg, "-timeout"))
+            options._timeoutMs = strtoul(value, NULL, 10);
+        else if (0 == strcmp(arg, "-clients"))
+            options._numClients = std::max(1UL, strtoul(value, NULL, 10));
+        else if (0 == strcmp(arg, "-iterations"))
+            options._numIterations = std::max(1UL, strtoul(value, NULL, 10));
+        else if (0 == strcmp(arg, "-pid"))
+            options._serverPid = strtol(value, NULL, 10);
+        else {
+            printUsage();
+            return 1;
+        }
+        ++i;
+    }
+    if (!options._fileName) {
+        printUsage();
+        return 1;
+    }
+
+    Recording recording;
+    recording.load(options._fileName);
+    if (recording.compilations().empty())
+        fatal("No complete compilation found in %s", options._fileName);
+    printf("Loaded %zu compilations recorded by client %llu\n", recording.compilations().size(),
+        (unsigned long long)recording.header()._clientUID);
+
+    uint64_t rssBeforeKB = options._serverPid ? getResidentSetSizeKB(options._serverPid) : 0;
+
+    std::vector<ReplayStats> stats(options._numClients);
+    std::vector<std::thread> clients;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options._numClients; ++i) {
+        clients.emplace_back([&recording, &options, &stats, i]() {
+            ReplayClient client(recording, options);
+            client.run(stats[i]);
+        });
+    }
+    for (auto &client : clients)
+        client.join();
+    double elapsedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ReplayStats total;
+    for (auto &s : stats) {
+        total._numSucceeded += s._numSucceeded;
+        total._numFailed += s._numFailed;
+        total._numUnmatched += s._numUnmatched;
+        total._numErrors += s._numErrors;
+        total._latenciesUs.insert(total._latenciesUs.end(), s._latenciesUs.begin(), s._latenciesUs.end());
+    }
+    std::sort(total._latenciesUs.begin(), total._latenciesUs.end());
+
+    uint64_t numCompleted = total._latenciesUs.size();
+    printf("Clients: %u Iterations: %u Elapsed: %.3f s\n", options._numClients, options._numIterations, elapsedSec);
+    printf("Compilations: succeeded=%llu failed=%llu unmatched=%llu errors=%llu\n",
+        (unsigned long long)total._numSucceeded, (unsigned long long)total._numFailed,
+        (unsigned long long)total._numUnmatched, (unsigned long long)total._numErrors);
+    if (numCompleted > 0) {
+        uint64_t sum = 0;
+        for (uint64_t latency : total._latenciesUs)
+            sum += latency;
+        printf("Throughput: %.1f compilations/s\n", numCompleted / elapsedSec);
+        printf("Latency (us): mean=%llu p50=%llu p90=%llu p99=%llu max=%llu\n",
+            (unsigned long long)(sum / numCompleted), (unsigned long long)total._latenciesUs[numCompleted / 2],
+            (unsigned long long)total._latenciesUs[numCompleted * 9 / 10],
+            (unsigned long long)total._latenciesUs[numCompleted * 99 / 100],
+            (unsigned long long)total._latenciesUs.back());
+    }
+    if (options._serverPid) {
+        uint64_t rssAfterKB = getResidentSetSizeKB(options._serverPid);
+        printf("Server RSS (KB): before=%llu after=%llu\n", (unsigned long long)rssBeforeKB,
+            (unsigned long long)rssAfterKB);
+    }
+
+    return ((total._numErrors > 0) || (total._numUnmatched > 0)) ? 1 : 0;
+}
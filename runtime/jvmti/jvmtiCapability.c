@@ -411,7 +411,7 @@ jvmtiAddCapabilities(jvmtiEnv* env,
 			/* Initial sampling interval is MM_GCExtensions::objectSamplingBytesGranularity which is UDATA_MAX(SAMPLED_OBJECT_ALLOC is disabled) by default.
 			 * Set it to 512KB which is default sampling interval as per JEP 331 specification for enabling jvmti SAMPLED_OBJECT_ALLOC.
 			 */
-			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, 512 * 1024);
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, 512 * 1024);
 			jvmtiData->flags |= J9JVMTI_FLAG_SAMPLED_OBJECT_ALLOC_ENABLED;
 		}
 #endif /* JAVA_SPEC_VERSION >= 11 */
@@ -507,8 +507,8 @@ jvmtiRelinquishCapabilities(jvmtiEnv* env,
 #if JAVA_SPEC_VERSION >= 11
 		if (capabilities_ptr->can_generate_sampled_object_alloc_events) {
 			jvmtiData->flags &= ~J9JVMTI_FLAG_SAMPLED_OBJECT_ALLOC_ENABLED;
-			/* Set sampling interval to UDATA_MAX to inform GC that sampling is not required */
-			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, UDATA_MAX);
+			/* Set sampling interval to UDATA_MAX to inform GC that JVMTI no longer requires sampling */
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, UDATA_MAX);
 		}
 #endif /* JAVA_SPEC_VERSION >= 11 */
 
@@ -186,8 +186,8 @@ jvmtiSetEventNotificationMode(jvmtiEnv* env,
 #if JAVA_SPEC_VERSION >= 11
 		else if (JVMTI_DISABLE == mode) {
 			if (JVMTI_EVENT_SAMPLED_OBJECT_ALLOC == event_type) {
-				/* Set sampling interval to UDATA_MAX to inform GC that sampling is not required */
-				vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, UDATA_MAX);
+				/* Set sampling interval to UDATA_MAX to inform GC that JVMTI no longer requires sampling */
+				vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, UDATA_MAX);
 			}
 		}
 #endif /* JAVA_SPEC_VERSION >= 11 */
@@ -2424,15 +2424,15 @@ jvmtiRemoveAllTags(jvmtiEnv* jvmti_env, ...)
 	Trc_JVMTI_jvmtiRemoveAllTags_Entry(jvmti_env);
 
 	/* Ensure exclusive access to tag table */
-	omrthread_monitor_enter(j9env->mutex);
+	omrthread_rwmutex_enter_write(j9env->objectTagTableMutex);
 
 	if (j9env->objectTagTable != NULL) {
 		hashTableFree(j9env->objectTagTable);
-		j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(j9env->vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, hashFn, hashEqualFn, NULL, NULL);
+		j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(j9env->vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, hashFn, hashEqualFn, NULL, j9env->vm);
 		rc = JVMTI_ERROR_NONE;
 	}
 
-	omrthread_monitor_exit(j9env->mutex);
+	omrthread_rwmutex_exit_write(j9env->objectTagTableMutex);
 
 	TRACE_JVMTI_RETURN(jvmtiRemoveAllTags);
 }
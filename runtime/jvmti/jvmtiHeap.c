@@ -188,15 +188,15 @@ jvmtiGetTag(jvmtiEnv* env,
 
 		if ( entry.ref ) {
 
-			/* Ensure exclusive access to tag table */
-			omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+			/* Lookups may run concurrently, only updates need exclusive access to the tag table */
+			omrthread_rwmutex_enter_read(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 			objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
 			if (objectTag) {
 				rv_tag = objectTag->tag;
 			}
 
-			omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+			omrthread_rwmutex_exit_read(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 		} else {
 			rc = JVMTI_ERROR_INVALID_OBJECT;
@@ -242,7 +242,7 @@ jvmtiSetTag(jvmtiEnv* env,
 		if ( entry.ref ) {
 
 			/* Ensure exclusive access to tag table */
-			omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+			omrthread_rwmutex_enter_write(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 			objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
 			if (objectTag) {
@@ -253,13 +253,13 @@ jvmtiSetTag(jvmtiEnv* env,
 				}
 			} else {
 				if (tag) {
-					if ( hashTableAdd(((J9JVMTIEnv *)env)->objectTagTable, &entry) == NULL ) {
+					if ( addObjectTag((J9JVMTIEnv *)env, &entry) == NULL ) {
 						rc = JVMTI_ERROR_OUT_OF_MEMORY;
 					}
 				}
 			}
 
-			omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+			omrthread_rwmutex_exit_write(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 		} else {
 			rc = JVMTI_ERROR_INVALID_OBJECT;
@@ -346,8 +346,8 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 			}
 		}
 
-		/* Ensure exclusive access to tag table */
-		omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+		/* The tag table is only read, other lookups may run concurrently */
+		omrthread_rwmutex_enter_read(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 		memset(&results, 0, sizeof(J9JVMTIObjectTagMatch));
 
@@ -394,7 +394,7 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 			j9mem_free_memory(results.tags);
 		}
 
-		omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+		omrthread_rwmutex_exit_read(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 done:
 		vm->internalVMFunctions->internalExitVMToJNI(currentThread);
@@ -2029,7 +2029,7 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 			/* now tagged, add table entry */
 			entry.ref = object;
 			entry.tag = newTag;
-			resultTag = hashTableAdd(iteratorData->env->objectTagTable, &entry);
+			resultTag = addObjectTag(iteratorData->env, &entry);
 			*originalTag = resultTag->tag;
 		}
 	}
@@ -578,7 +578,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 					/* now tagged, add table entry */
 					entry.ref = object;
 					entry.tag = tag;
-					hashTableAdd(iteratorData->env->objectTagTable, &entry);
+					addObjectTag(iteratorData->env, &entry);
 				}
 			}
 		
@@ -650,7 +650,7 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 		if ( &entry == result ) {
 			/* Tag wasn't set, but now is... */
 			if (result->tag != 0) {
-				hashTableAdd(iteratorData->env->objectTagTable, result);
+				addObjectTag(iteratorData->env, result);
 			}
 		} else {
 			/* Tag was set, but now isn't... */
@@ -165,8 +165,8 @@ disposeEnvironment(J9JVMTIEnv * j9env, UDATA freeData)
 #if JAVA_SPEC_VERSION >= 11
 		if (j9env->capabilities.can_generate_sampled_object_alloc_events) {
 			J9JVMTI_DATA_FROM_VM(vm)->flags &= ~J9JVMTI_FLAG_SAMPLED_OBJECT_ALLOC_ENABLED;
-			/* Set sampling interval to UDATA_MAX to inform GC that sampling is not required */
-			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, UDATA_MAX);
+			/* Set sampling interval to UDATA_MAX to inform GC that JVMTI no longer requires sampling */
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, UDATA_MAX);
 		}
 #endif /* JAVA_SPEC_VERSION >= 11 */
 
@@ -227,6 +227,11 @@ disposeEnvironment(J9JVMTIEnv * j9env, UDATA freeData)
 			j9env->objectTagTable = NULL;
 		}
 
+		if (NULL != j9env->objectTagTableMutex) {
+			omrthread_rwmutex_destroy(j9env->objectTagTableMutex);
+			j9env->objectTagTableMutex = NULL;
+		}
+
 		if (NULL != j9env->watchedClasses) {
 			J9HashTableState walkState;
 			J9JVMTIWatchedClass *watchedClass = (J9JVMTIWatchedClass*)hashTableStartDo(j9env->watchedClasses, &walkState);
@@ -318,11 +323,14 @@ allocateEnvironment(J9InvocationJavaVM * invocationJavaVM, jint version, void **
 			if (omrthread_monitor_init(&(j9env->threadDataPoolMutex), 0) != 0) {
 				goto fail;
 			}
+			if (omrthread_rwmutex_init(&(j9env->objectTagTableMutex), 0, "JVMTI object tag table mutex") != 0) {
+				goto fail;
+			}
 			j9env->threadDataPool = pool_new(sizeof(J9JVMTIThreadData), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_JVMTI, POOL_FOR_PORT(vm->portLibrary));
 			if (j9env->threadDataPool == NULL) {
 				goto fail;
 			}
-			j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0, J9MEM_CATEGORY_JVMTI, hashObjectTag, hashEqualObjectTag, NULL, NULL);
+			j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0, J9MEM_CATEGORY_JVMTI, hashObjectTag, hashEqualObjectTag, NULL, vm);
 			if (j9env->objectTagTable == NULL) {
 				goto fail;
 			}
@@ -930,10 +938,32 @@ getCurrentClass(J9Class * clazz)
 
 
 
+/*
+ * The object tag table is keyed by identity hash code rather than by address, so that the
+ * entries stay valid when the GC moves the tagged objects. Tagging an object assigns its
+ * identity hash (see addObjectTag()). An object which has never been hashed cannot be in the
+ * table, and is not assigned a hash just to look it up (which would make it grow when it is
+ * moved): its lookup goes to the first bucket, where no entry matches it.
+ */
 static UDATA
 hashObjectTag(void *entry, void *userData)
 {
-	return ((UDATA) ((J9JVMTIObjectTag *) entry)->ref) / sizeof(UDATA);
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	j9object_t object = ((J9JVMTIObjectTag *) entry)->ref;
+	UDATA hash = 0;
+
+	if (J9_ARE_ANY_BITS_SET(J9OBJECT_FLAGS_FROM_CLAZZ_VM(vm, object), OBJECT_HEADER_HAS_BEEN_HASHED_MASK_IN_CLASS)) {
+		hash = (UDATA)(U_32)objectHashCode(vm, object);
+	}
+	return hash;
+}
+
+J9JVMTIObjectTag *
+addObjectTag(J9JVMTIEnv *j9env, J9JVMTIObjectTag *entry)
+{
+	/* Assign the identity hash first, so that the entry is added to the bucket where lookups will find it */
+	objectHashCode(j9env->vm, entry->ref);
+	return (J9JVMTIObjectTag *)hashTableAdd(j9env->objectTagTable, entry);
 }
 
 
@@ -2400,7 +2400,6 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 	J9JVMTIObjectTag * taggedObject;
 	J9HashTableState hashState;
 	UDATA phase = J9JVMTI_DATA_FROM_ENV(j9env)->phase;
-	J9JVMTIObjectTag * deletedHead = NULL;
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	J9VMThread * currentThread = NULL;
 	UDATA javaOffloadOldState = 0;
@@ -2416,24 +2415,12 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 
 	Trc_JVMTI_jvmtiHookGCEnd_Entry();
 
-	/* Link all NULLed entries */
-
-	taggedObject = hashTableStartDo(j9env->objectTagTable, &hashState);
-	while (taggedObject != NULL) {
-		if (taggedObject->ref == NULL) {
-			taggedObject->ref = (j9object_t) deletedHead;
-			deletedHead = (J9JVMTIObjectTag *) taggedObject;
-		}
-		taggedObject = hashTableNextDo(&hashState);
-	}
-
-	/* Rehash the object tag table for this environment */
-
-	hashTableRehash(j9env->objectTagTable);
-
-	/* Remove freed objects from the tag table - report events if need be */
+	/* Remove freed objects from the tag table - report events if need be.
+	 * The table is keyed by identity hash code, so the entries of the objects
+	 * moved by the GC remain valid without rehashing the table.
+	 */
 
-	if (deletedHead != NULL) {
+	if (0 != hashTableGetCount(j9env->objectTagTable)) {
 		jvmtiEventObjectFree objectFreeCallback = j9env->callbacks.ObjectFree;
 		UDATA reportObjectFreeEvents;
 
@@ -2441,26 +2428,31 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 			(phase == JVMTI_PHASE_LIVE) &&
 			(objectFreeCallback != NULL) &&
 			EVENT_IS_ENABLED(JVMTI_EVENT_OBJECT_FREE, &(j9env->globalEventEnable));
-		do {
-			taggedObject = deletedHead;
-			if (reportObjectFreeEvents) {
+
+		taggedObject = hashTableStartDo(j9env->objectTagTable, &hashState);
+		while (taggedObject != NULL) {
+			if (taggedObject->ref == NULL) {
+				jlong tag = taggedObject->tag;
+
+				hashTableDoRemove(&hashState);
+				if (reportObjectFreeEvents) {
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
-				/* Jazz 99339: Switch away from the zAAP processor if running there */
-				if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
-					javaOffloadSwitchOff(j9env, currentThread, JVMTI_EVENT_OBJECT_FREE, &javaOffloadOldState);
-				}
+					/* Jazz 99339: Switch away from the zAAP processor if running there */
+					if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
+						javaOffloadSwitchOff(j9env, currentThread, JVMTI_EVENT_OBJECT_FREE, &javaOffloadOldState);
+					}
 #endif /* J9VM_OPT_JAVA_OFFLOAD_SUPPORT */
-				objectFreeCallback((jvmtiEnv *) j9env, taggedObject->tag);
+					objectFreeCallback((jvmtiEnv *) j9env, tag);
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
-				/* Jazz 99339: Switch onto the zAAP processor if not running there after native finishes running on GP */
-				if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
-					javaOffloadSwitchOn(currentThread, JVMTI_EVENT_OBJECT_FREE, javaOffloadOldState);
-				}
+					/* Jazz 99339: Switch onto the zAAP processor if not running there after native finishes running on GP */
+					if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
+						javaOffloadSwitchOn(currentThread, JVMTI_EVENT_OBJECT_FREE, javaOffloadOldState);
+					}
 #endif /* J9VM_OPT_JAVA_OFFLOAD_SUPPORT */
+				}
 			}
-			deletedHead = (J9JVMTIObjectTag *) taggedObject->ref;
-			hashTableRemove(j9env->objectTagTable, taggedObject);
-		} while (deletedHead != NULL);
+			taggedObject = hashTableNextDo(&hashState);
+		}
 	}
 
 	/* Call the event callback */
@@ -3251,7 +3243,11 @@ jvmtiHookSampledObjectAlloc(J9HookInterface** hook, UDATA eventNum, void* eventD
 
 	ENSURE_EVENT_PHASE_LIVE(jvmtiHookSampledObjectAlloc, j9env);
 
-	if ((NULL != callback) && shouldPostEvent(currentThread, NULL)) {
+	/* The GC also samples at the interval of other requesters, only post when the JVMTI interval has been reached */
+	if ((NULL != callback)
+		&& J9_ARE_ANY_BITS_SET(data->requesters, (UDATA)1 << J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI)
+		&& shouldPostEvent(currentThread, NULL)
+	) {
 		jthread threadRef = NULL;
 		UDATA hadVMAccess = 0;
 		UDATA javaOffloadOldState = 0;
@@ -95,7 +95,7 @@ jvmtiSetHeapSamplingInterval(jvmtiEnv *env,
 	ENSURE_NON_NEGATIVE(samplingInterval);
 
 	/* No negative samplingInterval, and there is no data lost when jint is casted to UDATA. */
-	vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, samplingInterval);
+	vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI, samplingInterval);
 
 done:
 	TRACE_JVMTI_RETURN(jvmtiSetHeapSamplingInterval);
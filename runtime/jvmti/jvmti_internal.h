@@ -1295,6 +1295,17 @@ void
 releaseVMThread(J9VMThread *currentThread, J9VMThread *targetThread, jthread thread);
 
 
+/**
+ * @brief Add an entry to the object tag table of an environment. The identity hash code of
+ * the object is assigned if necessary, as the table is keyed by it.
+ * @param j9env
+ * @param entry the object and its tag
+ * @return J9JVMTIObjectTag * the entry in the table, or NULL if out of memory
+ */
+J9JVMTIObjectTag *
+addObjectTag(J9JVMTIEnv *j9env, J9JVMTIObjectTag *entry);
+
+
 /**
 * @brief
 * @param j9env
@@ -381,6 +381,24 @@ jimageFreeResourceLocation(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourc
 I_32
 jimageGetResource(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, char *buffer, I_64 bufferSize, I_64 *resourceSize);
 
+/**
+ * Returns a pointer to the contents of the resource specified by given location in the jimage file
+ * without copying it, if the resource is stored uncompressed in a mapped jimage file.
+ * The data remains valid until the jimage file is closed and must not be modified.
+ *
+ * @param [in] jimageIntf pointer to J9JImageIntf
+ * @param [in] handle handle to the jimage file
+ * @param [in] resourceLocation location of the resource
+ * @param [out] data on success *data points to the contents of the resource, otherwise *data is set to NULL
+ * @param [out] resourceSize actual size of the resource
+ *
+ * @return J9JIMAGE_NO_ERROR if *data points to the resource contents;
+ * 		   J9JIMAGE_RESOURCE_NOT_MAPPED if the resource must be read using jimageGetResource();
+ * 		   negative error code in other cases
+ */
+I_32
+jimageGetResourceData(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, const U_8 **data, I_64 *resourceSize);
+
 #if JAVA_SPEC_VERSION < 26
 /**
  * Finds the module for the given package.
@@ -401,18 +419,20 @@ jimagePackageToModule(J9JImageIntf *jimageIntf, UDATA handle, const char *packag
  * This function loads jimage file specified by fileName. As part of loading it performs following operation:
  * 1) Open jimage file and read the header
  * 2) Verify header
- * 3) Memory map jimage file upto start of resources
+ * 3) Memory map the whole jimage file if mapResources is TRUE, or if that fails or mapResources is FALSE,
+ *    memory map jimage file upto start of resources
  * 4) Create J9JImage and J9JImageHeader structure and populate the fields
  *
  * @param [in] vm pointer to J9JavaVM
  * @param [in] fileName	name of jimage file
+ * @param [in] mapResources TRUE to map the resources along with the metadata so that they can be accessed in place
  * @param [out] pjimage	double pointer to J9JImage; on successful exit points to valid J9JImage
  *
  * @return if no error occurs returns J9JIMAGE_NO_ERROR and *pjimage points to a valid J9JImage,
  * 			otherwise returns negative value error code and *pjimage is set to NULL.
  */
 I_32
-j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, J9JImage **pjimage);
+j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, BOOLEAN mapResources, J9JImage **pjimage);
 
 /**
  * Dump information about jimage header and resources in a readable format.
@@ -476,6 +496,20 @@ j9bcutil_createAndVerifyJImageLocation(J9PortLibrary *portlib, J9JImage *jimage,
 I_32
 j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, void *dataBuffer, U_64 dataBufferSize);
 
+/**
+ * Returns a pointer to the resource data at offset J9JImageLocation->resourceOffset in the mapped jimage file.
+ * Only uncompressed resources of a jimage file that is mapped entirely can be accessed this way.
+ *
+ * @param [in] portlib pointer to J9PortLibrary
+ * @param [in] jimage pointer to J9JImage representing jimage file; must not be NULL
+ * @param [in] j9jimageLocation pointer to J9JImageLocation containing metadata of the resource
+ * @param [out] resourceData on success *resourceData points to J9JImageLocation->uncompressedSize bytes of resource data, otherwise it is set to NULL
+ *
+ * @return J9JIMAGE_NO_ERROR on success, J9JIMAGE_RESOURCE_NOT_MAPPED if the resource data is not available in the mapping
+ */
+I_32
+j9bcutil_getJImageResourceData(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, const U_8 **resourceData);
+
 /**
  * Returns name of the resource by concatenating module, parent, base and extension strings.
  *
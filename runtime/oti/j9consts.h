@@ -375,6 +375,10 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME3_DISCLAIM_RAM_CLASS_MEMORY 0x20
 #define J9_EXTENDED_RUNTIME3_USE_DEBUG_LOCAL_MAP 0x40
 #define J9_EXTENDED_RUNTIME3_JAVA_STACK_GUARD_PAGES 0x80
+#define J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES 0x100
+#define J9_EXTENDED_RUNTIME3_TRIM_CONTINUATION_STACKS 0x200
+#define J9_EXTENDED_RUNTIME3_PROFILE_GUIDED_FIELD_LAYOUT 0x400
+#define J9_EXTENDED_RUNTIME3_DECODED_FRAME_CACHE 0x800
 
 #define J9_OBJECT_HEADER_AGE_DEFAULT 0xA /* OBJECT_HEADER_AGE_DEFAULT */
 #define J9_OBJECT_HEADER_SHAPE_MASK 0xE /* OBJECT_HEADER_SHAPE_MASK */
@@ -384,6 +388,9 @@ extern "C" {
 #define J9_OBJECT_HEADER_INDEXABLE 0x400 /* OBJECT_HEADER_INDEXABLE_NHS */
 #define J9_OBJECT_HEADER_STACK_ALLOCATED 0x800 /* OBJECT_HEADER_STACK_ALLOCATED */
 
+/* The maximum count of the arguments of a downcall dispatched by compiled code, see invokeDowncallFromJIT() */
+#define J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT 16
+
 #define J9_STARTPC_NOT_TRANSLATED 0x1
 #define J9_STARTPC_JNI_NATIVE 0x1
 #define J9_STARTPC_METHOD_BREAKPOINTED 0x2
@@ -472,6 +479,11 @@ extern "C" {
 
 #define J9_GC_ARRAYLET_MINIMUM_ALIGNMENT 0x800
 
+/* Requesters of allocation sampling, see j9gc_set_allocation_sampling_interval() */
+#define J9_GC_ALLOCATION_SAMPLING_REQUESTER_JVMTI 0
+#define J9_GC_ALLOCATION_SAMPLING_REQUESTER_JFR 1
+#define J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT 2
+
 #define J9_GC_ALLOCATION_TYPE_ILLEGAL OMR_GC_ALLOCATION_TYPE_ILLEGAL
 #define J9_GC_ALLOCATION_TYPE_TLH OMR_GC_ALLOCATION_TYPE_TLH
 #define J9_GC_ALLOCATION_TYPE_SEGREGATED OMR_GC_ALLOCATION_TYPE_SEGREGATED
@@ -972,6 +984,7 @@ extern "C" {
 #define J9JFR_EVENT_TYPE_YOUNG_GC_ENTRY 14
 #define J9JFR_EVENT_TYPE_GARBAGE_COLLECTION_ENTRY 15
 #define J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY 16
+#define J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE 17
 
 /* JFR thread states. */
 
@@ -388,6 +388,15 @@ typedef struct J9JFRBuffer {
 	U_8 *bufferCurrent;
 } J9JFRBuffer;
 
+/* Precedes the events of each thread local JFR buffer. Full buffers are handed off
+ * to the JFR flusher thread through a lock-free list linked by this header.
+ */
+typedef struct J9JFRBufferHeader {
+	struct J9JFRBufferHeader *next;
+	struct J9VMThread *owner;
+	U_64 size;
+} J9JFRBufferHeader;
+
 /* JFR event structures */
 
 #define J9JFR_EVENT_COMMON_FIELDS \
@@ -544,6 +553,14 @@ typedef struct J9JFRGCHeapSummary {
 	I_64 heapUsed;
 } J9JFRGCHeapSummary;
 
+typedef struct J9JFRObjectAllocationSample {
+	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
+	struct J9Class *objectClass;
+	U_64 weight;
+} J9JFRObjectAllocationSample;
+
+#define J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRObjectAllocationSample *)(jfrEvent)) + 1))
+
 #endif /* defined(J9VM_OPT_JFR) */
 
 /* @ddr_namespace: map_to_type=J9CfrError */
@@ -967,6 +984,29 @@ typedef struct J9ClassHotFieldsInfo {
 	uint8_t hotFieldListLength;
 } J9ClassHotFieldsInfo;
 
+/* Instance field layout hint learned from hot field profiling and stored in the shared classes cache.
+ * The header is followed by (romFieldCount + 31) / 32 U_32s of bits; bit N is set if the Nth ROM field of the class is hot.
+ */
+typedef struct J9FieldLayoutHint {
+	U_32 romSize;
+	U_32 romFieldCount;
+} J9FieldLayoutHint;
+
+#define J9FIELDLAYOUTHINT_SIZE(romFieldCount) (sizeof(J9FieldLayoutHint) + ((((romFieldCount) + 31) / 32) * sizeof(U_32)))
+#define J9FIELDLAYOUTHINT_BITS(hint) ((U_32 *)((hint) + 1))
+#define J9FIELDLAYOUTHINT_IS_HOT(hint, index) (0 != (J9FIELDLAYOUTHINT_BITS(hint)[(index) / 32] & ((U_32)1 << ((index) % 32))))
+
+/* Entry in J9JavaVM->fieldLayoutHints, remembering the hint used for each ROM class laid out in this run */
+typedef struct J9FieldLayoutHintEntry {
+	struct J9ROMClass *romClass; /* key to the table */
+	const struct J9FieldLayoutHint *hint; /* NULL if the class is laid out in declaration order */
+} J9FieldLayoutHintEntry;
+
+/* Values of J9JavaVM->fieldLayoutHintsState */
+#define J9_FIELD_LAYOUT_HINTS_UNKNOWN 0
+#define J9_FIELD_LAYOUT_HINTS_NONE 1
+#define J9_FIELD_LAYOUT_HINTS_PRESENT 2
+
 typedef struct J9ROMNameAndSignature {
 	J9SRP name;
 	J9SRP signature;
@@ -1539,8 +1579,8 @@ typedef struct J9SharedCacheHeader {
 	UDATA unused5;
 	UDATA unused6;
 	U_32 softMaxBytes;
-	UDATA unused8;
-	UDATA unused9;
+	UDATA lookupIndexSRP; /* Offset from the header of the J9SharedLookupIndex of this layer, 0 if there is none */
+	UDATA lookupIndexUpdateCount; /* updateCount of the layer when its lookup index was built */
 	UDATA unused10;
 } J9SharedCacheHeader;
 
@@ -1964,6 +2004,13 @@ typedef struct J9ROMFieldOffsetWalkState {
 	struct J9HiddenInstanceField* hiddenInstanceFields[J9VM_MAX_HIDDEN_FIELDS_PER_CLASS];
 	UDATA hiddenInstanceFieldCount;
 	UDATA hiddenInstanceFieldWalkIndex;
+	const struct J9FieldLayoutHint *fieldLayoutHint;
+	U_32 hotSinglesCount;
+	U_32 hotObjectsCount;
+	U_32 hotDoublesCount;
+	U_32 hotSinglesSeen;
+	U_32 hotObjectsSeen;
+	U_32 hotDoublesSeen;
 #if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
 	struct J9FlattenedClassCache *flattenedClassCache;
 	UDATA firstFlatSingleOffset;
@@ -2192,11 +2239,13 @@ typedef struct J9JImageIntf {
 	struct J9JavaVM *vm;
 	struct J9PortLibrary *portLib;
 	UDATA libJImageHandle;
+	BOOLEAN mapResources;
 	I_32 (* jimageOpen)(struct J9JImageIntf *jimageIntf, const char *name, UDATA *handle);
 	void (* jimageClose)(struct J9JImageIntf *jimageIntf, UDATA handle);
 	I_32 (* jimageFindResource)(struct J9JImageIntf *jimageIntf, UDATA handle, const char *moduleName, const char* name, UDATA *resourceLocation, I_64 *size);
 	void (* jimageFreeResourceLocation)(struct J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation);
 	I_32 (* jimageGetResource)(struct J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, char *buffer, I_64 bufferSize, I_64 *resourceSize);
+	I_32 (* jimageGetResourceData)(struct J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, const U_8 **data, I_64 *resourceSize);
 #if JAVA_SPEC_VERSION < 26
 	const char * (* jimagePackageToModule)(struct J9JImageIntf *jimageIntf, UDATA handle, const char *packageName);
 #endif /* JAVA_SPEC_VERSION < 26 */
@@ -2216,6 +2265,7 @@ typedef struct J9TranslationBufferSet {
 	U_8* sunClassFileBuffer;
 	UDATA sunClassFileSize;
 	UDATA currentSunClassFileSize;
+	U_8* currentSunClassFileData;
 	U_8* searchFilenameBuffer;
 	UDATA searchFilenameSize;
 	UDATA relocatorDLLHandle;
@@ -5121,7 +5171,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_arraylet_getLeafSize)(struct J9JavaVM* javaVM) ;
 	UDATA  ( *j9gc_arraylet_getLeafLogSize)(struct J9JavaVM* javaVM) ;
 	void  ( *j9gc_get_offheap_data)(struct J9JavaVM *javaVM, void **offheapControlStructure, void **base, void **top, UDATA *usage);
-	void  ( *j9gc_set_allocation_sampling_interval)(struct J9JavaVM *vm, UDATA samplingInterval);
+	void  ( *j9gc_set_allocation_sampling_interval)(struct J9JavaVM *vm, UDATA requester, UDATA samplingInterval);
 	void  ( *j9gc_set_allocation_threshold)(struct J9VMThread *vmThread, UDATA low, UDATA high) ;
 	void  ( *j9gc_objaccess_recentlyAllocatedObject)(struct J9VMThread *vmThread, J9Object *dstObject) ;
 	void  ( *j9gc_objaccess_postStoreClassToClassLoader)(struct J9VMThread *vmThread, J9ClassLoader *destClassLoader, J9Class *srcClass) ;
@@ -5592,6 +5642,7 @@ typedef struct J9InternalVMFunctions {
 	double (JNICALL *native2InterpJavaUpcallD)(struct J9UpcallMetaData *data, void *argsListPointer);
 	U_8 * (JNICALL *native2InterpJavaUpcallStruct)(struct J9UpcallMetaData *data, void *argsListPointer);
 	BOOLEAN (*hasMemoryScope)(struct J9VMThread *walkThread, j9object_t scope);
+	U_64 (JNICALL *invokeDowncallFromJIT)(struct J9VMThread *currentThread, void *cif, void *function, U_64 *argValues, void *returnStructMemAddr);
 #endif /* JAVA_SPEC_VERSION >= 16 */
 #if JAVA_SPEC_VERSION >= 19
 	void (*copyFieldsFromContinuation)(struct J9VMThread *currentThread, struct J9VMThread *vmThread, struct J9VMEntryLocalStorage *els, struct J9VMContinuation *continuation);
@@ -5639,6 +5690,7 @@ typedef struct J9InternalVMFunctions {
 	BOOLEAN (*disclaimClassMemory)(struct J9JavaVM *vm, UDATA flags);
 	UDATA (*totalNumberOfDisclaimableClassMemorySegments)(struct J9JavaVM *vm);
 	jint (*signalNameToValue)(const char *signalName);
+	UDATA (*getLineNumberForStackWalkFrame)(struct J9StackWalkState *walkState, struct J9ROMMethod *romMethod, struct J9ROMClass *romClass, struct J9ClassLoader *classLoader);
 } J9InternalVMFunctions;
 
 /* Jazz 99339: define a new structure to replace JavaVM so as to pass J9NativeLibrary to JVMTIEnv  */
@@ -6007,8 +6059,12 @@ typedef struct J9VMThread {
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	UDATA safePointCount;
 	struct J9HashTable * volatile utfCache;
+	UDATA allocationSamplingCarriedBytes;
+	UDATA allocationSamplingBytes[J9_GC_ALLOCATION_SAMPLING_REQUESTER_COUNT];
 #if defined(J9VM_OPT_JFR)
 	J9JFRBuffer jfrBuffer;
+	U_8 * volatile jfrSpareBuffer;
+	U_64 jfrAllocationSampleBytes;
 #endif /* defined(J9VM_OPT_JFR) */
 #if JAVA_SPEC_VERSION >= 16
 	U_64 *ffiArgs;
@@ -6133,6 +6189,9 @@ typedef struct JFRState {
 	jlong typeIDcount;
 	char *delay;
 	char *duration;
+	UDATA allocationSamplingInterval;
+	UDATA allocationSampleRate;
+	U_64 allocationSampleWindow; /* index of the current one second window in the high 32 bits, samples emitted in it in the low 32 bits */
 } JFRState;
 
 typedef struct J9ReflectFunctionTable {
@@ -6169,6 +6228,48 @@ typedef struct J9CifArgumentTypes {
 } J9CifArgumentTypes;
 #endif /* JAVA_SPEC_VERSION >= 16 */
 
+/* Walkback PCs which decode to more (inlined and outer) frames than this are not cached */
+#define J9_DECODED_FRAME_CACHE_MAX_FRAMES 16
+
+/* One Java frame decoded from a walkback PC, as reported to stack trace consumers */
+typedef struct J9DecodedFrame {
+	struct J9ROMClass *romClass;
+	struct J9ROMMethod *romMethod;
+	struct J9ClassLoader *classLoader;
+	struct J9Class *ramClass;
+	UDATA bytecodeOffset;
+	UDATA lineNumber;
+	UDATA frameType;
+	UDATA isSameReceiver;
+} J9DecodedFrame;
+
+/* Immutable once published, except for next which links unpublished entries awaiting exclusive VM access to be freed.
+ * Frames are ordered innermost inlined frame first, outer frame last.
+ * JIT entries are stale once codeGeneration no longer matches the cache's.
+ */
+typedef struct J9DecodedFrameCacheEntry {
+	UDATA pc;
+	struct J9JITExceptionTable *metaData;
+	struct J9DecodedFrameCacheEntry *next;
+	UDATA codeGeneration;
+	UDATA frameCount;
+	J9DecodedFrame frames[1];
+} J9DecodedFrameCacheEntry;
+
+/* VM-wide cache of decoded walkback PCs, flushed under exclusive VM access when classes go away.
+ * Unloading JIT code only advances codeGeneration, which invalidates the JIT entries in place.
+ * entryCount counts published entries and deferredCount unpublished ones not yet freed.
+ */
+typedef struct J9DecodedFrameCache {
+	struct J9DecodedFrameCacheEntry * volatile *table;
+	UDATA tableMask;
+	UDATA maxDeferred;
+	volatile UDATA entryCount;
+	volatile UDATA deferredCount;
+	volatile UDATA codeGeneration;
+	struct J9DecodedFrameCacheEntry * volatile deferredEntries;
+} J9DecodedFrameCache;
+
 /* Values for J9VMRuntimeStateListener.vmRuntimeState
  * These values are reflected in the Java class library code(RuntimeMXBean)
  */
@@ -6216,6 +6317,9 @@ typedef struct J9JavaVM {
 	struct J9Pool* hotFieldClassInfoPool;
 	omrthread_monitor_t hotFieldClassInfoPoolMutex;
 	omrthread_monitor_t globalHotFieldPoolMutex;
+	struct J9HashTable* fieldLayoutHints;
+	omrthread_monitor_t fieldLayoutHintsMutex;
+	volatile UDATA fieldLayoutHintsState;
 	struct J9ClassLoader* systemClassLoader;
 	UDATA sigFlags;
 	void* vmLocalStorageFunctions;
@@ -6374,7 +6478,7 @@ typedef struct J9JavaVM {
 	J9SidecarExitFunction * sidecarExitFunctions;
 	struct J9HashTable** monitorTables;
 	UDATA monitorTableCount;
-	omrthread_monitor_t monitorTableMutex;
+	omrthread_monitor_t* monitorTableMutexes;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
 	UDATA thrStaggerStep;
@@ -6681,6 +6785,11 @@ typedef struct J9JavaVM {
 	UDATA jfrSamplerState;
 	IDATA jfrAsyncKey;
 	IDATA jfrThreadCPULoadAsyncKey;
+	J9JFRBufferHeader * volatile jfrFullBuffers;
+	volatile UDATA jfrFullBufferCount;
+	omrthread_monitor_t jfrFlusherMutex;
+	omrthread_t jfrFlusherThread;
+	UDATA jfrFlusherState;
 #endif /* defined(J9VM_OPT_JFR) */
 #if JAVA_SPEC_VERSION >= 22
 	omrthread_monitor_t closeScopeMutex;
@@ -6717,8 +6826,10 @@ typedef struct J9JavaVM {
 	/* Protects constRefArrayPool and J9Class.constRefArrays. */
 	omrthread_monitor_t constRefsMutex;
 #endif /* defined(J9VM_OPT_OPENJDK_METHODHANDLE) */
+	struct J9DecodedFrameCache *decodedFrameCache;
 } J9JavaVM;
 
+/* States of the JFR sampler thread, also used for the JFR flusher thread */
 #define J9JFR_SAMPLER_STATE_UNINITIALIZED 0
 #define J9JFR_SAMPLER_STATE_RUNNING 1
 #define J9JFR_SAMPLER_STATE_STOP 2
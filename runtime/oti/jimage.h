@@ -100,6 +100,7 @@ typedef struct J9JImage {
 	U_64 fileLength;
 	struct J9JImageHeader *j9jimageHeader;
 	J9MmapHandle *jimageMmap;
+	U_8 *fileData; /* start of the jimage file if it is mapped entirely, NULL if only the metadata is mapped */
 } J9JImage;
 
 typedef struct DecompressorInfo {
@@ -407,6 +407,8 @@ enum INIT_STAGE {
 #define VMOPT_XXENABLELEGACYMANGLING "-XX:+UseLegacyJNINameEscaping"
 #define VMOPT_XXENABLEUTFCACHE "-XX:+UTFCache"
 #define VMOPT_XXDISABLEUTFCACHE "-XX:-UTFCache"
+#define VMOPT_XXENABLEMAPZIPFILES "-XX:+MapZipFiles"
+#define VMOPT_XXDISABLEMAPZIPFILES "-XX:-MapZipFiles"
 #define VMOPT_XXENABLEENSUREHASHED "-XX:+EnsureHashed:"
 #define VMOPT_XXDISABLEENSUREHASHED "-XX:-EnsureHashed:"
 #define VMOPT_XXOPENJ9COMMANDLINEENV "-XX:+OpenJ9CommandLineEnv"
@@ -555,6 +557,8 @@ enum INIT_STAGE {
 
 #define VMOPT_XXUSEJ9JIMAGEREADER "-XX:+UseJ9JImageReader"
 #define VMOPT_XXNOUSEJ9JIMAGEREADER "-XX:-UseJ9JImageReader"
+#define VMOPT_XXMAPJIMAGERESOURCES "-XX:+MapJImageResources"
+#define VMOPT_XXNOMAPJIMAGERESOURCES "-XX:-MapJImageResources"
 
 #define VMOPT_XXENABLEHCR "-XX:+EnableHCR"
 #define VMOPT_XXNOENABLEHCR "-XX:-EnableHCR"
@@ -600,8 +604,17 @@ enum INIT_STAGE {
 #define VMOPT_XXSTARTOPENJ9EXPERIMENTALFLIGHTRECORDING "-XX:StartOpenJ9ExperimentalFlightRecording"
 #define VMOPT_XXSTARTOPENJ9EXPERIMENTALFLIGHTRECORDING_COLON "-XX:StartOpenJ9ExperimentalFlightRecording:"
 #define VMOPT_XXSTARTOPENJ9EXPERIMENTALFLIGHTRECORDING_EQUALS "-XX:StartOpenJ9ExperimentalFlightRecording="
+#define VMOPT_XXJFRALLOCATIONSAMPLINGINTERVAL_EQUALS "-XX:JFRAllocationSamplingInterval="
+#define VMOPT_XXJFRALLOCATIONSAMPLERATE_EQUALS "-XX:JFRAllocationSampleRate="
 
 #define VMOPT_XXCONTINUATIONCACHE "-XX:ContinuationCache:"
+/* Option to toggle on/off shrinking the stacks of yielding continuations. */
+#define VMOPT_XXTRIMCONTINUATIONSTACKS "-XX:+TrimContinuationStacks"
+#define VMOPT_XXNOTRIMCONTINUATIONSTACKS "-XX:-TrimContinuationStacks"
+#define VMOPT_XXPROFILEGUIDEDFIELDLAYOUT "-XX:+ProfileGuidedFieldLayout"
+#define VMOPT_XXNOPROFILEGUIDEDFIELDLAYOUT "-XX:-ProfileGuidedFieldLayout"
+#define VMOPT_XXDECODEDFRAMECACHE "-XX:+DecodedFrameCache"
+#define VMOPT_XXNODECODEDFRAMECACHE "-XX:-DecodedFrameCache"
 
 #if JAVA_SPEC_VERSION >= 22
 #define VMOPT_XFFIPROTO "-Xffiproto"
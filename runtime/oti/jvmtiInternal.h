@@ -168,6 +168,7 @@ typedef struct J9JVMTIEnv {
 	omrthread_monitor_t threadDataPoolMutex;
 	J9Pool *threadDataPool;
 	J9HashTable *objectTagTable;
+	omrthread_rwmutex_t objectTagTableMutex;
 	J9JVMTIEventEnableMap globalEventEnable;
 	J9HashTable *watchedClasses;
 	J9Pool *breakpoints;
@@ -224,6 +224,24 @@ typedef struct AttachedDataWrapper {
 #define ADWDATA(adw) (((U_8*)(adw)) + sizeof(AttachedDataWrapper))
 #define ADWITEM(adw) (((U_8*)(adw)) - sizeof(ShcItem))
 
+/* Lookup index of a cache layer, stored as J9SHR_DATA_TYPE_LOOKUPINDEX byte data and located through the layer header.
+ * Items whose key is a class name are sorted by key hash so that a JVM attaching to the layer as a lower layer
+ * can add them to its hashtables on first lookup, while all other items are read at startup in cache order.
+ */
+typedef struct J9SharedLookupIndexEntry {
+	U_32 keyHash;	/* see SH_Manager::generateLookupIndexHash() */
+	U_32 itemOffset;	/* offset of the ShcItem from the cache header */
+} J9SharedLookupIndexEntry;
+
+typedef struct J9SharedLookupIndex {
+	U_32 eagerItemCount;	/* U_32 offsets of the items read at startup follow the index */
+	U_32 lazyItemCount;	/* J9SharedLookupIndexEntry array follows the eager item offsets */
+} J9SharedLookupIndex;
+
+#define LOOKUPINDEX_EAGER_OFFSETS(li) ((U_32*)(((U_8*)(li)) + sizeof(J9SharedLookupIndex)))
+#define LOOKUPINDEX_LAZY_ENTRIES(li) ((J9SharedLookupIndexEntry*)(LOOKUPINDEX_EAGER_OFFSETS(li) + J9SHR_READMEM((li)->eagerItemCount)))
+#define LOOKUPINDEX_LEN(eagerCount, lazyCount) (sizeof(J9SharedLookupIndex) + ((eagerCount) * sizeof(U_32)) + ((lazyCount) * sizeof(J9SharedLookupIndexEntry)))
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,7 +55,8 @@
 #define J9SHR_DATA_TYPE_STARTUP_HINTS 10
 #define J9SHR_DATA_TYPE_AOTCLASSCHAIN 11
 #define J9SHR_DATA_TYPE_AOTTHUNK 12
-#define J9SHR_DATA_TYPE_MAX 12
+#define J9SHR_DATA_TYPE_LOOKUPINDEX 13
+#define J9SHR_DATA_TYPE_MAX 13
 
 #define J9SHR_ATTACHED_DATA_TYPE_UNKNOWN  0
 #define J9SHR_ATTACHED_DATA_TYPE_JITPROFILE  1
@@ -131,6 +132,7 @@
 #define J9SHR_RUNTIMEFLAG2_TEST_DOUBLE_PAGESIZE 2
 #define J9SHR_RUNTIMEFLAG2_TEST_HALF_PAGESIZE 4
 #define J9SHR_RUNTIMEFLAG2_SHARE_LAMBDAFORM 8
+#define J9SHR_RUNTIMEFLAG2_ENABLE_LOOKUP_INDEX 16
 
 #define J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT  1
 #define J9SHR_VERBOSEFLAG_ENABLE_VERBOSE  2
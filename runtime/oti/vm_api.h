@@ -961,6 +961,20 @@ iterateStackTrace(J9VMThread * vmThread, j9object_t* exception,  UDATA  (*callba
 UDATA
 iterateStackTraceImpl(J9VMThread * vmThread, j9object_t* exception,  UDATA  (*callback) (J9VMThread * vmThread, void * userData, UDATA bytecodeOffset, J9ROMClass * romClass, J9ROMMethod * romMethod, J9UTF8 * fileName, UDATA lineNumber, J9ClassLoader* classLoader, J9Class* ramClass, UDATA frameType), void * userData, UDATA pruneConstructors, UDATA skipHiddenFrames, UDATA sizeOfWalkstateCache, BOOLEAN exceptionIsJavaObject);
 
+/**
+* @brief Find the line number of the frame a stack walk is currently positioned on, using the
+* decoded frame cache shared with exception and JFR stack traces where possible.
+* @param walkState the stack walk, positioned on the frame
+* @param romMethod the original ROM method of the frame
+* @param romClass the ROM class declaring romMethod
+* @param classLoader the class loader of romClass
+* @return the line number, or 0 if unknown
+*
+* @note Assumes VM access
+*/
+UDATA
+getLineNumberForStackWalkFrame(J9StackWalkState *walkState, J9ROMMethod *romMethod, J9ROMClass *romClass, J9ClassLoader *classLoader);
+
 
 /* ---------------- exceptionsupport.c ---------------- */
 
@@ -1309,6 +1323,17 @@ UDATA
 growJavaStack(J9VMThread * vmThread, UDATA newStackSize);
 
 
+/**
+* @brief Move the current thread's Java stack to a smaller stack. Unlike growJavaStack(),
+* no GC is attempted if the new stack cannot be allocated; the current stack is kept instead.
+* @param vmThread
+* @param newStackSize must be at least the number of bytes in use on the current stack
+* @return UDATA 0 on success
+*/
+UDATA
+trimJavaStack(J9VMThread * vmThread, UDATA newStackSize);
+
+
 #endif /* J9VM_INTERP_GROWABLE_STACKS */ /* End File Level Build Flags */
 
 
@@ -2549,7 +2574,7 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
  * @brief Search the monitor tables in vm->monitorTable for the inflated monitor corresponding to an
  * object. Similar to monitorTableAt(), but doesn't add the monitor if it isn't found in the hashtable.
  *
- * This function may block on vm->monitorTableMutex.
+ * This function may block on one of vm->monitorTableMutexes.
  * This function can work out-of-process.
  *
  * @param[in] vm the JavaVM. For out-of-process: may be a local or target pointer.
@@ -2681,6 +2706,22 @@ initializeHiddenInstanceFieldsList(J9JavaVM *vm);
 void
 freeHiddenInstanceFieldsList(J9JavaVM *vm);
 
+/**
+* @brief Create the table of instance field layout hints and register the hook that
+* records hot fields into the shared classes cache, if -XX:+ProfileGuidedFieldLayout is enabled.
+* @param vm
+* @return 0 on success, non-zero on failure
+*/
+UDATA
+initializeFieldLayoutHints(J9JavaVM *vm);
+
+/**
+* @brief Free the table of instance field layout hints.
+* @param vm
+*/
+void
+freeFieldLayoutHints(J9JavaVM *vm);
+
 /**
  * @brief Add an extra hidden instance field to the specified class when it is loaded.
  * @param vm[in] pointer to the J9JavaVM
@@ -5737,6 +5778,22 @@ native2InterpJavaUpcallStruct(J9UpcallMetaData *data, void *argsListPointer);
  */
 BOOLEAN
 hasMemoryScope(J9VMThread *walkThread, j9object_t scope);
+
+/* ------------------- UpcallExceptionHandler.cpp ----------------- */
+
+/**
+ * @brief Call the native function of a downcall from compiled code which has
+ * built the JNI call-out frame and released VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param cif[in] the ffi_cif of the downcall
+ * @param function[in] the native function address
+ * @param argValues[in] the arguments of the downcall
+ * @param returnStructMemAddr[in] the native memory for the returned struct
+ * @return the return value converted as in the interpreter
+ */
+U_64 JNICALL
+invokeDowncallFromJIT(J9VMThread *currentThread, void *cif, void *function, U_64 *argValues, void *returnStructMemAddr);
 #endif /* JAVA_SPEC_VERSION >= 16 */
 
 /* ------------------- jfr.cpp ------------------- */
@@ -24,12 +24,44 @@
 #include <string.h>
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
+#include "zlib.h"
+
+/* Size and number of the buffers handed over to the writer thread of a pipelined stream */
+#define FILESTREAM_PIPELINE_BUFFER_SIZE  (4 * 1024 * 1024)
+#define FILESTREAM_PIPELINE_BUFFER_COUNT 4
+
+/*
+ * State of a pipelined stream. The dumping thread fills the buffers in turn and hands each full buffer
+ * to the writer thread, which compresses it (optionally) and writes it to the file. The dumping thread
+ * only blocks when all the buffers are waiting to be written. All the fields below the monitor are
+ * protected by it, except for _Buffers and _FillPosition, which only the dumping thread touches while
+ * the buffer it is filling has not been handed over. The stream's _Error is only touched by the dumping
+ * thread; write errors are passed back through _WriteError, which the dumping thread reads under the
+ * monitor.
+ */
+struct FileStream::Pipeline
+{
+	omrthread_monitor_t _Monitor;
+	char*               _Buffers[FILESTREAM_PIPELINE_BUFFER_COUNT];
+	UDATA               _Lengths[FILESTREAM_PIPELINE_BUFFER_COUNT];
+	UDATA               _FillIndex;     /* Buffer being filled by the dumping thread */
+	UDATA               _FillPosition;  /* Number of bytes already in the buffer being filled */
+	UDATA               _WriteIndex;    /* Next buffer to be written by the writer thread */
+	UDATA               _PendingCount;  /* Number of full buffers not written yet */
+	IDATA               _WriteError;    /* First error raised by the writer thread */
+	bool                _Closing;       /* No more buffers will be submitted */
+	bool                _WriterExited;
+	bool                _Compress;
+	z_stream            _ZStream;
+	char*               _DeflateBuffer;
+};
 
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_Pipeline(NULL)
 {
 	/* Nothing to do */
 }
@@ -42,11 +74,21 @@ FileStream::~FileStream()
 
 /* Method for opening the file */
 void
-FileStream::open(const char* fileName)
+FileStream::open(const char* fileName, UDATA flags)
 {
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+
+		/*
+		 * Fall back to writing the data directly if the writer thread cannot be started, unless the data
+		 * has to be compressed: the caller named the file for gzip output, so fail the write instead.
+		 */
+		if ((_FileHandle != -1) && (0 != (flags & (PIPELINED | COMPRESSED)))) {
+			if (!startPipeline(flags) && (0 != (flags & COMPRESSED))) {
+				_Error = -1;
+			}
+		}
 	}
 }
 
@@ -54,6 +96,10 @@ FileStream::open(const char* fileName)
 void 
 FileStream::close(void)
 {
+	if (NULL != _Pipeline) {
+		stopPipeline();
+	}
+
 	if (_FileHandle != -1) {
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
@@ -77,11 +123,25 @@ bool FileStream::hasError(void) const
 void
 FileStream::writeCharacters(const char* data, IDATA length)
 {
-	if (_FileHandle != -1 && ! _Error) {
-		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
+	if (NULL == _Pipeline) {
+		if (_FileHandle != -1 && ! _Error) {
+			_Error = writeToFile(data, length);
+		}
+		return;
+	}
+
+	/* Errors are raised by the writer thread and picked up in submitBuffer(); stop producing data once one occurred */
+	while ((length > 0) && !_Error) {
+		UDATA spaceRemaining = FILESTREAM_PIPELINE_BUFFER_SIZE - _Pipeline->_FillPosition;
+		UDATA bytesToCopy = OMR_MIN(spaceRemaining, (UDATA)length);
 
-		if (rc != length) {
-			_Error = rc;
+		memcpy(_Pipeline->_Buffers[_Pipeline->_FillIndex] + _Pipeline->_FillPosition, data, bytesToCopy);
+		_Pipeline->_FillPosition += bytesToCopy;
+		data += bytesToCopy;
+		length -= bytesToCopy;
+
+		if (FILESTREAM_PIPELINE_BUFFER_SIZE == _Pipeline->_FillPosition) {
+			submitBuffer();
 		}
 	}
 }
@@ -111,3 +171,193 @@ FileStream::writeNumber(IDATA data, int length)
 	/* Write the data to the file */
 	writeCharacters(buffer, length);
 }
+
+/* Method for writing data straight to the file, returns the error to record or 0 */
+IDATA
+FileStream::writeToFile(const char* data, IDATA length)
+{
+	IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
+
+	return (rc != length) ? rc : 0;
+}
+
+/* Method for allocating the buffers and starting the writer thread of a pipelined stream */
+bool
+FileStream::startPipeline(UDATA flags)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	Pipeline* pipeline = (Pipeline*)j9mem_allocate_memory(sizeof(Pipeline), OMRMEM_CATEGORY_VM);
+	UDATA buffersAllocated = 0;
+	omrthread_t writerThread = NULL;
+
+	if (NULL == pipeline) {
+		return false;
+	}
+	memset(pipeline, 0, sizeof(Pipeline));
+	pipeline->_Compress = (0 != (flags & COMPRESSED));
+
+	if (0 != omrthread_monitor_init_with_name(&pipeline->_Monitor, 0, "heap dump writer mutex")) {
+		j9mem_free_memory(pipeline);
+		return false;
+	}
+
+	for (; buffersAllocated < FILESTREAM_PIPELINE_BUFFER_COUNT; buffersAllocated++) {
+		pipeline->_Buffers[buffersAllocated] = (char*)j9mem_allocate_memory(FILESTREAM_PIPELINE_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+		if (NULL == pipeline->_Buffers[buffersAllocated]) {
+			goto fail;
+		}
+	}
+
+	if (pipeline->_Compress) {
+		pipeline->_DeflateBuffer = (char*)j9mem_allocate_memory(FILESTREAM_PIPELINE_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+		if (NULL == pipeline->_DeflateBuffer) {
+			goto fail;
+		}
+		/* 16 + MAX_WBITS selects the gzip format; favour speed as the VM is paused while dumping */
+		if (Z_OK != deflateInit2(&pipeline->_ZStream, Z_BEST_SPEED, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY)) {
+			goto fail;
+		}
+	}
+
+	_Pipeline = pipeline;
+	if (0 != omrthread_create(&writerThread, 0, J9THREAD_PRIORITY_NORMAL, 0, writerThreadMain, this)) {
+		_Pipeline = NULL;
+		if (pipeline->_Compress) {
+			deflateEnd(&pipeline->_ZStream);
+		}
+		goto fail;
+	}
+	return true;
+
+fail:
+	j9mem_free_memory(pipeline->_DeflateBuffer);
+	while (buffersAllocated > 0) {
+		buffersAllocated -= 1;
+		j9mem_free_memory(pipeline->_Buffers[buffersAllocated]);
+	}
+	omrthread_monitor_destroy(pipeline->_Monitor);
+	j9mem_free_memory(pipeline);
+	return false;
+}
+
+/* Method for handing the buffer being filled over to the writer thread */
+void
+FileStream::submitBuffer(void)
+{
+	Pipeline* pipeline = _Pipeline;
+
+	omrthread_monitor_enter(pipeline->_Monitor);
+	pipeline->_Lengths[pipeline->_FillIndex] = pipeline->_FillPosition;
+	pipeline->_PendingCount += 1;
+	pipeline->_FillIndex = (pipeline->_FillIndex + 1) % FILESTREAM_PIPELINE_BUFFER_COUNT;
+	pipeline->_FillPosition = 0;
+	omrthread_monitor_notify_all(pipeline->_Monitor);
+
+	/* Wait until the next buffer has been written out */
+	while ((FILESTREAM_PIPELINE_BUFFER_COUNT == pipeline->_PendingCount) && !pipeline->_WriterExited) {
+		omrthread_monitor_wait(pipeline->_Monitor);
+	}
+	_Error = pipeline->_WriteError;
+	omrthread_monitor_exit(pipeline->_Monitor);
+}
+
+/* Method for flushing the pending data and stopping the writer thread */
+void
+FileStream::stopPipeline(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	Pipeline* pipeline = _Pipeline;
+
+	if ((0 != pipeline->_FillPosition) && !_Error) {
+		submitBuffer();
+	}
+
+	omrthread_monitor_enter(pipeline->_Monitor);
+	pipeline->_Closing = true;
+	omrthread_monitor_notify_all(pipeline->_Monitor);
+	while (!pipeline->_WriterExited) {
+		omrthread_monitor_wait(pipeline->_Monitor);
+	}
+	_Error = pipeline->_WriteError;
+	omrthread_monitor_exit(pipeline->_Monitor);
+
+	if (pipeline->_Compress) {
+		deflateEnd(&pipeline->_ZStream);
+		j9mem_free_memory(pipeline->_DeflateBuffer);
+	}
+	for (UDATA i = 0; i < FILESTREAM_PIPELINE_BUFFER_COUNT; i++) {
+		j9mem_free_memory(pipeline->_Buffers[i]);
+	}
+	omrthread_monitor_destroy(pipeline->_Monitor);
+	j9mem_free_memory(pipeline);
+	_Pipeline = NULL;
+}
+
+/* Method run by the writer thread to compress and write out one buffer, returns the error to record or 0 */
+IDATA
+FileStream::writeBuffer(const char* data, UDATA length, bool finish)
+{
+	Pipeline* pipeline = _Pipeline;
+	IDATA error = 0;
+
+	if (!pipeline->_Compress) {
+		return writeToFile(data, length);
+	}
+
+	pipeline->_ZStream.next_in = (Bytef*)data;
+	pipeline->_ZStream.avail_in = (uInt)length;
+	do {
+		pipeline->_ZStream.next_out = (Bytef*)pipeline->_DeflateBuffer;
+		pipeline->_ZStream.avail_out = FILESTREAM_PIPELINE_BUFFER_SIZE;
+		if (Z_STREAM_ERROR == deflate(&pipeline->_ZStream, finish ? Z_FINISH : Z_NO_FLUSH)) {
+			return -1;
+		}
+		error = writeToFile(pipeline->_DeflateBuffer, FILESTREAM_PIPELINE_BUFFER_SIZE - pipeline->_ZStream.avail_out);
+	} while ((0 == pipeline->_ZStream.avail_out) && (0 == error));
+
+	return error;
+}
+
+/* Entry point of the writer thread */
+int J9THREAD_PROC
+FileStream::writerThreadMain(void* userData)
+{
+	FileStream* stream = (FileStream*)userData;
+	Pipeline* pipeline = stream->_Pipeline;
+
+	omrthread_monitor_enter(pipeline->_Monitor);
+	for (;;) {
+		while ((0 == pipeline->_PendingCount) && !pipeline->_Closing) {
+			omrthread_monitor_wait(pipeline->_Monitor);
+		}
+		if (0 == pipeline->_PendingCount) {
+			break;
+		}
+
+		/* The buffer cannot be touched by the dumping thread until it is released below */
+		UDATA index = pipeline->_WriteIndex;
+		if (0 == pipeline->_WriteError) {
+			omrthread_monitor_exit(pipeline->_Monitor);
+			IDATA error = stream->writeBuffer(pipeline->_Buffers[index], pipeline->_Lengths[index], false);
+			omrthread_monitor_enter(pipeline->_Monitor);
+			pipeline->_WriteError = error;
+		}
+
+		pipeline->_WriteIndex = (index + 1) % FILESTREAM_PIPELINE_BUFFER_COUNT;
+		pipeline->_PendingCount -= 1;
+		omrthread_monitor_notify_all(pipeline->_Monitor);
+	}
+
+	/* Write the gzip trailer */
+	if (pipeline->_Compress && (0 == pipeline->_WriteError)) {
+		omrthread_monitor_exit(pipeline->_Monitor);
+		IDATA error = stream->writeBuffer(NULL, 0, true);
+		omrthread_monitor_enter(pipeline->_Monitor);
+		pipeline->_WriteError = error;
+	}
+
+	pipeline->_WriterExited = true;
+	omrthread_monitor_notify_all(pipeline->_Monitor);
+	omrthread_exit(pipeline->_Monitor);
+	return 0;
+}
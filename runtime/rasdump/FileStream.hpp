@@ -24,6 +24,7 @@
 
 /* Includes */
 #include "j9port.h"
+#include "omrthread.h"
 
 /**************************************************************************************************/
 /*                                                                                                */
@@ -33,6 +34,12 @@
 class FileStream
 {
 public :
+	/* Flags for open() */
+	enum {
+		PIPELINED  = 0x1, /* Data is buffered and written to the file by a separate thread */
+		COMPRESSED = 0x2  /* Data is gzip compressed by the writer thread (implies PIPELINED) */
+	};
+
 	/* Constructor */
 	FileStream(J9PortLibrary* portLibrary);
 
@@ -40,7 +47,7 @@ public :
 	~FileStream();
 
 	/* Method for opening the file */
-	void open(const char* fileName);
+	void open(const char* fileName, UDATA flags = 0);
 
 	/* Method for closing the file */
 	void close(void);
@@ -59,11 +66,23 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* State shared with the writer thread of a pipelined stream */
+	struct Pipeline;
+
+	/* Methods for managing a pipelined stream */
+	bool startPipeline(UDATA flags);
+	void stopPipeline(void);
+	void submitBuffer(void);
+	static int J9THREAD_PROC writerThreadMain(void* userData);
+	IDATA writeBuffer(const char* data, UDATA length, bool finish);
+	IDATA writeToFile(const char* data, IDATA length);
+
 protected :
 	/* Declared data */
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+	Pipeline*      _Pipeline;
 };
 
 #endif
@@ -1865,6 +1865,8 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 
 				if (strcmp(spec->name, "heap") == 0) {
 					j9tty_err_printf("\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf("  opts=PHD+STREAM      Write the PHD file from a separate thread\n");
+					j9tty_err_printf("  opts=PHD+GZIP        Write a gzip compressed PHD file (named <label>.gz) from a separate thread\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf("\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -2811,6 +2813,10 @@ runDumpAgent(struct J9JavaVM *vm, J9RASdumpAgent * agent, J9RASdumpContext * con
 				if (agent->dumpFn == doHeapDump) {
 					if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), label);
+						if (strstr(agent->dumpOptions, "GZIP")) {
+							/* the PHD writer appends .gz to the name of compressed dumps, see BinaryHeapDumpWriter */
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), ".gz");
+						}
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), "\t");
 					}
 
@@ -871,6 +871,7 @@ private :
 	FileStream        _OutputStream;
 	void*             _CurrentObject;
 	ClassCache        _ClassCache;
+	UDATA             _StreamFlags;
 	bool              _FileMode;
 	bool              _Error;
 
@@ -1123,6 +1124,7 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_FileName(context->javaVM->portLibrary),
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
+	_StreamFlags(0),
 	_FileMode(false),
 	_Error(false)
 {
@@ -1132,17 +1134,30 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	if ((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "PHD") == 0)) {
 		return;
 	}
+
+	/* Optionally overlap the file output (and compression) with the heap walk by using a writer thread */
+	if (agent->dumpOptions != 0) {
+		if (strstr(agent->dumpOptions, "STREAM") != 0) {
+			_StreamFlags |= FileStream::PIPELINED;
+		}
+		if (strstr(agent->dumpOptions, "GZIP") != 0) {
+			_StreamFlags |= FileStream::COMPRESSED;
+		}
+	}
 	
-	/* Remember the file name */
+	/* Remember the file name, marking gzip compressed files as such so that they are not mistaken for plain PHD files */
 	_FileName += fileName;
+	if (_StreamFlags & FileStream::COMPRESSED) {
+		_FileName += ".gz";
+	}
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		reportDumpRequest(_PortLibrary,_Context,"Heap",_FileName.data());
 		
 		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
+		_OutputStream.open(_FileName.data(), _StreamFlags);
 	
 		/* Performance measuring code 
 		startTimer();
@@ -1176,11 +1191,11 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
 		if (! _Error) {
 			if (_FileMode) {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			} else {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			}
 		}
 	}
@@ -1227,7 +1242,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		_OutputStream.open(fileName.data(), _StreamFlags);
 
 		/* Start writing the file */
 		writeDumpFileHeader();
@@ -63,6 +63,9 @@ extern "C" {
 
 static char* formatAttachedDataString(J9VMThread* currentThread, U_8 *attachedData, UDATA attachedDataLength, char *attachedDataStringBuffer, UDATA bufferLength);
 static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
+static int compareLookupIndexEntries(const void *left, const void *right);
+static const ShcItem* getLookupIndexItem(const J9SharedCacheHeader* cacheHeader, U_32 itemOffset);
+static bool isLookupIndexKeyedType(UDATA itemType);
 /* If you make this sleep a lot longer, it almost eliminates store contention
  * because the VMs get out of step with each other, but you delay excessively */
 #define WRITE_HASH_WAIT_MAX_MICROS 80000
@@ -671,7 +674,14 @@ error:
 
 		if (ccToUse->enterWriteMutex(currentThread, false, fnName) == 0) {
 			/* populate the hashtables */
-			itemsRead = readCache(currentThread, ccToUse, -1, false);
+			itemsRead = CM_NO_LOOKUP_INDEX;
+			if ((ccToUse != _ccHead) && J9_ARE_NO_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS)) {
+				/* Lower layers are not updated, so a lookup index that was current when the layer was finalized still is */
+				itemsRead = readCacheFromLookupIndex(currentThread, ccToUse);
+			}
+			if (CM_NO_LOOKUP_INDEX == itemsRead) {
+				itemsRead = readCache(currentThread, ccToUse, -1, false);
+			}
 			ccToUse->protectPartiallyFilledPages(currentThread);
 			/* Two reasons for moving the code to check for full cache from SH_CompositeCacheImpl::startup()
 			 * to SH_CacheMap::startup():
@@ -1220,6 +1230,212 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	return result;
 }
 
+/**
+ * Populate the hashtables from the lookup index of a lower layer instead of walking every item in it.
+ * Items keyed by class name are handed to the ROMClass manager, which stores them when their name is first used.
+ * All other items are stored now, in cache order.
+ *
+ * THREADING: MUST be single-threaded - called during startup with the cache write mutex held
+ *
+ * @return	number of entries successfully read, or
+ * 			CM_READ_CACHE_FAILED if the call fails for some reason, or
+ * 			CM_NO_LOOKUP_INDEX if the cache has no usable lookup index and must be read by readCache()
+ */
+IDATA
+SH_CacheMap::readCacheFromLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache)
+{
+	const J9SharedLookupIndex* index = cache->getLookupIndex();
+	const J9SharedCacheHeader* cacheHeader = NULL;
+	const U_32* eagerOffsets = NULL;
+	const J9SharedLookupIndexEntry* lazyEntries = NULL;
+	U_32 eagerCount = 0;
+	U_32 lazyCount = 0;
+	U_32 i = 0;
+	SH_Manager* manager = NULL;
+	IDATA result = 0;
+	IDATA rc = 0;
+
+	if (NULL == index) {
+		return CM_NO_LOOKUP_INDEX;
+	}
+	cacheHeader = cache->getCacheHeaderAddress();
+	eagerCount = index->eagerItemCount;
+	lazyCount = index->lazyItemCount;
+	eagerOffsets = LOOKUPINDEX_EAGER_OFFSETS(index);
+	lazyEntries = LOOKUPINDEX_LAZY_ENTRIES(index);
+
+	/* Fall back to a full read rather than trust an index that does not describe this cache.
+	 * Only the index itself and the item headers are checked here. Reading the keys would touch every
+	 * ROMClass in the layer, so the ROMClass manager checks them as it stores each lazy item.
+	 */
+	for (i = 0; i < eagerCount; i++) {
+		const ShcItem* it = getLookupIndexItem(cacheHeader, eagerOffsets[i]);
+		if ((NULL == it) || isLookupIndexKeyedType(ITEMTYPE(it))) {
+			return CM_NO_LOOKUP_INDEX;
+		}
+	}
+	for (i = 0; i < lazyCount; i++) {
+		const ShcItem* it = getLookupIndexItem(cacheHeader, lazyEntries[i].itemOffset);
+		if ((NULL == it)
+			|| !isLookupIndexKeyedType(ITEMTYPE(it))
+			|| ((i > 0) && (lazyEntries[i - 1].keyHash > lazyEntries[i].keyHash))
+		) {
+			return CM_NO_LOOKUP_INDEX;
+		}
+	}
+
+	for (i = 0; i < eagerCount; i++) {
+		const ShcItem* it = getLookupIndexItem(cacheHeader, eagerOffsets[i]);
+
+		rc = getAndStartManagerForType(currentThread, ITEMTYPE(it), &manager);
+		if (-1 == rc) {
+			/* Manager failed to start - ignore */
+			++result;
+		} else if ((rc > 0) && ((UDATA)rc == ITEMTYPE(it)) && manager->storeNew(currentThread, it, cache)) {
+			++result;
+		} else {
+			CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+			return CM_READ_CACHE_FAILED;
+		}
+	}
+	if (0 != lazyCount) {
+		rc = getAndStartManagerForType(currentThread, TYPE_ROMCLASS, &manager);
+		if (-1 == rc) {
+			/* Manager failed to start - ignore */
+		} else if ((TYPE_ROMCLASS != rc) || (0 != manager->addLazyItems(currentThread, cache, cacheHeader, lazyEntries, lazyCount))) {
+			CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+			return CM_READ_CACHE_FAILED;
+		}
+		result += lazyCount;
+	}
+	/* The index itself is the last item in the cache. It is only found through the cache header. */
+	++result;
+
+	cache->doneReadUpdates(currentThread, result);
+	return result;
+}
+
+/**
+ * Returns the name a ROMClass manager item is hashed on, or NULL for items of other managers.
+ */
+const J9UTF8*
+SH_CacheMap::getLookupIndexKey(const ShcItem* it)
+{
+	J9ROMClass* romClass = NULL;
+
+	switch (ITEMTYPE(it)) {
+	case TYPE_ORPHAN:
+		romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(it))->romClassOffset));
+		break;
+	case TYPE_ROMCLASS:
+	case TYPE_SCOPED_ROMCLASS:
+		romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(it))->romClassOffset));
+		break;
+	default:
+		return NULL;
+	}
+	return J9ROMCLASS_CLASSNAME(romClass);
+}
+
+/**
+ * Store a lookup index of the items in the top layer so that JVMs which later use the layer as a lower layer
+ * can populate their hashtables without walking every item in it. See readCacheFromLookupIndex().
+ *
+ * The index is stored when -Xshareclasses:lookupIndex is specified and the layer has never had an index.
+ * The option is meant for the last JVM to use the layer before a layer is created above it, which finalizes it.
+ * An index is never replaced, even once later updates make it stale, so that JVMs exiting after each other
+ * cannot fill the cache with copies of it. A layer with a stale index is read in full when used as a lower layer.
+ *
+ * @param [in] currentThread  The current thread
+ */
+void
+SH_CacheMap::storeLookupIndex(J9VMThread* currentThread)
+{
+	const char* fnName = "storeLookupIndex";
+	J9InternalVMFunctions* vmFunctions = NULL;
+	SH_ByteDataManager* localBDM = NULL;
+	J9SharedCacheHeader* cacheHeader = NULL;
+	J9SharedLookupIndex* index = NULL;
+	U_32* eagerOffsets = NULL;
+	J9SharedLookupIndexEntry* lazyEntries = NULL;
+	U_32 eagerCount = 0;
+	U_32 lazyCount = 0;
+	UDATA updateCount = 0;
+	ShcItem* it = NULL;
+	J9SharedDataDescriptor data;
+	BlockPtr indexInCache = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((NULL == currentThread)
+		|| J9_ARE_NO_BITS_SET(_sharedClassConfig->runtimeFlags2, J9SHR_RUNTIMEFLAG2_ENABLE_LOOKUP_INDEX)
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY | J9SHR_RUNTIMEFLAG_ENABLE_STATS | J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES)
+		|| !_ccHead->isStarted()
+		|| _ccHead->hasLookupIndex()
+		|| (NULL == (localBDM = getByteDataManager(currentThread)))
+	) {
+		return;
+	}
+	vmFunctions = currentThread->javaVM->internalVMFunctions;
+
+	if (_ccHead->enterWriteMutex(currentThread, false, fnName) != 0) {
+		return;
+	}
+	/* Another JVM may have stored the index since it was checked above */
+	if (_ccHead->hasLookupIndex() || (runEntryPointChecks(currentThread, NULL, NULL) == -1)) {
+		goto _done;
+	}
+	cacheHeader = _ccHead->getCacheHeaderAddress();
+	updateCount = _ccHead->getUpdateCount();
+
+	_ccHead->findStart(currentThread);
+	while (NULL != (it = (ShcItem*)_ccHead->nextEntry(currentThread, NULL))) {
+		if (NULL != getLookupIndexKey(it)) {
+			lazyCount += 1;
+		} else {
+			eagerCount += 1;
+		}
+	}
+
+	data.length = LOOKUPINDEX_LEN(eagerCount, lazyCount);
+	if (NULL == (index = (J9SharedLookupIndex*)j9mem_allocate_memory(data.length, J9MEM_CATEGORY_CLASSES))) {
+		goto _done;
+	}
+	index->eagerItemCount = eagerCount;
+	index->lazyItemCount = lazyCount;
+	eagerOffsets = LOOKUPINDEX_EAGER_OFFSETS(index);
+	lazyEntries = LOOKUPINDEX_LAZY_ENTRIES(index);
+	eagerCount = 0;
+	lazyCount = 0;
+
+	_ccHead->findStart(currentThread);
+	while (NULL != (it = (ShcItem*)_ccHead->nextEntry(currentThread, NULL))) {
+		const J9UTF8* key = getLookupIndexKey(it);
+		U_32 itemOffset = (U_32)((UDATA)it - (UDATA)cacheHeader);
+
+		if (NULL != key) {
+			lazyEntries[lazyCount].keyHash = SH_Manager::generateLookupIndexHash(vmFunctions, J9UTF8_DATA(key), J9UTF8_LENGTH(key));
+			lazyEntries[lazyCount].itemOffset = itemOffset;
+			lazyCount += 1;
+		} else {
+			eagerOffsets[eagerCount] = itemOffset;
+			eagerCount += 1;
+		}
+	}
+	J9_SORT(lazyEntries, (UDATA)lazyCount, sizeof(J9SharedLookupIndexEntry), compareLookupIndexEntries);
+
+	data.address = (U_8*)index;
+	data.type = J9SHR_DATA_TYPE_LOOKUPINDEX;
+	data.flags = J9SHRDATA_NOT_INDEXED;
+	indexInCache = addByteDataToCache(currentThread, localBDM, NULL, &data, NULL, false);
+	if (NULL != indexInCache) {
+		_ccHead->setLookupIndex(currentThread, (J9SharedLookupIndex*)indexInCache, updateCount);
+	}
+	j9mem_free_memory(index);
+
+_done:
+	_ccHead->exitWriteMutex(currentThread, fnName);
+}
+
 /* THREADING: MUST be protected by cache write mutex - therefore single-threaded within this JVM */
 IDATA
 SH_CacheMap::checkForCrash(J9VMThread* currentThread, bool hasClassSegmentMutex, bool canUnlockCache)
@@ -5308,6 +5524,7 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	SH_CompositeCacheImpl* cache = _ccHead;
 
 	printShutdownStats();
+	storeLookupIndex(currentThread);
 
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
@@ -6748,6 +6965,56 @@ SH_CacheMap::updateLocalHintsData(J9VMThread* currentThread, J9SharedLocalStartu
 	memcpy(&localHints->hintsData, &updatedHintsData, sizeof(J9SharedStartupHintsDataDescriptor));
 }
 
+/**
+ * Orders lookup index entries by key hash, and entries with the same hash in cache order.
+ * Items are allocated downwards from the end of the cache, so earlier items have larger offsets.
+ */
+static int
+compareLookupIndexEntries(const void *left, const void *right)
+{
+	const J9SharedLookupIndexEntry* leftEntry = (const J9SharedLookupIndexEntry*)left;
+	const J9SharedLookupIndexEntry* rightEntry = (const J9SharedLookupIndexEntry*)right;
+
+	if (leftEntry->keyHash != rightEntry->keyHash) {
+		return (leftEntry->keyHash < rightEntry->keyHash) ? -1 : 1;
+	}
+	if (leftEntry->itemOffset != rightEntry->itemOffset) {
+		return (leftEntry->itemOffset > rightEntry->itemOffset) ? -1 : 1;
+	}
+	return 0;
+}
+
+/**
+ * Returns the item at itemOffset from the cache header, or NULL if the offset is not that of a valid item in the metadata area.
+ */
+static const ShcItem*
+getLookupIndexItem(const J9SharedCacheHeader* cacheHeader, U_32 itemOffset)
+{
+	const ShcItem* it = NULL;
+	UDATA itemType = 0;
+
+	if ((itemOffset < cacheHeader->updateSRP)
+		|| ((itemOffset + sizeof(ShcItem)) > (cacheHeader->totalBytes - cacheHeader->debugRegionSize))
+	) {
+		return NULL;
+	}
+	it = (const ShcItem*)(((U_8*)cacheHeader) + itemOffset);
+	itemType = ITEMTYPE(it);
+	if ((itemType <= TYPE_UNINITIALIZED) || (itemType > MAX_DATA_TYPES)) {
+		return NULL;
+	}
+	return it;
+}
+
+/**
+ * Returns whether items of itemType are hashed on a class name, see SH_CacheMap::getLookupIndexKey().
+ */
+static bool
+isLookupIndexKeyedType(UDATA itemType)
+{
+	return (TYPE_ORPHAN == itemType) || (TYPE_ROMCLASS == itemType) || (TYPE_SCOPED_ROMCLASS == itemType);
+}
+
 static void
 checkROMClassUTF8SRPs(J9ROMClass *romClass)
 {
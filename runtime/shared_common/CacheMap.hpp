@@ -38,6 +38,7 @@
 #define CM_READ_CACHE_FAILED -1
 #define CM_CACHE_CORRUPT -2
 #define CM_CACHE_STORE_PREREQ_ID_FAILED -3
+#define CM_NO_LOOKUP_INDEX -4
 
 #define CM_CACHE_MAX_METADATA_RELEASES 2
 
@@ -225,6 +226,8 @@ public:
 	/* @see CacheMapStats.hpp */
 	U_8* getDataFromByteDataWrapper(const ByteDataWrapper* bdw);
 
+	const J9UTF8* getLookupIndexKey(const ShcItem* it);
+
 	//New Functions To Support New ROM Class Builder
 	IDATA startClassTransaction(J9VMThread* currentThread, bool lockCache, const char* caller);
 	IDATA exitClassTransaction(J9VMThread* currentThread, const char* caller);
@@ -335,6 +338,10 @@ private:
 
 	IDATA readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, IDATA expectedUpdates, bool startupForStats);
 
+	IDATA readCacheFromLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache);
+
+	void storeLookupIndex(J9VMThread* currentThread);
+
 	IDATA refreshHashtables(J9VMThread* currentThread, bool hasClassSegmentMutex);
 
 	ClasspathWrapper* addClasspathToCache(J9VMThread* currentThread, ClasspathItem* obj);
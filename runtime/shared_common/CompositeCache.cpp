@@ -159,8 +159,8 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
 	ca->extraStartupHints = DEFAULT_STARTUPHINTS;
-	ca->unused8 = 0;
-	ca->unused9 = 0;
+	ca->lookupIndexSRP = 0;
+	ca->lookupIndexUpdateCount = 0;
 	ca->unused10 = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
 	WSRP_SET(ca->updateCountPtr, &(ca->updateCount));
@@ -3226,6 +3226,95 @@ SH_CompositeCacheImpl::getCacheHeaderAddress(void)
 	return _theca;
 }
 
+/**
+ * Returns the number of updates made to the cache.
+ *
+ * @pre The caller should hold the shared classes cache write mutex if the value is compared to a later one
+ */
+UDATA
+SH_CompositeCacheImpl::getUpdateCount(void)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return 0;
+	}
+	return *WSRP_GET(_theca->updateCountPtr, UDATA*);
+}
+
+/**
+ * Returns the lookup index of the cache, provided it still describes every item in the cache.
+ *
+ * The index is stored after the items it describes, so it is current only if it was the last update to the cache.
+ *
+ * @return The lookup index, or NULL if there is none, it is out of date or it lies outside the metadata area
+ */
+const J9SharedLookupIndex*
+SH_CompositeCacheImpl::getLookupIndex(void)
+{
+	BlockPtr index = NULL;
+	BlockPtr metadataEnd = NULL;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+	if ((0 == _theca->lookupIndexSRP)
+		|| (getUpdateCount() != (_theca->lookupIndexUpdateCount + 1))
+	) {
+		return NULL;
+	}
+	index = ((BlockPtr)_theca) + _theca->lookupIndexSRP;
+	metadataEnd = CAEND(_theca) - _theca->debugRegionSize;
+	if ((index < UPDATEPTR(_theca))
+		|| ((index + sizeof(J9SharedLookupIndex)) > metadataEnd)
+		|| ((index + LOOKUPINDEX_LEN((UDATA)((J9SharedLookupIndex*)index)->eagerItemCount, (UDATA)((J9SharedLookupIndex*)index)->lazyItemCount)) > metadataEnd)
+	) {
+		return NULL;
+	}
+	return (const J9SharedLookupIndex*)index;
+}
+
+/**
+ * Returns whether a lookup index was ever recorded for the cache, whether or not it is still current.
+ */
+bool
+SH_CompositeCacheImpl::hasLookupIndex(void)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return false;
+	}
+	return (0 != _theca->lookupIndexSRP);
+}
+
+/**
+ * Records the lookup index of the cache in the cache header.
+ *
+ * The index is only recorded if it was the only item stored since it was built.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] index  The lookup index, in the metadata area of this cache
+ * @param [in] updateCount  The update count of the cache when the index was built
+ *
+ * @pre The caller MUST hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::setLookupIndex(J9VMThread* currentThread, const J9SharedLookupIndex* index, UDATA updateCount)
+{
+	if (!_started || _readOnlyOSCache) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	Trc_SHR_Assert_Equals(currentThread, _commonCCInfo->hasWriteMutexThread);
+
+	if (getUpdateCount() == (updateCount + 1)) {
+		unprotectHeaderReadWriteArea(currentThread, false);
+		_theca->lookupIndexUpdateCount = updateCount;
+		_theca->lookupIndexSRP = (UDATA)index - (UDATA)_theca;
+		protectHeaderReadWriteArea(currentThread, false);
+	}
+}
+
 /**
  * Utility function for finding the address of the start of the String Table
  * data which is currently the same as the start of the readWrite data.
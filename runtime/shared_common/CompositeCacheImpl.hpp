@@ -153,6 +153,14 @@ public:
 	void* getBaseAddress(void);
 
 	J9SharedCacheHeader* getCacheHeaderAddress(void);
+
+	UDATA getUpdateCount(void);
+
+	const J9SharedLookupIndex* getLookupIndex(void);
+
+	bool hasLookupIndex(void);
+
+	void setLookupIndex(J9VMThread* currentThread, const J9SharedLookupIndex* index, UDATA updateCount);
 	
 	void* getStringTableBase(void);
 
@@ -33,6 +33,8 @@
 #include "CacheMap.hpp"
 #include "AtomicSupport.hpp"
 
+#include <stdlib.h>
+
 /**
  * Constructor
  */
@@ -45,7 +47,10 @@ SH_Manager::SH_Manager()
    _htEntries(0),
    _runtimeFlagsPtr(0),
    _verboseFlags(0),
-   _state(0)
+   _state(0),
+   _lazyItems(NULL),
+   _lazyItemsToStore(0),
+   _storingLazyItems(false)
 {
 }
 
@@ -269,6 +274,7 @@ SH_Manager::cleanup(J9VMThread* currentThread)
 	if ((_state == MANAGER_STATE_STARTED) || (_state == MANAGER_STATE_STARTING)) {
 		if (!_htMutex || (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup")==0)) {
 			tearDownHashTable(currentThread);
+			freeLazyItems();
 			localPostCleanup(currentThread);
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup");
 		}
@@ -302,10 +308,18 @@ SH_Manager::reset(J9VMThread* currentThread)
 
 	if (_state == MANAGER_STATE_STARTED) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "reset")==0) {
+			LazyItems* walk = NULL;
+
 			tearDownHashTable(currentThread);
 			if (initializeHashTable(currentThread) == -1) {
 				returnVal = -1;
 			}
+			/* Lower layers do not change, so their lazy items are simply stored again on demand */
+			_lazyItemsToStore = 0;
+			for (walk = _lazyItems; NULL != walk; walk = walk->_next) {
+				memset(walk->_stored, 0, (walk->_count + 7) / 8);
+				_lazyItemsToStore += walk->_count;
+			}
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "reset");
 		}
 	}
@@ -411,6 +425,9 @@ SH_Manager::hllTableLookup(J9VMThread* currentThread, const char* name, U_16 nam
 	Trc_SHR_M_hllTableLookup_Entry(currentThread, nameLen, name);
 
 	if (lockHashTable(currentThread, "hllTableLookup")) {
+		if (0 != _lazyItemsToStore) {
+			storeLazyItems(currentThread, (const U_8*)name, nameLen);
+		}
 		result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
 		unlockHashTable(currentThread, "hllTableLookup");
 	} else {
@@ -454,6 +471,12 @@ SH_Manager::hllTableUpdate(J9VMThread* currentThread, const J9Pool* linkPool, co
 	
 	Trc_SHR_M_hllTableUpdate_Entry(currentThread, J9UTF8_LENGTH(key), J9UTF8_DATA(key), item);
 
+	/* Lazy items of lower layers must precede the new item in the list for its key */
+	if ((0 != _lazyItemsToStore) && lockHashTable(currentThread, "hllTableUpdate")) {
+		storeLazyItems(currentThread, J9UTF8_DATA(key), J9UTF8_LENGTH(key));
+		unlockHashTable(currentThread, "hllTableUpdate");
+	}
+
 	/**
 	 * @bug Incorrect synchronization of hashtable. Another thread could walk the linked list 
 	 * as we're modifying it. Unlikely to occur because most callers require the VM class segment mutex.
@@ -569,6 +592,15 @@ SH_Manager::getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA*
 
 		/* WARNING - currentThread can be NULL */
 		if (lockHashTable(currentThread, "getNumItems")) {
+			if (0 != _lazyItemsToStore) {
+				if (NULL != currentThread) {
+					/* Walk every item through the hashtable, as a full read of the cache would */
+					storeAllLazyItems(currentThread);
+				} else {
+					/* Collecting javacore data must not allocate, so count the items still in the lookup index */
+					countLazyItems(&countData);
+				}
+			}
 			hashTableForEachDo(_hashTable, _hashTableGetNumItemsDoFn, &countData);
 			unlockHashTable(currentThread, "getNumItems");
 		}
@@ -609,3 +641,291 @@ SH_Manager::isDataTypeRepresended(UDATA type)
 	return false;
 }
 
+/**
+ * Hash of an item key as recorded in a J9SharedLookupIndexEntry.
+ *
+ * Lambda class names are truncated as in HashLinkedListImpl::initialize(), so that an entry is found
+ * by every name that shares its hashtable key.
+ */
+U_32
+SH_Manager::generateLookupIndexHash(J9InternalVMFunctions* internalFunctionTable, const U_8* key, U_16 keySize)
+{
+#if JAVA_SPEC_VERSION < 21
+	char *end = getLastDollarSignOfLambdaClassName((const char *)key, keySize);
+	if (NULL != end) {
+		keySize = (U_16)(end - (const char *)key + 1);
+	}
+#endif /* JAVA_SPEC_VERSION < 21 */
+	return (U_32)generateHash(internalFunctionTable, (U_8*)key, keySize);
+}
+
+/**
+ * Registers the items of a lower cache layer that are stored in the hashtable only when their key is
+ * first looked up or updated. Layers must be added from the lowest up, so that list order matches a full read.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cachelet The cache layer, passed to storeNew()
+ * @param[in] cacheHeader The header of the cache layer, which the entry offsets are relative to
+ * @param[in] entries The entries, sorted by keyHash and then in cache order
+ * @param[in] count The number of entries
+ *
+ * @return 0 for success, -1 for failure
+ */
+/* THREADING: Must only be called single-threaded, during cache startup */
+IDATA
+SH_Manager::addLazyItems(J9VMThread* currentThread, SH_CompositeCache* cachelet, const J9SharedCacheHeader* cacheHeader, const J9SharedLookupIndexEntry* entries, U_32 count)
+{
+	LazyItems* newItems = NULL;
+	LazyItems** tail = &_lazyItems;
+	UDATA bitmapBytes = (count + 7) / 8;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (getState() != MANAGER_STATE_STARTED) {
+		return -1;
+	}
+	if (0 == count) {
+		return 0;
+	}
+	if (!(newItems = (LazyItems*)j9mem_allocate_memory(sizeof(LazyItems) + bitmapBytes, J9MEM_CATEGORY_CLASSES))) {
+		return -1;
+	}
+	newItems->_cachelet = cachelet;
+	newItems->_cacheHeader = cacheHeader;
+	newItems->_entries = entries;
+	newItems->_count = count;
+	newItems->_stored = (U_8*)(newItems + 1);
+	newItems->_next = NULL;
+	memset(newItems->_stored, 0, bitmapBytes);
+
+	if (!lockHashTable(currentThread, "addLazyItems")) {
+		j9mem_free_memory(newItems);
+		return -1;
+	}
+	while (NULL != *tail) {
+		tail = &((*tail)->_next);
+	}
+	*tail = newItems;
+	_lazyItemsToStore += count;
+	unlockHashTable(currentThread, "addLazyItems");
+	return 0;
+}
+
+/**
+ * Stores the lazy items whose key hashes like the one given, lowest layer first and in cache order.
+ *
+ * storeNew() looks up the key it stores, which must not recurse into storing further lazy items.
+ *
+ * THREADING: Must be protected by hashtable mutex
+ */
+void
+SH_Manager::storeLazyItems(J9VMThread* currentThread, const U_8* key, U_16 keySize)
+{
+	U_32 keyHash = 0;
+	LazyItems* walk = NULL;
+
+	if (_storingLazyItems) {
+		return;
+	}
+	_storingLazyItems = true;
+	keyHash = generateLookupIndexHash(currentThread->javaVM->internalVMFunctions, key, keySize);
+
+	for (walk = _lazyItems; NULL != walk; walk = walk->_next) {
+		U_32 low = 0;
+		U_32 high = walk->_count;
+
+		/* Binary search for the first entry with keyHash */
+		while (low < high) {
+			U_32 mid = low + ((high - low) / 2);
+			if (walk->_entries[mid].keyHash < keyHash) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+		for (; (low < walk->_count) && (walk->_entries[low].keyHash == keyHash); low++) {
+			U_8 mask = (U_8)(1 << (low % 8));
+
+			if (J9_ARE_NO_BITS_SET(walk->_stored[low / 8], mask)) {
+				const ShcItem* item = (const ShcItem*)(((U_8*)walk->_cacheHeader) + walk->_entries[low].itemOffset);
+
+				if (!isLazyItemKeyValid(currentThread, walk, low)) {
+					/* The index does not describe this layer after all */
+					storeLazyItemsWithoutIndex(currentThread, walk);
+					break;
+				}
+				walk->_stored[low / 8] |= mask;
+				_lazyItemsToStore -= 1;
+				storeNew(currentThread, item, walk->_cachelet);
+			}
+		}
+	}
+	_storingLazyItems = false;
+}
+
+/**
+ * Checks that the item of a lazy entry is hashed on a key with the hash recorded for it in the lookup index.
+ * The index is only checked up front as far as possible without reading the keys, which are read here instead.
+ */
+bool
+SH_Manager::isLazyItemKeyValid(J9VMThread* currentThread, LazyItems* items, U_32 entryIndex)
+{
+	const ShcItem* item = (const ShcItem*)(((U_8*)items->_cacheHeader) + items->_entries[entryIndex].itemOffset);
+	const J9UTF8* key = _cache->getLookupIndexKey(item);
+
+	return (NULL != key)
+		&& (items->_entries[entryIndex].keyHash == generateLookupIndexHash(currentThread->javaVM->internalVMFunctions, J9UTF8_DATA(key), J9UTF8_LENGTH(key)));
+}
+
+static int
+compareItemOffsets(const void *left, const void *right)
+{
+	U_32 leftOffset = *(const U_32*)left;
+	U_32 rightOffset = *(const U_32*)right;
+
+	if (leftOffset == rightOffset) {
+		return 0;
+	}
+	return (leftOffset < rightOffset) ? -1 : 1;
+}
+
+/**
+ * Stores the items of a layer whose lookup index turned out not to describe it, walking every item of
+ * the layer as a full read of it would. Items already stored from the index are not stored again.
+ * Lower layers are never updated, so the walk does not need the cache mutex.
+ *
+ * THREADING: Must be protected by hashtable mutex
+ */
+void
+SH_Manager::storeLazyItemsWithoutIndex(J9VMThread* currentThread, LazyItems* items)
+{
+	const J9SharedCacheHeader* header = items->_cacheHeader;
+	const U_8* layerStart = (const U_8*)header;
+	const U_8* metadataStart = layerStart + header->updateSRP;
+	ShcItemHdr* ih = (ShcItemHdr*)(layerStart + header->totalBytes - header->debugRegionSize - sizeof(ShcItemHdr));
+	U_32* storedOffsets = NULL;
+	U_32 storedCount = 0;
+	U_32 i = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	Trc_SHR_M_storeLazyItemsWithoutIndex(currentThread, _managerType, header);
+
+	storedOffsets = (U_32*)j9mem_allocate_memory(sizeof(U_32) * items->_count, J9MEM_CATEGORY_CLASSES);
+	for (i = 0; i < items->_count; i++) {
+		U_8 mask = (U_8)(1 << (i % 8));
+
+		if (J9_ARE_ANY_BITS_SET(items->_stored[i / 8], mask)) {
+			if (NULL != storedOffsets) {
+				storedOffsets[storedCount] = items->_entries[i].itemOffset;
+				storedCount += 1;
+			}
+		} else {
+			items->_stored[i / 8] |= mask;
+			_lazyItemsToStore -= 1;
+		}
+	}
+	if (NULL == storedOffsets) {
+		/* Without the offsets the walk would store some items twice. Missing items only cost cache misses. */
+		return;
+	}
+	J9_SORT(storedOffsets, (UDATA)storedCount, sizeof(U_32), compareItemOffsets);
+
+	while ((const U_8*)ih > metadataStart) {
+		UDATA itemLen = CCITEMLEN(ih);
+		const ShcItem* item = NULL;
+		U_32 itemOffset = 0;
+
+		if ((0 == itemLen) || (itemLen > (UDATA)(((const U_8*)ih) - metadataStart + sizeof(ShcItemHdr)))) {
+			/* A corrupt length; a full read would report the cache as corrupt */
+			break;
+		}
+		item = (const ShcItem*)CCITEM(ih);
+		itemOffset = (U_32)((const U_8*)item - layerStart);
+		if (isDataTypeRepresended(ITEMTYPE(item))
+			&& (NULL == bsearch(&itemOffset, storedOffsets, storedCount, sizeof(U_32), compareItemOffsets))
+		) {
+			storeNew(currentThread, item, items->_cachelet);
+		}
+		ih = CCITEMNEXT(ih);
+	}
+
+	j9mem_free_memory(storedOffsets);
+}
+
+/**
+ * Stores every lazy item not yet in the hashtable, lowest layer first and in cache order for each key.
+ * Used before walking the whole hashtable, which would otherwise miss the items of lower layers read
+ * from a lookup index whose keys were never looked up.
+ *
+ * THREADING: Must be protected by hashtable mutex
+ */
+void
+SH_Manager::storeAllLazyItems(J9VMThread* currentThread)
+{
+	LazyItems* walk = NULL;
+
+	if (_storingLazyItems) {
+		return;
+	}
+	_storingLazyItems = true;
+	for (walk = _lazyItems; (NULL != walk) && (0 != _lazyItemsToStore); walk = walk->_next) {
+		U_32 i = 0;
+
+		for (i = 0; i < walk->_count; i++) {
+			U_8 mask = (U_8)(1 << (i % 8));
+
+			if (J9_ARE_NO_BITS_SET(walk->_stored[i / 8], mask)) {
+				const ShcItem* item = (const ShcItem*)(((U_8*)walk->_cacheHeader) + walk->_entries[i].itemOffset);
+
+				if (!isLazyItemKeyValid(currentThread, walk, i)) {
+					storeLazyItemsWithoutIndex(currentThread, walk);
+					break;
+				}
+				walk->_stored[i / 8] |= mask;
+				_lazyItemsToStore -= 1;
+				storeNew(currentThread, item, walk->_cachelet);
+			}
+		}
+	}
+	_storingLazyItems = false;
+}
+
+/**
+ * Adds the lazy items not yet in the hashtable to the item counts.
+ *
+ * THREADING: Must be protected by hashtable mutex
+ */
+void
+SH_Manager::countLazyItems(CountData* countData)
+{
+	LazyItems* walk = NULL;
+
+	for (walk = _lazyItems; (NULL != walk) && (0 != _lazyItemsToStore); walk = walk->_next) {
+		U_32 i = 0;
+
+		for (i = 0; i < walk->_count; i++) {
+			if (J9_ARE_NO_BITS_SET(walk->_stored[i / 8], (U_8)(1 << (i % 8)))) {
+				const ShcItem* item = (const ShcItem*)(((U_8*)walk->_cacheHeader) + walk->_entries[i].itemOffset);
+
+				if (countData->_cache->isStale(item)) {
+					++(countData->_staleItems);
+				} else {
+					++(countData->_nonStaleItems);
+				}
+			}
+		}
+	}
+}
+
+void
+SH_Manager::freeLazyItems(void)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	while (NULL != _lazyItems) {
+		LazyItems* next = _lazyItems->_next;
+
+		j9mem_free_memory(_lazyItems);
+		_lazyItems = next;
+	}
+	_lazyItemsToStore = 0;
+}
@@ -149,6 +149,11 @@ public:
 
 	bool isDataTypeRepresended(UDATA type);
 
+	/* Items of a lower cache layer which are only stored in the hashtable when their key is first used */
+	IDATA addLazyItems(J9VMThread* currentThread, SH_CompositeCache* cachelet, const J9SharedCacheHeader* cacheHeader, const J9SharedLookupIndexEntry* entries, U_32 count);
+
+	static U_32 generateLookupIndexHash(J9InternalVMFunctions* internalFunctionTable, const U_8* key, U_16 keySize);
+
 protected:
 	J9HashTable* _hashTable;
 	SH_SharedCache* _cache;
@@ -211,10 +216,38 @@ protected:
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
 private:
+	/**
+	 * Sorted J9SharedLookupIndexEntry array of a cache layer, followed by a bitmap of the entries already stored
+	 */
+	class LazyItems
+	{
+	public:
+		SH_CompositeCache* _cachelet;
+		const J9SharedCacheHeader* _cacheHeader;
+		const J9SharedLookupIndexEntry* _entries;
+		U_32 _count;
+		U_8* _stored;
+		LazyItems* _next;
+	};
+
 	UDATA _state;
 
 	const char* _managerType;
 
+	LazyItems* _lazyItems;
+	UDATA _lazyItemsToStore;
+	bool _storingLazyItems;
+
+	void storeLazyItems(J9VMThread* currentThread, const U_8* key, U_16 keySize);
+
+	bool isLazyItemKeyValid(J9VMThread* currentThread, LazyItems* items, U_32 entryIndex);
+
+	void storeLazyItemsWithoutIndex(J9VMThread* currentThread, LazyItems* items);
+
+	void storeAllLazyItems(J9VMThread* currentThread);
+
+	void freeLazyItems(void);
+
 	IDATA initializeHashTable(J9VMThread* currentThread);
 
 	void tearDownHashTable(J9VMThread* currentThread);
@@ -224,6 +257,8 @@ private:
 
 	static UDATA countItemsInList(void* node, void* countData);
 
+	void countLazyItems(CountData* countData);
+
 	static UDATA generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize);
 };
 
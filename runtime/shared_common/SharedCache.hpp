@@ -114,6 +114,8 @@ public:
 	
 	virtual U_8* getDataFromByteDataWrapper(const ByteDataWrapper* bdw) = 0;
 
+	virtual const J9UTF8* getLookupIndexKey(const ShcItem* it) = 0;
+
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
@@ -200,6 +200,7 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_TEST_HALF_PAGESIZE "testHalfPageSize"
 #define OPTION_EXTRA_STARTUPHINTS_EQUALS "extraStartupHints="
 #define OPTION_SHARE_LAMBDAFORM "shareLambdaForm" /* internal option for dev/testing */
+#define OPTION_LOOKUP_INDEX "lookupIndex" /* store a lookup index of the top layer on JVM exit, once per layer */
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -6074,3 +6074,123 @@ addDoubleStruct1AndNestedDoubleStructArrayStruct2_returnStruct2_dupStruct(stru_2
 	doubleStruct.elem2 = arg1.elem2 + arg2.elem2;
 	return doubleStruct;
 }
+
+/**
+ * Add integers and floating point numbers passed in interleaved order,
+ * with the sum returned as a double.
+ *
+ * @param arg1 an integer to add
+ * @param arg2 a float to add
+ * @param arg3 a long to add
+ * @param arg4 a double to add
+ * @param arg5 a short to add
+ * @param arg6 a float to add
+ * @param arg7 a byte to add
+ * @param arg8 a double to add
+ * @return the sum of all the arguments
+ */
+double
+addMixedIntsAndFloats_returnDouble(int arg1, float arg2, LONG arg3, double arg4, short arg5, float arg6, char arg7, double arg8)
+{
+	double doubleSum = (double)arg1 + arg2 + arg3 + arg4 + arg5 + arg6 + arg7 + arg8;
+	return doubleSum;
+}
+
+/**
+ * Add integers and floating point numbers passed in interleaved order,
+ * with the sum returned as a float.
+ *
+ * @param arg1 a float to add
+ * @param arg2 an integer to add
+ * @param arg3 a double to add
+ * @param arg4 a long to add
+ * @return the sum of all the arguments
+ */
+float
+addMixedIntsAndFloats_returnFloat(float arg1, int arg2, double arg3, LONG arg4)
+{
+	float floatSum = (float)((double)arg1 + arg2 + arg3 + arg4);
+	return floatSum;
+}
+
+/**
+ * Add integers and floating point numbers passed in interleaved order,
+ * with the sum truncated to a long.
+ *
+ * @param arg1 a double to add
+ * @param arg2 a long to add
+ * @param arg3 a float to add
+ * @param arg4 an integer to add
+ * @return the sum of all the arguments
+ */
+LONG
+addMixedIntsAndFloats_returnLong(double arg1, LONG arg2, float arg3, int arg4)
+{
+	LONG longSum = (LONG)(arg1 + arg2 + arg3 + arg4);
+	return longSum;
+}
+
+/**
+ * Add an integer dereferenced from a pointer, a float and a double dereferenced from a pointer.
+ *
+ * @param arg1 a pointer to integer
+ * @param arg2 a float to add
+ * @param arg3 a pointer to double
+ * @return the sum of all the arguments
+ */
+double
+addIntFromPointerAndFloatAndDoubleFromPointer(int *arg1, float arg2, double *arg3)
+{
+	double doubleSum = (double)*arg1 + arg2 + *arg3;
+	return doubleSum;
+}
+
+/**
+ * Add 6 integers and 8 doubles passed in interleaved order, which fill up all the
+ * integer and floating point argument registers on x86-64 System V.
+ * Each argument is weighted by its position so that misplaced arguments are detected.
+ *
+ * @return the weighted sum of all the arguments
+ */
+double
+add6IntsAnd8Doubles(int arg1, double arg2, int arg3, double arg4, int arg5, double arg6, int arg7,
+		double arg8, int arg9, double arg10, int arg11, double arg12, double arg13, double arg14)
+{
+	double doubleSum = (arg1 * 1) + (arg2 * 2) + (arg3 * 3) + (arg4 * 4) + (arg5 * 5) + (arg6 * 6) + (arg7 * 7)
+			+ (arg8 * 8) + (arg9 * 9) + (arg10 * 10) + (arg11 * 11) + (arg12 * 12) + (arg13 * 13) + (arg14 * 14);
+	return doubleSum;
+}
+
+/**
+ * Add 7 integers and 9 doubles passed in interleaved order, one more of each than
+ * fit in the integer and floating point argument registers on x86-64 System V.
+ * Each argument is weighted by its position so that misplaced arguments are detected.
+ *
+ * @return the weighted sum of all the arguments
+ */
+double
+add7IntsAnd9Doubles(int arg1, double arg2, int arg3, double arg4, int arg5, double arg6, int arg7, double arg8,
+		int arg9, double arg10, int arg11, double arg12, int arg13, double arg14, double arg15, double arg16)
+{
+	double doubleSum = (arg1 * 1) + (arg2 * 2) + (arg3 * 3) + (arg4 * 4) + (arg5 * 5) + (arg6 * 6) + (arg7 * 7) + (arg8 * 8)
+			+ (arg9 * 9) + (arg10 * 10) + (arg11 * 11) + (arg12 * 12) + (arg13 * 13) + (arg14 * 14) + (arg15 * 15) + (arg16 * 16);
+	return doubleSum;
+}
+
+/**
+ * Create a struct from the sums of the integers and of the doubles passed in interleaved order.
+ *
+ * @param arg1 an integer to add
+ * @param arg2 a double to add
+ * @param arg3 an integer to add
+ * @param arg4 a double to add
+ * @return a struct with the sum of the integers and the sum of the doubles
+ */
+stru_Int_Double
+addMixedIntsAndDoubles_returnStruct(int arg1, double arg2, int arg3, double arg4)
+{
+	stru_Int_Double intDoubleStruct;
+	intDoubleStruct.elem1 = arg1 + arg3;
+	intDoubleStruct.elem2 = arg2 + arg4;
+	return intDoubleStruct;
+}
@@ -107,6 +107,8 @@ static jvmtiTest jvmtiTestList[] =
 	{ "gts001", gts001, "com.ibm.jvmti.tests.getThreadState.gts001", "GetThreadState" },
 	{ "ghftm001", ghftm001, "com.ibm.jvmti.tests.getHeapFreeTotalMemory.ghftm001", "EventGarbageCollectionCycle - check for gc cycle start/end events" },
 	{ "rat001",     rat001,   "com.ibm.jvmti.tests.removeAllTags.rat001",                     "RemoveAllTags" },
+	{ "ot001",      ot001,    "com.ibm.jvmti.tests.objectTags.ot001",                         "Object tags across moving GCs and concurrent tagging" },
+	{ "dfc001",     dfc001,   "com.ibm.jvmti.tests.decodedFrameCache.dfc001",                 "Stack traces across class redefinition, class unloading and breakpoints" },
 	{ "ts001",       ts001,   "com.ibm.jvmti.tests.traceSubscription.ts001",                  "Register a trace subscriber" },
 	{ "ts002",       ts002,   "com.ibm.jvmti.tests.traceSubscription.ts002",                  "Register a tracepoint subscriber" },
 	{ "gmcpn001", gmcpn001,   "com.ibm.jvmti.tests.getMethodAndClassNames.gmcpn001",          "Get Class, Method and Package names for a set of ram method pointers" },
@@ -144,6 +146,7 @@ static jvmtiTest jvmtiTestList[] =
 	{ "snmp001",     snmp001,    "com.ibm.jvmti.tests.setNativeMethodPrefix.snmp001", "Tests setting a native method prefix and disposing a subsequent environment"},
 #if JAVA_SPEC_VERSION >= 11	
 	{ "soae001", soae001, "com.ibm.jvmti.tests.samplingObjectAllocation.soae001", "Test JEP331 low-overhead sampling heap object allocation" },
+	{ "soae002", soae002, "com.ibm.jvmti.tests.samplingObjectAllocation.soae002", "Test JVMTI heap sampling at its own interval while JFR samples allocations" },
 #endif /* JAVA_SPEC_VERSION >= 11 */
 	{ "gsp001", gsp001, "com.ibm.jvmti.tests.getSystemProperty.gsp001", "Ensure JVMTI GetSystemProperty can retrieve certain system properties at early phrase" },
 	{ "ee001", ee001, "com.ibm.jvmti.tests.eventException.ee001", "Ensure only single JVMTI Exception event gets generated with JNI frame before handler" },
@@ -131,6 +131,14 @@ omr_add_exports(jvmtitest
 	Java_com_ibm_jvmti_tests_getHeapFreeTotalMemory_ghftm001_getCycleEndCount
 	Java_com_ibm_jvmti_tests_getMethodAndClassNames_gmcpn001_check
 	Java_com_ibm_jvmti_tests_removeAllTags_rat001_tryRemoveAllTags
+	Java_com_ibm_jvmti_tests_objectTags_ot001_tagObjects
+	Java_com_ibm_jvmti_tests_objectTags_ot001_checkTags
+	Java_com_ibm_jvmti_tests_objectTags_ot001_checkUntagged
+	Java_com_ibm_jvmti_tests_objectTags_ot001_retagObjects
+	Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_redefineClass
+	Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_setBreakpoint
+	Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_clearBreakpoint
+	Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_getBreakpointCount
 	Java_com_ibm_jvmti_tests_traceSubscription_ts001_tryRegisterTraceSubscriber
 	Java_com_ibm_jvmti_tests_traceSubscription_ts001_tryFlushTraceData
 	Java_com_ibm_jvmti_tests_traceSubscription_ts001_tryDeregisterTraceSubscriber
@@ -226,6 +234,9 @@ if(NOT JAVA_SPEC_VERSION LESS 11)
 		Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae001_enable
 		Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae001_disable
 		Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae001_check
+		Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae002_enable
+		Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae002_disable
+		Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae002_check
 	)
 endif()
 
@@ -222,6 +222,8 @@ jint JNICALL gomi002(agentEnv * env, char * args);
 jint JNICALL gts001(agentEnv * env, char * args);
 jint JNICALL ghftm001(agentEnv * env, char * args);
 jint JNICALL rat001(agentEnv * env, char * args);
+jint JNICALL ot001(agentEnv * env, char * args);
+jint JNICALL dfc001(agentEnv * env, char * args);
 jint JNICALL ts001(agentEnv * env, char * args);
 jint JNICALL ts002(agentEnv * env, char * args);
 jint JNICALL gmcpn001(agentEnv * env, char * args);
@@ -256,6 +258,7 @@ jint JNICALL mt001(agentEnv * agent_env, char * args);
 jint JNICALL nmr001(agentEnv * agent_env, char * args);
 jint JNICALL snmp001(agentEnv * agent_env, char * args);
 jint JNICALL soae001(agentEnv * agent_env, char * args);
+jint JNICALL soae002(agentEnv * agent_env, char * args);
 jint JNICALL gsp001(agentEnv *agent_env, char *args);
 jint JNICALL ee001(agentEnv *agent_env, char *args);
 jint JNICALL vmstart001(agentEnv* agent_env, char* args);
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include <string.h>
+
+#include "jvmti_test.h"
+
+static agentEnv * env;
+static volatile jint breakpointCount = 0;
+
+static void JNICALL
+breakpointEvent(jvmtiEnv *jvmti_env, JNIEnv *jni_env, jthread thread, jmethodID method, jlocation location)
+{
+	breakpointCount += 1;
+}
+
+jint JNICALL
+dfc001(agentEnv * agent_env, char * args)
+{
+	jvmtiError err = JVMTI_ERROR_NONE;
+	jvmtiCapabilities capabilities;
+	jvmtiEventCallbacks callbacks;
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+
+	env = agent_env;
+
+	memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+	capabilities.can_redefine_classes = 1;
+	capabilities.can_generate_breakpoint_events = 1;
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "Failed to AddCapabilities");
+		return JNI_ERR;
+	}
+
+	memset(&callbacks, 0, sizeof(jvmtiEventCallbacks));
+	callbacks.Breakpoint = breakpointEvent;
+	err = (*jvmti_env)->SetEventCallbacks(jvmti_env, &callbacks, sizeof(jvmtiEventCallbacks));
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "Failed to set callback for Breakpoint events");
+		return JNI_ERR;
+	}
+
+	err = (*jvmti_env)->SetEventNotificationMode(jvmti_env, JVMTI_ENABLE, JVMTI_EVENT_BREAKPOINT, NULL);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "Failed to enable Breakpoint event");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_redefineClass(JNIEnv * jni_env, jclass klass, jclass originalClass, jint classBytesSize, jbyteArray classBytes)
+{
+	JVMTI_ACCESS_FROM_AGENT(env);
+	jbyte * class_bytes = NULL;
+	jvmtiClassDefinition classdef;
+	jvmtiError err = JVMTI_ERROR_NONE;
+
+	err = (*jvmti_env)->Allocate(jvmti_env, classBytesSize, (unsigned char **) &class_bytes);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "Unable to allocate temp buffer for the class file");
+		return JNI_FALSE;
+	}
+
+	(*jni_env)->GetByteArrayRegion(jni_env, classBytes, 0, classBytesSize, class_bytes);
+
+	classdef.class_bytes = (unsigned char *) class_bytes;
+	classdef.class_byte_count = classBytesSize;
+	classdef.klass = originalClass;
+
+	err = (*jvmti_env)->RedefineClasses(jvmti_env, 1, &classdef);
+	(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *) class_bytes);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "RedefineClasses failed");
+		return JNI_FALSE;
+	}
+
+	return JNI_TRUE;
+}
+
+/* Set or clear a breakpoint at the start of a static method. Setting the first breakpoint in a
+ * method makes the interpreter run a copy of its bytecodes; clearing the last one frees the copy.
+ */
+static jboolean
+changeBreakpoint(JNIEnv * jni_env, jclass clazz, jstring methodName, jstring methodSig, jboolean set)
+{
+	JVMTI_ACCESS_FROM_AGENT(env);
+	jvmtiError err = JVMTI_ERROR_NONE;
+	const char * utfMethodName = NULL;
+	const char * utfMethodSig = NULL;
+	jmethodID methodID = NULL;
+	jboolean rc = JNI_FALSE;
+
+	utfMethodName = (*jni_env)->GetStringUTFChars(jni_env, methodName, NULL);
+	if (NULL == utfMethodName) {
+		error(env, JVMTI_ERROR_OUT_OF_MEMORY, "Failed to get UTF characters for method name string");
+		goto done;
+	}
+	utfMethodSig = (*jni_env)->GetStringUTFChars(jni_env, methodSig, NULL);
+	if (NULL == utfMethodSig) {
+		error(env, JVMTI_ERROR_OUT_OF_MEMORY, "Failed to get UTF characters for method signature string");
+		goto done;
+	}
+
+	methodID = (*jni_env)->GetStaticMethodID(jni_env, clazz, utfMethodName, utfMethodSig);
+	if (NULL == methodID) {
+		error(env, JVMTI_ERROR_INVALID_METHODID, "Failed to find method %s%s", utfMethodName, utfMethodSig);
+		goto done;
+	}
+
+	if (set) {
+		err = (*jvmti_env)->SetBreakpoint(jvmti_env, methodID, 0);
+	} else {
+		err = (*jvmti_env)->ClearBreakpoint(jvmti_env, methodID, 0);
+	}
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "%s breakpoint in %s%s failed", set ? "Setting" : "Clearing", utfMethodName, utfMethodSig);
+		goto done;
+	}
+	rc = JNI_TRUE;
+
+done:
+	if (NULL != utfMethodSig) {
+		(*jni_env)->ReleaseStringUTFChars(jni_env, methodSig, utfMethodSig);
+	}
+	if (NULL != utfMethodName) {
+		(*jni_env)->ReleaseStringUTFChars(jni_env, methodName, utfMethodName);
+	}
+	return rc;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_setBreakpoint(JNIEnv * jni_env, jclass klass, jclass clazz, jstring methodName, jstring methodSig)
+{
+	return changeBreakpoint(jni_env, clazz, methodName, methodSig, JNI_TRUE);
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_clearBreakpoint(JNIEnv * jni_env, jclass klass, jclass clazz, jstring methodName, jstring methodSig)
+{
+	return changeBreakpoint(jni_env, clazz, methodName, methodSig, JNI_FALSE);
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_decodedFrameCache_dfc001_getBreakpointCount(JNIEnv * jni_env, jclass klass)
+{
+	return breakpointCount;
+}
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "jvmti_test.h"
+
+static agentEnv * env;
+
+jint JNICALL
+ot001(agentEnv * agent_env, char * args)
+{
+	jvmtiCapabilities caps;
+	jvmtiError err;
+
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+	env = agent_env;
+
+	memset(&caps, 0, sizeof(jvmtiCapabilities));
+	caps.can_tag_objects = 1;
+
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &caps);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "AddCapabilities failed");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+/**
+ * Tag every non null element of objects with firstTag plus its index.
+ */
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_objectTags_ot001_tagObjects(JNIEnv * jni_env, jclass clazz, jobjectArray objects, jlong firstTag)
+{
+	jvmtiEnv * jvmti_env = env->jvmtiEnv;
+	jsize count = (*jni_env)->GetArrayLength(jni_env, objects);
+	jsize i;
+
+	for (i = 0; i < count; i++) {
+		jobject object = (*jni_env)->GetObjectArrayElement(jni_env, objects, i);
+		if (NULL != object) {
+			jvmtiError err = (*jvmti_env)->SetTag(jvmti_env, object, firstTag + i);
+			(*jni_env)->DeleteLocalRef(jni_env, object);
+			if (JVMTI_ERROR_NONE != err) {
+				error(env, err, "SetTag() failed for element %d", i);
+				return JNI_FALSE;
+			}
+		}
+	}
+
+	return JNI_TRUE;
+}
+
+/**
+ * Check that GetTag() returns firstTag plus its index for every non null element of objects,
+ * and that GetObjectsWithTags() for the range of tags returns exactly those elements.
+ */
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_objectTags_ot001_checkTags(JNIEnv * jni_env, jclass clazz, jobjectArray objects, jlong firstTag)
+{
+	jvmtiEnv * jvmti_env = env->jvmtiEnv;
+	jsize count = (*jni_env)->GetArrayLength(jni_env, objects);
+	jsize expectedCount = 0;
+	jint resultCount = 0;
+	jobject * resultObjects = NULL;
+	jlong * resultTags = NULL;
+	jlong * tags = NULL;
+	jboolean rc = JNI_FALSE;
+	jvmtiError err;
+	jsize i;
+
+	for (i = 0; i < count; i++) {
+		jobject object = (*jni_env)->GetObjectArrayElement(jni_env, objects, i);
+		if (NULL != object) {
+			jlong tag = 0;
+			err = (*jvmti_env)->GetTag(jvmti_env, object, &tag);
+			(*jni_env)->DeleteLocalRef(jni_env, object);
+			if (JVMTI_ERROR_NONE != err) {
+				error(env, err, "GetTag() failed for element %d", i);
+				return JNI_FALSE;
+			}
+			if ((firstTag + i) != tag) {
+				error(env, JVMTI_ERROR_NONE, "GetTag() returned %lld for element %d, expected %lld", tag, i, firstTag + i);
+				return JNI_FALSE;
+			}
+			expectedCount += 1;
+		}
+	}
+
+	tags = malloc(sizeof(jlong) * count);
+	if (NULL == tags) {
+		error(env, JVMTI_ERROR_OUT_OF_MEMORY, "Failed to allocate the tag list");
+		return JNI_FALSE;
+	}
+	for (i = 0; i < count; i++) {
+		tags[i] = firstTag + i;
+	}
+
+	err = (*jvmti_env)->GetObjectsWithTags(jvmti_env, count, tags, &resultCount, &resultObjects, &resultTags);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "GetObjectsWithTags() failed");
+		goto done;
+	}
+	if (expectedCount != resultCount) {
+		error(env, JVMTI_ERROR_NONE, "GetObjectsWithTags() found %d objects, expected %d", resultCount, expectedCount);
+		goto done;
+	}
+
+	rc = JNI_TRUE;
+	for (i = 0; i < resultCount; i++) {
+		jlong index = resultTags[i] - firstTag;
+		jobject expected = NULL;
+
+		if ((index < 0) || (index >= count)) {
+			error(env, JVMTI_ERROR_NONE, "GetObjectsWithTags() returned unrequested tag %lld", resultTags[i]);
+			rc = JNI_FALSE;
+		} else {
+			expected = (*jni_env)->GetObjectArrayElement(jni_env, objects, (jsize)index);
+			if (!(*jni_env)->IsSameObject(jni_env, expected, resultObjects[i])) {
+				error(env, JVMTI_ERROR_NONE, "GetObjectsWithTags() returned the wrong object for tag %lld", resultTags[i]);
+				rc = JNI_FALSE;
+			}
+			(*jni_env)->DeleteLocalRef(jni_env, expected);
+		}
+		(*jni_env)->DeleteLocalRef(jni_env, resultObjects[i]);
+	}
+
+done:
+	if (NULL != resultObjects) {
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)resultObjects);
+	}
+	if (NULL != resultTags) {
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)resultTags);
+	}
+	free(tags);
+	return rc;
+}
+
+/**
+ * Check that GetTag() returns 0 for every element of objects.
+ */
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_objectTags_ot001_checkUntagged(JNIEnv * jni_env, jclass clazz, jobjectArray objects)
+{
+	jvmtiEnv * jvmti_env = env->jvmtiEnv;
+	jsize count = (*jni_env)->GetArrayLength(jni_env, objects);
+	jsize i;
+
+	for (i = 0; i < count; i++) {
+		jobject object = (*jni_env)->GetObjectArrayElement(jni_env, objects, i);
+		jlong tag = -1;
+		jvmtiError err = (*jvmti_env)->GetTag(jvmti_env, object, &tag);
+		(*jni_env)->DeleteLocalRef(jni_env, object);
+		if (JVMTI_ERROR_NONE != err) {
+			error(env, err, "GetTag() failed for element %d", i);
+			return JNI_FALSE;
+		}
+		if (0 != tag) {
+			error(env, JVMTI_ERROR_NONE, "GetTag() returned %lld for untagged element %d", tag, i);
+			return JNI_FALSE;
+		}
+	}
+
+	return JNI_TRUE;
+}
+
+/**
+ * Repeatedly tag, read back and untag every element of objects, using firstTag plus the element
+ * index as the tag. Called from several threads at once, each with its own objects and tag range.
+ */
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_objectTags_ot001_retagObjects(JNIEnv * jni_env, jclass clazz, jobjectArray objects, jlong firstTag, jint iterations)
+{
+	jvmtiEnv * jvmti_env = env->jvmtiEnv;
+	jsize count = (*jni_env)->GetArrayLength(jni_env, objects);
+	jint iteration;
+	jsize i;
+
+	for (iteration = 0; iteration < iterations; iteration++) {
+		for (i = 0; i < count; i++) {
+			jobject object = (*jni_env)->GetObjectArrayElement(jni_env, objects, i);
+			jlong tag = 0;
+			jvmtiError err = (*jvmti_env)->SetTag(jvmti_env, object, firstTag + i);
+			if (JVMTI_ERROR_NONE == err) {
+				err = (*jvmti_env)->GetTag(jvmti_env, object, &tag);
+			}
+			if ((JVMTI_ERROR_NONE == err) && ((firstTag + i) != tag)) {
+				error(env, JVMTI_ERROR_NONE, "GetTag() returned %lld for element %d, expected %lld", tag, i, firstTag + i);
+				(*jni_env)->DeleteLocalRef(jni_env, object);
+				return JNI_FALSE;
+			}
+			/* leave the objects tagged after the last iteration */
+			if ((JVMTI_ERROR_NONE == err) && (iteration < (iterations - 1))) {
+				err = (*jvmti_env)->SetTag(jvmti_env, object, 0);
+			}
+			(*jni_env)->DeleteLocalRef(jni_env, object);
+			if (JVMTI_ERROR_NONE != err) {
+				error(env, err, "Tagging element %d failed in iteration %d", i, iteration);
+				return JNI_FALSE;
+			}
+		}
+	}
+
+	return JNI_TRUE;
+}
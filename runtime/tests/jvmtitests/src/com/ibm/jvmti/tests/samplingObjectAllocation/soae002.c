@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include <string.h>
+
+#include "ibmjvmti.h"
+#include "jvmti_test.h"
+
+/* the standard agent test context which lives for the duration of the test - this is supposed to be held for error logging */
+static agentEnv *env;
+/* the thread whose JVMTI_EVENT_SAMPLED_OBJECT_ALLOC events are counted */
+static jobject sampledThread = NULL;
+/* the number of JVMTI_EVENT_SAMPLED_OBJECT_ALLOC events posted for sampledThread */
+static jint sampledCount = 0;
+
+static void JNICALL sampledObjectAlloc(jvmtiEnv *jvmti_env, JNIEnv *jni_env, jthread thread, jobject object, jclass object_klass, jlong size);
+
+#if JAVA_SPEC_VERSION >= 11
+
+jint JNICALL
+soae002(agentEnv *agent_env, char *args)
+{
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+	jvmtiEventCallbacks callbacks;
+	jvmtiCapabilities capabilities;
+	jvmtiError err = JVMTI_ERROR_NONE;
+	jint result = JNI_OK;
+
+	env = agent_env;
+
+	memset(&callbacks, 0, sizeof(jvmtiEventCallbacks));
+	callbacks.SampledObjectAlloc = sampledObjectAlloc;
+	err = (*jvmti_env)->SetEventCallbacks(jvmti_env, &callbacks, sizeof(jvmtiEventCallbacks));
+	if (JVMTI_ERROR_NONE != err) {
+		error(agent_env, err, "Failed to set callback for JVMTI_EVENT_SAMPLED_OBJECT_ALLOC event");
+		result = JNI_ERR;
+	} else {
+		memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+		capabilities.can_generate_sampled_object_alloc_events = 1;
+		err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+		if (JVMTI_ERROR_NONE != err) {
+			error(agent_env, err, "Failed to add capabilities can_generate_sampled_object_alloc_events");
+			result = JNI_ERR;
+		}
+	}
+
+	return result;
+}
+
+static void JNICALL
+sampledObjectAlloc(jvmtiEnv *jvmti_env,
+	JNIEnv *jni_env,
+	jthread thread,
+	jobject object,
+	jclass object_klass,
+	jlong size)
+{
+	if ((NULL != sampledThread) && (*jni_env)->IsSameObject(jni_env, thread, sampledThread)) {
+		sampledCount += 1;
+	}
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae002_enable(JNIEnv *jni_env, jclass cls, jthread thread, jint samplingInterval)
+{
+	jint result = JNI_OK;
+	jvmtiError err = JVMTI_ERROR_NONE;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	sampledCount = 0;
+	sampledThread = (*jni_env)->NewGlobalRef(jni_env, thread);
+	if (NULL == sampledThread) {
+		error(env, JVMTI_ERROR_OUT_OF_MEMORY, "Failed to create a global reference to the sampled thread");
+		return JNI_ERR;
+	}
+
+	err = (*jvmti_env)->SetHeapSamplingInterval(jvmti_env, samplingInterval);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "Failed to set the heap sampling interval");
+		result = JNI_ERR;
+	} else {
+		err = (*jvmti_env)->SetEventNotificationMode(jvmti_env, JVMTI_ENABLE, JVMTI_EVENT_SAMPLED_OBJECT_ALLOC, NULL);
+		if (JVMTI_ERROR_NONE != err) {
+			error(env, err, "Failed to enable JVMTI_EVENT_SAMPLED_OBJECT_ALLOC event");
+			result = JNI_ERR;
+		}
+	}
+
+	return result;
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae002_disable(JNIEnv *jni_env, jclass cls)
+{
+	jint result = JNI_OK;
+	jvmtiError err = JVMTI_ERROR_NONE;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	err = (*jvmti_env)->SetEventNotificationMode(jvmti_env, JVMTI_DISABLE, JVMTI_EVENT_SAMPLED_OBJECT_ALLOC, NULL);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "Failed to disable JVMTI_EVENT_SAMPLED_OBJECT_ALLOC event");
+		result = JNI_ERR;
+	}
+	if (NULL != sampledThread) {
+		(*jni_env)->DeleteGlobalRef(jni_env, sampledThread);
+		sampledThread = NULL;
+	}
+
+	return result;
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_samplingObjectAllocation_soae002_check(JNIEnv *jni_env, jclass cls)
+{
+	return sampledCount;
+}
+#endif /* JAVA_SPEC_VERSION >= 11 */
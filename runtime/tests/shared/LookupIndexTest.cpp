@@ -0,0 +1,482 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+extern "C"
+{
+#include "shrinit.h"
+}
+#include "CacheLifecycleManager.hpp"
+#include "CacheMap.hpp"
+#include "CompositeCacheImpl.hpp"
+#include "OpenCacheHelper.h"
+#include "ROMClassManager.hpp"
+#include "main.h"
+
+#define LOOKUP_INDEX_TEST_CACHE "shrtestlookupindex"
+#define LOOKUP_INDEX_TEST_CLASSES 16
+#define ROMCLASS_NAME_LEN 64
+
+/**
+ * Tests for the lookup index stored with -Xshareclasses:lookupIndex. Each layer of a persistent
+ * cache is opened as the top layer, filled with dummy ROMClasses and closed with the exit code that
+ * stores the index. Opening a layer above it then reads it through the index.
+ */
+static IDATA test1(J9JavaVM* vm);
+static IDATA test2(J9JavaVM* vm);
+static IDATA test3(J9JavaVM* vm);
+static IDATA openLayer(J9JavaVM* vm, OpenCacheHelper* cacheHelper, I_8 layer, U_64 runtimeFlags = J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT | J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT_RW);
+static void closeLayer(J9JavaVM* vm, OpenCacheHelper* cacheHelper);
+static IDATA destroyLayers(J9JavaVM* vm);
+static IDATA addClasses(J9JavaVM* vm, OpenCacheHelper* cacheHelper, const char* prefix, UDATA count, U_32 romClassSize = 256);
+static IDATA checkClasses(J9JavaVM* vm, const char* prefix, UDATA count, UDATA expectedROMClasses, const char* testName);
+static UDATA getJavacoreROMClassCount(J9JavaVM* vm);
+static SH_CompositeCacheImpl* getLayer(J9JavaVM* vm, I_8 layer);
+
+extern "C" {
+
+IDATA
+testLookupIndex(J9JavaVM* vm)
+{
+	IDATA rc = PASS;
+	J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	REPORT_START("testLookupIndex");
+
+	vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
+
+	rc |= test1(vm);
+	rc |= test2(vm);
+	rc |= test3(vm);
+
+	vm->internalVMFunctions->internalExitVMToJNI(currentThread);
+
+	REPORT_SUMMARY("testLookupIndex", rc);
+	return rc;
+}
+
+} /* extern "C" */
+
+/**
+ * Layers 0 and 1 each store an index at exit, which JVMs using them as lower layers read
+ * instead of walking them. Every class must be found by name and counted exactly once, both
+ * before and after it is moved from the index into the hashtable. A class stored in a higher
+ * layer under the name of a class in an indexed lower layer must not hide it.
+ */
+static IDATA
+test1(J9JavaVM* vm)
+{
+	const char* testName = "lookupIndexTest1";
+	OpenCacheHelper cacheHelper(vm);
+	SH_CompositeCacheImpl* cc = NULL;
+	J9SharedCacheHeader* ca = NULL;
+	UDATA lookupIndexSRP = 0;
+	UDATA updateCount = 0;
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	INFOPRINTF("Starting test");
+	destroyLayers(vm);
+
+	/* Layer 0: store an index at exit */
+	if ((FAIL == openLayer(vm, &cacheHelper, 0)) || (FAIL == addClasses(vm, &cacheHelper, "Layer0Class", LOOKUP_INDEX_TEST_CLASSES))) {
+		ERRPRINTF("Failed to populate layer 0");
+		rc = FAIL;
+		goto done;
+	}
+	closeLayer(vm, &cacheHelper);
+
+	/* Reopen layer 0 unchanged: the index is current and is not stored again at exit */
+	if (FAIL == openLayer(vm, &cacheHelper, 0)) {
+		rc = FAIL;
+		goto done;
+	}
+	cc = getLayer(vm, 0);
+	ca = cc->getCacheHeaderAddress();
+	if (NULL == cc->getLookupIndex()) {
+		ERRPRINTF("Layer 0 has no current lookup index");
+		rc = FAIL;
+		closeLayer(vm, &cacheHelper);
+		goto done;
+	}
+	lookupIndexSRP = ca->lookupIndexSRP;
+	updateCount = cc->getUpdateCount();
+	closeLayer(vm, &cacheHelper);
+
+	if (FAIL == openLayer(vm, &cacheHelper, 0)) {
+		rc = FAIL;
+		goto done;
+	}
+	cc = getLayer(vm, 0);
+	ca = cc->getCacheHeaderAddress();
+	if ((lookupIndexSRP != ca->lookupIndexSRP) || (updateCount != cc->getUpdateCount())) {
+		ERRPRINTF4("Lookup index was stored again: SRP %zu -> %zu, update count %zu -> %zu",
+				lookupIndexSRP, ca->lookupIndexSRP, updateCount, cc->getUpdateCount());
+		rc = FAIL;
+		closeLayer(vm, &cacheHelper);
+		goto done;
+	}
+	closeLayer(vm, &cacheHelper);
+
+	/* Layer 1 reads layer 0 through its index, and stores one class whose name is also in layer 0 */
+	if (FAIL == openLayer(vm, &cacheHelper, 1)) {
+		rc = FAIL;
+		goto done;
+	}
+	if (FAIL == checkClasses(vm, "Layer0Class", LOOKUP_INDEX_TEST_CLASSES, LOOKUP_INDEX_TEST_CLASSES, testName)) {
+		rc = FAIL;
+		closeLayer(vm, &cacheHelper);
+		goto done;
+	}
+	/* A different size makes it a different ROMClass, so it cannot be shared with the one in layer 0 */
+	if ((FAIL == addClasses(vm, &cacheHelper, "Layer0Class", 1, 512))
+		|| (FAIL == addClasses(vm, &cacheHelper, "Layer1Class", LOOKUP_INDEX_TEST_CLASSES))
+	) {
+		ERRPRINTF("Failed to populate layer 1");
+		rc = FAIL;
+		closeLayer(vm, &cacheHelper);
+		goto done;
+	}
+	closeLayer(vm, &cacheHelper);
+
+	/* Layer 2 reads both lower layers through their indexes */
+	if (FAIL == openLayer(vm, &cacheHelper, 2)) {
+		rc = FAIL;
+		goto done;
+	}
+	if ((NULL == getLayer(vm, 0)->getLookupIndex()) || (NULL == getLayer(vm, 1)->getLookupIndex())) {
+		ERRPRINTF("Lower layers have no current lookup index");
+		rc = FAIL;
+	} else if ((FAIL == checkClasses(vm, "Layer0Class", LOOKUP_INDEX_TEST_CLASSES, (2 * LOOKUP_INDEX_TEST_CLASSES) + 1, testName))
+		|| (FAIL == checkClasses(vm, "Layer1Class", LOOKUP_INDEX_TEST_CLASSES, (2 * LOOKUP_INDEX_TEST_CLASSES) + 1, testName))
+	) {
+		rc = FAIL;
+	} else {
+		/* Counting with a thread moves every remaining item out of the index, which must not change the count */
+		SH_CacheMap* cacheMap = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+		UDATA nonStale = 0;
+		UDATA stale = 0;
+
+		cacheMap->getROMClassManager(vm->mainThread)->getNumItems(vm->mainThread, &nonStale, &stale);
+		if (((nonStale + stale) != ((2 * LOOKUP_INDEX_TEST_CLASSES) + 1))
+			|| (getJavacoreROMClassCount(vm) != ((2 * LOOKUP_INDEX_TEST_CLASSES) + 1))
+		) {
+			ERRPRINTF2("Wrong ROMClass count after storing all lazy items: %zu, javacore %zu", nonStale + stale, getJavacoreROMClassCount(vm));
+			rc = FAIL;
+		}
+	}
+	closeLayer(vm, &cacheHelper);
+
+done:
+	if (FAIL == destroyLayers(vm)) {
+		rc = FAIL;
+	}
+	INFOPRINTF1("Test %s", (PASS == rc) ? "passed" : "failed");
+	return rc;
+}
+
+/**
+ * An index made stale by a later update is not replaced at the following exits, and a layer
+ * with a stale index is read in full when used as a lower layer.
+ */
+static IDATA
+test2(J9JavaVM* vm)
+{
+	const char* testName = "lookupIndexTest2";
+	OpenCacheHelper cacheHelper(vm);
+	SH_CompositeCacheImpl* cc = NULL;
+	UDATA lookupIndexSRP = 0;
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	INFOPRINTF("Starting test");
+	destroyLayers(vm);
+
+	if ((FAIL == openLayer(vm, &cacheHelper, 0)) || (FAIL == addClasses(vm, &cacheHelper, "StaleClass", LOOKUP_INDEX_TEST_CLASSES))) {
+		ERRPRINTF("Failed to populate layer 0");
+		rc = FAIL;
+		goto done;
+	}
+	closeLayer(vm, &cacheHelper);
+
+	if (FAIL == openLayer(vm, &cacheHelper, 0)) {
+		rc = FAIL;
+		goto done;
+	}
+	lookupIndexSRP = getLayer(vm, 0)->getCacheHeaderAddress()->lookupIndexSRP;
+	if ((0 == lookupIndexSRP) || (FAIL == addClasses(vm, &cacheHelper, "StaleExtraClass", 1))) {
+		ERRPRINTF("Failed to update layer 0 after its lookup index was stored");
+		rc = FAIL;
+		closeLayer(vm, &cacheHelper);
+		goto done;
+	}
+	closeLayer(vm, &cacheHelper);
+
+	if (FAIL == openLayer(vm, &cacheHelper, 1)) {
+		rc = FAIL;
+		goto done;
+	}
+	cc = getLayer(vm, 0);
+	if ((lookupIndexSRP != cc->getCacheHeaderAddress()->lookupIndexSRP) || (NULL != cc->getLookupIndex())) {
+		ERRPRINTF("Stale lookup index was replaced");
+		rc = FAIL;
+	} else if ((FAIL == checkClasses(vm, "StaleClass", LOOKUP_INDEX_TEST_CLASSES, LOOKUP_INDEX_TEST_CLASSES + 1, testName))
+		|| (FAIL == checkClasses(vm, "StaleExtraClass", 1, LOOKUP_INDEX_TEST_CLASSES + 1, testName))
+	) {
+		rc = FAIL;
+	}
+	closeLayer(vm, &cacheHelper);
+
+done:
+	if (FAIL == destroyLayers(vm)) {
+		rc = FAIL;
+	}
+	INFOPRINTF1("Test %s", (PASS == rc) ? "passed" : "failed");
+	return rc;
+}
+
+/**
+ * The keys of lazy items are only checked when they are stored. A layer whose index names the wrong
+ * item for a key is walked in full at that point, and every class in it is still found and counted once.
+ */
+static IDATA
+test3(J9JavaVM* vm)
+{
+	const char* testName = "lookupIndexTest3";
+	OpenCacheHelper cacheHelper(vm);
+	const J9SharedLookupIndex* index = NULL;
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	INFOPRINTF("Starting test");
+	destroyLayers(vm);
+
+	if ((FAIL == openLayer(vm, &cacheHelper, 0)) || (FAIL == addClasses(vm, &cacheHelper, "MislabelledClass", LOOKUP_INDEX_TEST_CLASSES))) {
+		ERRPRINTF("Failed to populate layer 0");
+		rc = FAIL;
+		goto done;
+	}
+	closeLayer(vm, &cacheHelper);
+
+	/* Rotate the items of the lazy entries, which keeps the hashes sorted but pairs each with another class */
+	if (FAIL == openLayer(vm, &cacheHelper, 0, 0)) {
+		rc = FAIL;
+		goto done;
+	}
+	index = getLayer(vm, 0)->getLookupIndex();
+	if ((NULL == index) || (index->lazyItemCount < 2)) {
+		ERRPRINTF("Layer 0 has no lookup index with lazy items");
+		rc = FAIL;
+	} else {
+		J9SharedLookupIndexEntry* entries = LOOKUPINDEX_LAZY_ENTRIES(index);
+		U_32 firstOffset = entries[0].itemOffset;
+		U_32 i = 0;
+
+		for (i = 1; i < index->lazyItemCount; i++) {
+			entries[i - 1].itemOffset = entries[i].itemOffset;
+		}
+		entries[index->lazyItemCount - 1].itemOffset = firstOffset;
+	}
+	closeLayer(vm, &cacheHelper);
+	if (FAIL == rc) {
+		goto done;
+	}
+
+	if (FAIL == openLayer(vm, &cacheHelper, 1)) {
+		rc = FAIL;
+		goto done;
+	}
+	if (NULL == getLayer(vm, 0)->getLookupIndex()) {
+		ERRPRINTF("The index was rejected before any key was used");
+		rc = FAIL;
+	} else if (FAIL == checkClasses(vm, "MislabelledClass", LOOKUP_INDEX_TEST_CLASSES, LOOKUP_INDEX_TEST_CLASSES, testName)) {
+		rc = FAIL;
+	} else {
+		SH_CacheMap* cacheMap = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+		UDATA nonStale = 0;
+		UDATA stale = 0;
+
+		cacheMap->getROMClassManager(vm->mainThread)->getNumItems(vm->mainThread, &nonStale, &stale);
+		if ((nonStale + stale) != LOOKUP_INDEX_TEST_CLASSES) {
+			ERRPRINTF1("Wrong ROMClass count after walking the layer: %zu", nonStale + stale);
+			rc = FAIL;
+		}
+	}
+	closeLayer(vm, &cacheHelper);
+
+done:
+	if (FAIL == destroyLayers(vm)) {
+		rc = FAIL;
+	}
+	INFOPRINTF1("Test %s", (PASS == rc) ? "passed" : "failed");
+	return rc;
+}
+
+static IDATA
+openLayer(J9JavaVM* vm, OpenCacheHelper* cacheHelper, I_8 layer, U_64 runtimeFlags)
+{
+	const char* testName = "openLayer";
+	J9SharedClassConfig* sharedClassConfig = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	sharedClassConfig = (J9SharedClassConfig*)j9mem_allocate_memory(sizeof(J9SharedClassConfig) + sizeof(J9SharedClassCacheDescriptor), J9MEM_CATEGORY_CLASSES);
+	if (NULL == sharedClassConfig) {
+		ERRPRINTF("Failed to allocate memory for J9SharedClassConfig");
+		return FAIL;
+	}
+	memset(sharedClassConfig, 0, sizeof(J9SharedClassConfig) + sizeof(J9SharedClassCacheDescriptor));
+	sharedClassConfig->layer = layer;
+	sharedClassConfig->runtimeFlags2 = J9SHR_RUNTIMEFLAG2_ENABLE_LOOKUP_INDEX;
+
+	if (FAIL == cacheHelper->openTestCache(J9PORT_SHR_CACHE_TYPE_PERSISTENT, CACHE_SIZE, LOOKUP_INDEX_TEST_CACHE, false, NULL,
+			NULL, NULL, 0, runtimeFlags, UnitTest::NO_TEST,
+			J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, testName, false, true, NULL, sharedClassConfig)
+	) {
+		ERRPRINTF1("Failed to open layer %d", layer);
+		return FAIL;
+	}
+	return PASS;
+}
+
+/**
+ * Close the cache without destroying it, running the exit code that stores the lookup index as a JVM would.
+ */
+static void
+closeLayer(J9JavaVM* vm, OpenCacheHelper* cacheHelper)
+{
+	SH_CacheMap* cacheMap = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL != cacheMap) {
+		if (((SH_CompositeCacheImpl*)cacheMap->getCompositeCacheAPI())->isStarted()) {
+			cacheMap->runExitCode(vm->mainThread);
+		}
+		cacheMap->cleanup(vm->mainThread);
+		j9mem_free_memory(cacheMap);
+	}
+	vm->sharedClassConfig = cacheHelper->origSharedClassConfig;
+	j9mem_free_memory(cacheHelper->sharedClassConfig);
+	cacheHelper->sharedClassConfig = NULL;
+	vm->sharedClassPreinitConfig = cacheHelper->origPiConfig;
+	j9mem_free_memory(cacheHelper->piConfig);
+	cacheHelper->piConfig = NULL;
+}
+
+static IDATA
+destroyLayers(J9JavaVM* vm)
+{
+	const char* testName = "destroyLayers";
+	J9PortShcVersion versionData;
+	IDATA rc = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	setCurrentCacheVersion(vm, J2SE_VERSION(vm), &versionData);
+	versionData.cacheType = J9PORT_SHR_CACHE_TYPE_PERSISTENT;
+	rc = j9shr_destroy_cache(vm, NULL, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, LOOKUP_INDEX_TEST_CACHE,
+			OSCACHE_LOWEST_ACTIVE_GEN, OSCACHE_CURRENT_CACHE_GEN, &versionData, FALSE, 0, J9SH_LAYER_NUM_MAX_VALUE);
+	if (J9SH_DESTROYED_ALL_CACHE != rc) {
+		ERRPRINTF1("Failed to destroy the test cache: %zd", rc);
+		return FAIL;
+	}
+	return PASS;
+}
+
+static IDATA
+addClasses(J9JavaVM* vm, OpenCacheHelper* cacheHelper, const char* prefix, UDATA count, U_32 romClassSize)
+{
+	char romClassName[ROMCLASS_NAME_LEN];
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (i = 0; i < count; i++) {
+		j9str_printf(romClassName, ROMCLASS_NAME_LEN, "%s%zu", prefix, i);
+		if (FAIL == cacheHelper->addDummyROMClass(romClassName, romClassSize)) {
+			return FAIL;
+		}
+	}
+	return PASS;
+}
+
+/**
+ * Every class named prefix0 to prefix<count-1> is found, and the javacore count of ROMClasses, which is
+ * collected without moving items out of the index, equals expectedROMClasses before and after the lookups.
+ */
+static IDATA
+checkClasses(J9JavaVM* vm, const char* prefix, UDATA count, UDATA expectedROMClasses, const char* testName)
+{
+	SH_CacheMap* cacheMap = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+	SH_ROMClassManager* rcm = cacheMap->getROMClassManager(vm->mainThread);
+	char romClassName[ROMCLASS_NAME_LEN];
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == rcm) {
+		ERRPRINTF("ROMClass manager did not start");
+		return FAIL;
+	}
+	if (expectedROMClasses != getJavacoreROMClassCount(vm)) {
+		ERRPRINTF2("Expected %zu ROMClasses before lookups, found %zu", expectedROMClasses, getJavacoreROMClassCount(vm));
+		return FAIL;
+	}
+	for (i = 0; i < count; i++) {
+		j9str_printf(romClassName, ROMCLASS_NAME_LEN, "%s%zu", prefix, i);
+		if (0 == rcm->existsClassForName(vm->mainThread, romClassName, strlen(romClassName))) {
+			ERRPRINTF1("Class %s not found", romClassName);
+			return FAIL;
+		}
+	}
+	j9str_printf(romClassName, ROMCLASS_NAME_LEN, "%sMissing", prefix);
+	if (0 != rcm->existsClassForName(vm->mainThread, romClassName, strlen(romClassName))) {
+		ERRPRINTF1("Class %s found but never stored", romClassName);
+		return FAIL;
+	}
+	if (expectedROMClasses != getJavacoreROMClassCount(vm)) {
+		ERRPRINTF2("Expected %zu ROMClasses after lookups, found %zu", expectedROMClasses, getJavacoreROMClassCount(vm));
+		return FAIL;
+	}
+	return PASS;
+}
+
+static UDATA
+getJavacoreROMClassCount(J9JavaVM* vm)
+{
+	SH_CacheMap* cacheMap = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+	J9SharedClassJavacoreDataDescriptor descriptor;
+
+	memset(&descriptor, 0, sizeof(J9SharedClassJavacoreDataDescriptor));
+	if (0 == cacheMap->getJavacoreData(vm, &descriptor)) {
+		return 0;
+	}
+	return descriptor.numROMClasses;
+}
+
+static SH_CompositeCacheImpl*
+getLayer(J9JavaVM* vm, I_8 layer)
+{
+	SH_CacheMap* cacheMap = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+	SH_CompositeCacheImpl* cc = (SH_CompositeCacheImpl*)cacheMap->getCompositeCacheAPI();
+
+	/* The top layer is first in the list */
+	while ((NULL != cc) && (cc->getLayer() != layer)) {
+		cc = cc->getNext();
+	}
+	return cc;
+}
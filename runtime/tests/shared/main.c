@@ -70,6 +70,7 @@ IDATA testCacheDirPerm(J9JavaVM *vm);
 IDATA testCacheFull(J9JavaVM *vm);
 IDATA testProtectSharedCacheData(J9JavaVM *vm);
 IDATA testStartupHints(J9JavaVM *vm);
+IDATA testLookupIndex(J9JavaVM *vm);
 
 UDATA
 buildChildCmdlineOption(int argc, char **argv, const char *options, char * newargv[SHRTEST_MAX_CMD_OPTS]) {
@@ -351,6 +352,9 @@ signalProtectedMain(struct J9PortLibrary *portLibrary, void * vargs)
 	HEADING(PORTLIB, "Startup Hints Test");
 	rc |= testStartupHints(vm);
 
+	HEADING(PORTLIB, "Lookup Index Test");
+	rc |= testLookupIndex(vm);
+
 	if ( (*((JavaVM*)vm))->DestroyJavaVM((JavaVM*)vm) != JNI_OK ) {
 		args->shutdownPortLib = FALSE;
 	}
@@ -52,6 +52,16 @@ static IDATA testAddHiddenInstanceFields3(J9PortLibrary *portLib);
 static IDATA testAddHiddenInstanceFields4(J9PortLibrary *portLib);
 static IDATA testAddHiddenInstanceFields5(J9PortLibrary *portLib);
 static IDATA testAddHiddenInstanceFields6(J9PortLibrary *portLib);
+static UDATA fieldLayoutHintHashFn(void *key, void *userData);
+static UDATA fieldLayoutHintHashEqualFn(void *leftKey, void *rightKey, void *userData);
+static UDATA calculateFieldArea(U_32 modifiers);
+static void walkInstanceFieldOffsets(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClass, UDATA *offsets, UDATA *totalInstanceSize, IDATA *backfillOffset);
+static IDATA testFieldLayoutHint(J9PortLibrary *portLib, const char *testName,
+	testFieldDef *regularFields, const char **hotFieldNames, BOOLEAN superclassBackfill);
+static IDATA testFieldLayoutHint1(J9PortLibrary *portLib);
+static IDATA testFieldLayoutHint2(J9PortLibrary *portLib);
+static IDATA testFieldLayoutHint3(J9PortLibrary *portLib);
+static IDATA testFieldLayoutHint4(J9PortLibrary *portLib);
 
 
 static UDATA
@@ -470,6 +480,275 @@ testAddHiddenInstanceFields6(J9PortLibrary *portLib)
 	return testAddHiddenInstanceFields(portLib, testName, regularFields, hiddenFields);
 }
 
+static UDATA
+fieldLayoutHintHashFn(void *key, void *userData)
+{
+	return (UDATA)((J9FieldLayoutHintEntry *)key)->romClass;
+}
+
+static UDATA
+fieldLayoutHintHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	return ((J9FieldLayoutHintEntry *)leftKey)->romClass == ((J9FieldLayoutHintEntry *)rightKey)->romClass;
+}
+
+/* Instance fields are laid out in separate areas for double, object and single fields. */
+static UDATA
+calculateFieldArea(U_32 modifiers)
+{
+	UDATA area;
+
+	if (J9FieldFlagObject == (modifiers & J9FieldFlagObject)) {
+		area = 0;
+	} else if (J9FieldSizeDouble == (modifiers & J9FieldSizeDouble)) {
+		area = 1;
+	} else {
+		area = 2;
+	}
+
+	return area;
+}
+
+static void
+walkInstanceFieldOffsets(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClass, UDATA *offsets, UDATA *totalInstanceSize, IDATA *backfillOffset)
+{
+	J9ROMFieldOffsetWalkResult *walkResult;
+	J9ROMFieldOffsetWalkState walkState;
+
+#if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
+	walkResult = fieldOffsetsStartDo(vm, romClass, superClass, &walkState, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE, NULL);
+#else /* defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES) */
+	walkResult = fieldOffsetsStartDo(vm, romClass, superClass, &walkState, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE);
+#endif /* defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES) */
+	*totalInstanceSize = walkResult->totalInstanceSize;
+	*backfillOffset = walkState.backfillOffsetToUse;
+
+	while (NULL != walkResult->field) {
+		offsets[walkResult->index - 1] = walkResult->offset;
+		walkResult = fieldOffsetsNextDo(&walkState);
+	}
+}
+
+/*
+ * Lay out a class without and with a field layout hint marking hotFieldNames, and check that the
+ * hinted layout places the hot fields of each area first, in declaration order, followed by the cold
+ * fields in declaration order. The hinted layout must use exactly the offsets of the unhinted one,
+ * must have the same instance size, and must leave the backfilled field where it was. This also checks
+ * that initializeFieldLayoutHint() picks the same backfilled field as fieldOffsetsFindNext(): if the
+ * hot field counts disagree, a field lands outside its area or two fields collide.
+ */
+static IDATA
+testFieldLayoutHint(J9PortLibrary *portLib, const char *testName,
+	testFieldDef *regularFields, const char **hotFieldNames, BOOLEAN superclassBackfill)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	J9JavaVM javaVM;
+	OMR_VM omrVM;
+	J9Class superClass;
+	J9Class *superClassPtr = NULL;
+	U_8 buffer[4096];
+	U_32 hintBuffer[(sizeof(J9FieldLayoutHint) / sizeof(U_32)) + 1];
+	J9FieldLayoutHint *hint = (J9FieldLayoutHint *)hintBuffer;
+	J9FieldLayoutHintEntry entry;
+	J9ROMClass *fakeROMClass;
+	J9ROMFieldShape *romFields;
+	UDATA unhintedOffsets[32];
+	UDATA hintedOffsets[32];
+	UDATA unhintedInstanceSize, hintedInstanceSize;
+	IDATA backfillOffset, hintedBackfillOffset;
+	UDATA fieldIndex, otherIndex, hotIndex;
+	UDATA badOffset;
+
+	reportTestEntry(PORTLIB, testName);
+
+	memset(&javaVM, 0, sizeof(J9JavaVM));
+	javaVM.javaVM = &javaVM;
+	javaVM.portLibrary = portLib;
+	javaVM.omrVM = &omrVM;
+	omrVM._objectAlignmentInBytes = 8;
+	omrVM._objectAlignmentShift = 3;
+
+	if (0 != initializeVMThreading(&javaVM)) {
+		outputErrorMessage(TEST_ERROR_ARGS, "initializeVMThreading() failed!\n");
+		goto _exit_test;
+	}
+
+	if (0 != initializeHiddenInstanceFieldsList(&javaVM)) {
+		outputErrorMessage(TEST_ERROR_ARGS, "initializeHiddenInstanceFieldsList() failed!\n");
+		goto _exit_test;
+	}
+
+	fakeROMClass = createFakeROMClass(buffer, sizeof(buffer), "org/openj9/test/HintedFields", regularFields);
+	if ((NULL == fakeROMClass) || (fakeROMClass->romFieldCount > 32)) {
+		outputErrorMessage(TEST_ERROR_ARGS, "createFakeROMClass() failed!\n");
+		goto _exit_test;
+	}
+	romFields = SRP_GET(fakeROMClass->romFields, J9ROMFieldShape *);
+
+	if (superclassBackfill) {
+		/* The superclass has a single field followed by a free 4 byte slot that this class can backfill. */
+		memset(&superClass, 0, sizeof(J9Class));
+		superClass.classDepthAndFlags = 1;
+		superClass.lockOffset = (UDATA)-1;
+		superClass.totalInstanceSize = 2 * sizeof(U_32);
+		superClass.backfillOffset = J9JAVAVM_OBJECT_HEADER_SIZE(&javaVM) + sizeof(U_32);
+		superClassPtr = &superClass;
+	}
+
+	walkInstanceFieldOffsets(&javaVM, fakeROMClass, superClassPtr, unhintedOffsets, &unhintedInstanceSize, &backfillOffset);
+
+	memset(hintBuffer, 0, sizeof(hintBuffer));
+	hint->romSize = fakeROMClass->romSize;
+	hint->romFieldCount = fakeROMClass->romFieldCount;
+	for (hotIndex = 0; NULL != hotFieldNames[hotIndex]; hotIndex++) {
+		for (fieldIndex = 0; NULL != regularFields[fieldIndex].fieldName; fieldIndex++) {
+			if (0 == strcmp(hotFieldNames[hotIndex], regularFields[fieldIndex].fieldName)) {
+				J9FIELDLAYOUTHINT_BITS(hint)[fieldIndex / 32] |= (U_32)1 << (fieldIndex % 32);
+			}
+		}
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&javaVM.fieldLayoutHintsMutex, 0, "VM field layout hints")) {
+		outputErrorMessage(TEST_ERROR_ARGS, "omrthread_monitor_init_with_name() failed!\n");
+		goto _exit_test;
+	}
+	javaVM.fieldLayoutHints = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 16,
+			sizeof(J9FieldLayoutHintEntry), sizeof(J9ROMClass *), 0, OMRMEM_CATEGORY_VM, fieldLayoutHintHashFn, fieldLayoutHintHashEqualFn, NULL, NULL);
+	entry.romClass = fakeROMClass;
+	entry.hint = hint;
+	if ((NULL == javaVM.fieldLayoutHints) || (NULL == hashTableAdd(javaVM.fieldLayoutHints, &entry))) {
+		outputErrorMessage(TEST_ERROR_ARGS, "hashTableNew() failed!\n");
+		goto _exit_test;
+	}
+
+	/* Once it is known that no hints exist, the table is not consulted. */
+	javaVM.fieldLayoutHintsState = J9_FIELD_LAYOUT_HINTS_NONE;
+	walkInstanceFieldOffsets(&javaVM, fakeROMClass, superClassPtr, hintedOffsets, &hintedInstanceSize, &hintedBackfillOffset);
+	for (fieldIndex = 0; fieldIndex < fakeROMClass->romFieldCount; fieldIndex++) {
+		if (unhintedOffsets[fieldIndex] != hintedOffsets[fieldIndex]) {
+			outputErrorMessage(TEST_ERROR_ARGS, "hint applied although no hints are present!\n");
+			goto _exit_test;
+		}
+	}
+
+	javaVM.fieldLayoutHintsState = J9_FIELD_LAYOUT_HINTS_PRESENT;
+	walkInstanceFieldOffsets(&javaVM, fakeROMClass, superClassPtr, hintedOffsets, &hintedInstanceSize, &hintedBackfillOffset);
+
+	if (0 != checkForFieldOverlaps(&javaVM, fakeROMClass, superClassPtr, &badOffset)) {
+		outputErrorMessage(TEST_ERROR_ARGS, "overlapping fields detected at offset %d!\n", badOffset);
+		goto _exit_test;
+	}
+
+	if ((unhintedInstanceSize != hintedInstanceSize) || (backfillOffset != hintedBackfillOffset)) {
+		outputErrorMessage(TEST_ERROR_ARGS, "hint changed instance size %d to %d or backfill offset %d to %d!\n",
+			unhintedInstanceSize, hintedInstanceSize, backfillOffset, hintedBackfillOffset);
+		goto _exit_test;
+	}
+
+	for (fieldIndex = 0; fieldIndex < fakeROMClass->romFieldCount; fieldIndex++) {
+		UDATA area = calculateFieldArea(romFields[fieldIndex].modifiers);
+		BOOLEAN isHot = J9FIELDLAYOUTHINT_IS_HOT(hint, fieldIndex);
+		BOOLEAN offsetFound = FALSE;
+
+		if ((IDATA)unhintedOffsets[fieldIndex] == backfillOffset) {
+			if (hintedOffsets[fieldIndex] != unhintedOffsets[fieldIndex]) {
+				outputErrorMessage(TEST_ERROR_ARGS, "backfilled field '%s' moved!\n", regularFields[fieldIndex].fieldName);
+				goto _exit_test;
+			}
+			continue;
+		}
+
+		for (otherIndex = 0; otherIndex < fakeROMClass->romFieldCount; otherIndex++) {
+			if ((area == calculateFieldArea(romFields[otherIndex].modifiers))
+				&& (hintedOffsets[fieldIndex] == unhintedOffsets[otherIndex])
+			) {
+				offsetFound = TRUE;
+			}
+		}
+		if (!offsetFound) {
+			outputErrorMessage(TEST_ERROR_ARGS, "field '%s' moved outside its area to offset %d!\n",
+				regularFields[fieldIndex].fieldName, hintedOffsets[fieldIndex]);
+			goto _exit_test;
+		}
+
+		for (otherIndex = fieldIndex + 1; otherIndex < fakeROMClass->romFieldCount; otherIndex++) {
+			if ((area == calculateFieldArea(romFields[otherIndex].modifiers))
+				&& ((IDATA)unhintedOffsets[otherIndex] != backfillOffset)
+			) {
+				BOOLEAN expectBefore = isHot || !J9FIELDLAYOUTHINT_IS_HOT(hint, otherIndex);
+
+				if (expectBefore != (hintedOffsets[fieldIndex] < hintedOffsets[otherIndex])) {
+					outputErrorMessage(TEST_ERROR_ARGS, "fields '%s' and '%s' are out of order!\n",
+						regularFields[fieldIndex].fieldName, regularFields[otherIndex].fieldName);
+					goto _exit_test;
+				}
+			}
+		}
+	}
+
+	hashTableFree(javaVM.fieldLayoutHints);
+	omrthread_monitor_destroy(javaVM.fieldLayoutHintsMutex);
+	freeHiddenInstanceFieldsList(&javaVM);
+	terminateVMThreading(&javaVM);
+
+_exit_test:
+	return reportTestExit(PORTLIB, testName);
+}
+
+static IDATA
+testFieldLayoutHint1(J9PortLibrary *portLib)
+{
+	const char *testName = "testFieldLayoutHint1";
+	testFieldDef regularFields[] = {
+		{"a", "I"}, {"b", "J"}, {"c", "Ljava/lang/Object;"}, {"d", "I"}, {"e", "D"},
+		{"f", "[I"}, {"g", "I"}, {"h", "J"}, {"i", "Ljava/lang/String;"}, {NULL, NULL}
+	};
+	const char *hotFieldNames[] = {"g", "h", "i", "d", NULL};
+
+	return testFieldLayoutHint(portLib, testName, regularFields, hotFieldNames, FALSE);
+}
+
+static IDATA
+testFieldLayoutHint2(J9PortLibrary *portLib)
+{
+	const char *testName = "testFieldLayoutHint2";
+	testFieldDef regularFields[] = {
+		{"a", "J"}, {"b", "I"}, {"c", "Ljava/lang/Object;"}, {"d", "I"}, {"e", "I"},
+		{"f", "Ljava/lang/Object;"}, {"g", "I"}, {NULL, NULL}
+	};
+	/* b is placed in the superclass backfill slot; being hot must not move it or shift the other singles. */
+	const char *hotFieldNames[] = {"b", "f", "g", NULL};
+
+	return testFieldLayoutHint(portLib, testName, regularFields, hotFieldNames, TRUE);
+}
+
+static IDATA
+testFieldLayoutHint3(J9PortLibrary *portLib)
+{
+	const char *testName = "testFieldLayoutHint3";
+	testFieldDef regularFields[] = {
+		{"a", "Ljava/lang/Object;"}, {"b", "J"}, {"c", "Ljava/lang/Object;"}, {"d", "Ljava/lang/Object;"}, {NULL, NULL}
+	};
+	/* With compressed references, a is placed in the superclass backfill slot. */
+	const char *hotFieldNames[] = {"a", "d", NULL};
+
+	return testFieldLayoutHint(portLib, testName, regularFields, hotFieldNames, TRUE);
+}
+
+static IDATA
+testFieldLayoutHint4(J9PortLibrary *portLib)
+{
+	const char *testName = "testFieldLayoutHint4";
+	testFieldDef regularFields[] = {
+		{"a", "I"}, {"b", "I"}, {"c", "J"}, {"d", "I"}, {NULL, NULL}
+	};
+	/* Cold fields keep declaration order after the hot ones, including a hot field declared last. */
+	const char *hotFieldNames[] = {"d", NULL};
+
+	return testFieldLayoutHint(portLib, testName, regularFields, hotFieldNames, FALSE);
+}
+
 IDATA
 testResolveField(J9PortLibrary *portLib)
 {
@@ -483,5 +762,9 @@ testResolveField(J9PortLibrary *portLib)
 	rc |= testAddHiddenInstanceFields4(PORTLIB);
 	rc |= testAddHiddenInstanceFields5(PORTLIB);
 	rc |= testAddHiddenInstanceFields6(PORTLIB);
+	rc |= testFieldLayoutHint1(PORTLIB);
+	rc |= testFieldLayoutHint2(PORTLIB);
+	rc |= testFieldLayoutHint3(PORTLIB);
+	rc |= testFieldLayoutHint4(PORTLIB);
 	return rc;
 }
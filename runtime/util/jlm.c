@@ -193,14 +193,14 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 						/* No need to check if entry.ref != NULL, since we checked object above */
 
-						/* Ensure exclusive access to tag table */
-						omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+						/* Lookups may run concurrently, only updates need exclusive access to the tag table */
+						omrthread_rwmutex_enter_read(((J9JVMTIEnv *)env)->objectTagTableMutex);
 
 						objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
 						if (objectTag) {
 							tag = objectTag->tag;
 						}
-						omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+						omrthread_rwmutex_exit_read(((J9JVMTIEnv *)env)->objectTagTableMutex);
 					}
 				}
 
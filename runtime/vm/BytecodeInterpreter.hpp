@@ -159,6 +159,10 @@ ffiCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *functi
 #else /* FFI_NATIVE_RAW_API */
 ffiCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *function, UDATA *returnStorage, void **values);
 #endif /* FFI_NATIVE_RAW_API */
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+extern void
+directCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *function, UDATA *returnStorage, void **values);
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
 }
 #endif /* JAVA_SPEC_VERSION >= 16 */
 
@@ -5722,11 +5726,18 @@ done:
 			VM_VMAccess::inlineExitVMToJNI(_currentThread);
 		}
 		VM_VMHelpers::beforeJNICall(_currentThread);
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+		if (((J9DowncallCif *)cif)->isDirectCall) {
+			directCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values);
+		} else
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
+		{
 #if FFI_NATIVE_RAW_API
-		ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values, values_raw);
+			ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values, values_raw);
 #else /* FFI_NATIVE_RAW_API */
-		ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values);
+			ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values);
 #endif /* FFI_NATIVE_RAW_API */
+		}
 		VM_VMHelpers::afterJNICall(_currentThread);
 #if JAVA_SPEC_VERSION >= 21
 		/* Re-enter VM after non-critical downcalls. */
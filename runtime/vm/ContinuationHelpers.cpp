@@ -34,6 +34,43 @@
 
 extern "C" {
 
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+static VMINLINE UDATA
+getContinuationInitialStackSize(J9JavaVM *vm)
+{
+	return (vm->initialStackSize > (UDATA)vm->stackSize) ? vm->stackSize : vm->initialStackSize;
+}
+
+/**
+ * Move the frames of the continuation that is about to be unmounted to a smaller stack if it
+ * uses only a small part of its stack, so that a parked virtual thread does not hold on to stack
+ * memory it needed only transiently. The stack grows again on demand after the continuation
+ * is mounted.
+ *
+ * @param[in] currentThread the carrier thread which still has the continuation stack mounted
+ * @param[in] continuation the continuation being unmounted
+ */
+static void
+trimContinuationStack(J9VMThread *currentThread, J9VMContinuation *continuation)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9JavaStack *stack = currentThread->stackObject;
+	UDATA initialStackSize = getContinuationInitialStackSize(vm);
+	UDATA usedBytes = (UDATA)stack->end - (UDATA)currentThread->sp;
+	UDATA newStackSize = ROUND_UP_TO(initialStackSize, usedBytes);
+
+	/* Only trim if at least one growth increment is saved, to avoid moving the stack back
+	 * and forth for continuations which repeatedly need a slightly larger stack.
+	 */
+	if ((newStackSize + vm->stackSizeIncrement) <= stack->size) {
+		UDATA oldStackSize = stack->size;
+		/* On failure the continuation simply keeps its current stack. */
+		UDATA rc = trimJavaStack(currentThread, newStackSize);
+		Trc_VM_yieldContinuation_TrimStack(currentThread, continuation, oldStackSize, newStackSize, usedBytes, rc);
+	}
+}
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
+
 BOOLEAN
 createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 {
@@ -321,6 +358,10 @@ yieldContinuation(J9VMThread *currentThread, BOOLEAN isFinished, UDATA returnSta
 
 	if (isFinished) {
 		VM_ContinuationHelpers::setFinished(continuationStatePtr);
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+	} else if (J9_ARE_ANY_BITS_SET(currentThread->javaVM->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_TRIM_CONTINUATION_STACKS)) {
+		trimContinuationStack(currentThread, continuation);
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
 	}
 
 	currentThread->currentContinuation = NULL;
@@ -413,6 +454,20 @@ recycleContinuation(J9JavaVM *vm, J9VMThread *vmThread, J9VMContinuation* contin
 	bool cached = false;
 	vm->totalContinuationStackSize += continuation->stackObject->size;
 
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_TRIM_CONTINUATION_STACKS)) {
+		/* Don't keep a grown stack alive in the cache, the next user starts small. */
+		UDATA initialStackSize = getContinuationInitialStackSize(vm);
+		if (continuation->stackObject->size > initialStackSize) {
+			J9JavaStack *stack = allocateJavaStack(vm, initialStackSize, NULL);
+			if (NULL != stack) {
+				freeJavaStack(vm, continuation->stackObject);
+				continuation->stackObject = stack;
+			}
+		}
+	}
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
+
 	if (!skipLocalCache && (0 < vm->continuationT1Size)) {
 		/* If called by carrier thread (not global), try to store in local cache first.
 		 * Allocate cacheArray if it doesn't exist.
@@ -0,0 +1,367 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "j9.h"
+#include "j9consts.h"
+#include "mmomrhook.h"
+#include "vm_internal.h"
+#include "AtomicSupport.hpp"
+
+/*
+ * Walkback PCs are decoded into frames once and shared by every consumer of stack traces
+ * (Throwable.getStackTrace(), StackWalker and JFR). Entries are immutable and published with a
+ * single compare and swap, so readers need no locks. Readers hold VM access while copying an
+ * entry out, so entries are only freed while exclusive VM access is held.
+ *
+ * A store whose probe window is full replaces an entry in it, preferring a stale one. The
+ * replaced entry is unpublished and freed at the next GC, flush or code unload done with
+ * exclusive VM access. Replacements stop while too many unpublished entries are waiting.
+ */
+
+#define DECODED_FRAME_CACHE_TABLE_SIZE 4096
+#define DECODED_FRAME_CACHE_MAX_PROBES 8
+
+extern "C" {
+
+static void flushDecodedFrameCache(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void reclaimDecodedFrameCacheEntries(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void hookDecodedFrameCacheAboutToBootstrap(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+static void invalidateDecodedJITFrames(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* defined(J9VM_INTERP_NATIVE_SUPPORT) */
+
+static VMINLINE UDATA
+hashPC(UDATA pc)
+{
+	/* Code and bytecode PCs share their low bits with their neighbours; spread the high bits down */
+	return (pc >> 2) ^ (pc >> 13) ^ (pc >> 23);
+}
+
+static VMINLINE bool
+hasExclusiveVMAccess(J9JavaVM *vm)
+{
+	return (J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState) || (J9_XACCESS_EXCLUSIVE == vm->safePointState);
+}
+
+/**
+ * JIT entries decoded before the last code unload may name metadata which has been freed.
+ */
+static VMINLINE bool
+isStaleEntry(J9DecodedFrameCacheEntry *entry, UDATA codeGeneration)
+{
+	return (NULL != entry->metaData) && (codeGeneration != entry->codeGeneration);
+}
+
+/**
+ * Queue an entry which has been removed from the table to be freed once exclusive VM access is held.
+ */
+static void
+deferEntry(J9DecodedFrameCache *cache, J9DecodedFrameCacheEntry *entry)
+{
+	J9DecodedFrameCacheEntry *head = NULL;
+
+	do {
+		head = cache->deferredEntries;
+		entry->next = head;
+	} while (head != (J9DecodedFrameCacheEntry *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&cache->deferredEntries, (uintptr_t)head, (uintptr_t)entry));
+	VM_AtomicSupport::add(&cache->deferredCount, 1);
+}
+
+/**
+ * Free the unpublished entries. Must be called with exclusive VM access.
+ */
+static void
+freeDeferredEntries(J9JavaVM *vm, J9DecodedFrameCache *cache)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9DecodedFrameCacheEntry *entry = cache->deferredEntries;
+
+	while (NULL != entry) {
+		J9DecodedFrameCacheEntry *next = entry->next;
+		j9mem_free_memory(entry);
+		entry = next;
+	}
+	cache->deferredEntries = NULL;
+	cache->deferredCount = 0;
+}
+
+static void
+freeEntries(J9JavaVM *vm, J9DecodedFrameCache *cache)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (UDATA i = 0; i <= cache->tableMask; i++) {
+		if (NULL != cache->table[i]) {
+			j9mem_free_memory(cache->table[i]);
+			cache->table[i] = NULL;
+		}
+	}
+	cache->entryCount = 0;
+	freeDeferredEntries(vm, cache);
+}
+
+/**
+ * Discard every cached entry. Triggered when classes are unloaded or redefined, either of which
+ * may leave a cached PC or the frames decoded from it stale. The hooks are normally called with
+ * exclusive VM access, in which case the entries are freed immediately. Otherwise they are
+ * unpublished and freed later, as readers may still be copying them.
+ */
+static void
+flushDecodedFrameCache(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	J9DecodedFrameCache *cache = vm->decodedFrameCache;
+
+	if (hasExclusiveVMAccess(vm)) {
+		if ((0 != cache->entryCount) || (0 != cache->deferredCount)) {
+			freeEntries(vm, cache);
+		}
+	} else if (0 != cache->entryCount) {
+		for (UDATA i = 0; i <= cache->tableMask; i++) {
+			J9DecodedFrameCacheEntry *entry = cache->table[i];
+			if ((NULL != entry)
+				&& (entry == (J9DecodedFrameCacheEntry *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&cache->table[i], (uintptr_t)entry, (uintptr_t)NULL))
+			) {
+				VM_AtomicSupport::subtract(&cache->entryCount, 1);
+				deferEntry(cache, entry);
+			}
+		}
+	}
+}
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+/**
+ * Invalidate the JIT entries when JIT code is reclaimed. This fires once per reclaimed method body,
+ * so rather than scanning the table, the code generation is advanced: JIT entries recorded under an
+ * older generation are ignored by lookups and replaced by stores. Interpreted entries stay valid.
+ */
+static void
+invalidateDecodedJITFrames(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	J9DecodedFrameCache *cache = vm->decodedFrameCache;
+
+	VM_AtomicSupport::add(&cache->codeGeneration, 1);
+	if ((0 != cache->deferredCount) && hasExclusiveVMAccess(vm)) {
+		freeDeferredEntries(vm, cache);
+	}
+}
+#endif /* defined(J9VM_INTERP_NATIVE_SUPPORT) */
+
+/**
+ * Free the entries replaced since the last exclusive VM access, so that replacement can continue
+ * in applications which neither unload classes nor reclaim JIT code.
+ */
+static void
+reclaimDecodedFrameCacheEntries(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	J9DecodedFrameCache *cache = vm->decodedFrameCache;
+
+	if ((NULL != cache) && (0 != cache->deferredCount) && hasExclusiveVMAccess(vm)) {
+		freeDeferredEntries(vm, cache);
+	}
+}
+
+/**
+ * The GC hook interface is not available when the cache is initialized, so hook the start of
+ * each GC once the VM is about to bootstrap. Without these hooks, replaced entries are only
+ * freed when classes are unloaded or JIT code is reclaimed.
+ */
+static void
+hookDecodedFrameCacheAboutToBootstrap(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	J9HookInterface **gcOmrHooks = vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
+
+	(*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, reclaimDecodedFrameCacheEntries, OMR_GET_CALLSITE(), vm);
+	(*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, reclaimDecodedFrameCacheEntries, OMR_GET_CALLSITE(), vm);
+}
+
+UDATA
+initializeDecodedFrameCache(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	UDATA tableBytes = sizeof(J9DecodedFrameCacheEntry *) * DECODED_FRAME_CACHE_TABLE_SIZE;
+	J9DecodedFrameCache *cache = (J9DecodedFrameCache *)j9mem_allocate_memory(sizeof(J9DecodedFrameCache), J9MEM_CATEGORY_VM);
+
+	if (NULL == cache) {
+		return 1;
+	}
+	memset(cache, 0, sizeof(J9DecodedFrameCache));
+	cache->table = (J9DecodedFrameCacheEntry * volatile *)j9mem_allocate_memory(tableBytes, J9MEM_CATEGORY_VM);
+	if (NULL == cache->table) {
+		j9mem_free_memory(cache);
+		return 1;
+	}
+	memset((void *)cache->table, 0, tableBytes);
+	cache->tableMask = DECODED_FRAME_CACHE_TABLE_SIZE - 1;
+	/* replaced entries held between exclusive VM accesses; at most one more table's worth of memory */
+	cache->maxDeferred = DECODED_FRAME_CACHE_TABLE_SIZE;
+	vm->decodedFrameCache = cache;
+
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, flushDecodedFrameCache, OMR_GET_CALLSITE(), vm)
+		|| 0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ABOUT_TO_BOOTSTRAP, hookDecodedFrameCacheAboutToBootstrap, OMR_GET_CALLSITE(), vm)
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		|| 0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, flushDecodedFrameCache, OMR_GET_CALLSITE(), vm)
+		|| 0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, flushDecodedFrameCache, OMR_GET_CALLSITE(), vm)
+#endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+		|| 0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_DYNAMIC_CODE_UNLOAD, invalidateDecodedJITFrames, OMR_GET_CALLSITE(), vm)
+#endif /* defined(J9VM_INTERP_NATIVE_SUPPORT) */
+	) {
+		freeDecodedFrameCache(vm);
+		return 1;
+	}
+
+	return 0;
+}
+
+void
+freeDecodedFrameCache(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9DecodedFrameCache *cache = vm->decodedFrameCache;
+
+	if (NULL != cache) {
+		J9HookInterface **vmHooks = getVMHookInterface(vm);
+
+		/* the GC hooks went away with the GC, which has already shut down */
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, flushDecodedFrameCache, vm);
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_ABOUT_TO_BOOTSTRAP, hookDecodedFrameCacheAboutToBootstrap, vm);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, flushDecodedFrameCache, vm);
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, flushDecodedFrameCache, vm);
+#endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_DYNAMIC_CODE_UNLOAD, invalidateDecodedJITFrames, vm);
+#endif /* defined(J9VM_INTERP_NATIVE_SUPPORT) */
+
+		freeEntries(vm, cache);
+		j9mem_free_memory((void *)cache->table);
+		j9mem_free_memory(cache);
+		vm->decodedFrameCache = NULL;
+	}
+}
+
+UDATA
+lookupDecodedFrames(J9VMThread *currentThread, UDATA pc, J9DecodedFrame *frames, J9JITExceptionTable **metaData, UDATA *codeGeneration)
+{
+	J9DecodedFrameCache *cache = currentThread->javaVM->decodedFrameCache;
+	UDATA frameCount = 0;
+
+	*codeGeneration = 0;
+	if (NULL != cache) {
+		UDATA currentGeneration = cache->codeGeneration;
+		UDATA index = hashPC(pc) & cache->tableMask;
+
+		/* read before the entries so that a store after a miss is not tagged with a later generation */
+		VM_AtomicSupport::readBarrier();
+		*codeGeneration = currentGeneration;
+		for (UDATA probe = 0; probe < DECODED_FRAME_CACHE_MAX_PROBES; probe++) {
+			J9DecodedFrameCacheEntry *entry = cache->table[index];
+			if (NULL == entry) {
+				break;
+			}
+			VM_AtomicSupport::readBarrier();
+			if ((pc == entry->pc) && !isStaleEntry(entry, currentGeneration)) {
+				frameCount = entry->frameCount;
+				memcpy(frames, entry->frames, sizeof(J9DecodedFrame) * frameCount);
+				*metaData = entry->metaData;
+				break;
+			}
+			index = (index + 1) & cache->tableMask;
+		}
+	}
+
+	return frameCount;
+}
+
+void
+storeDecodedFrames(J9VMThread *currentThread, UDATA pc, J9DecodedFrame *frames, UDATA frameCount, J9JITExceptionTable *metaData, UDATA codeGeneration)
+{
+	J9DecodedFrameCache *cache = currentThread->javaVM->decodedFrameCache;
+
+	/* JIT frames decoded across a code unload may describe the unloaded code */
+	if ((NULL != cache) && ((NULL == metaData) || (codeGeneration == cache->codeGeneration))) {
+		PORT_ACCESS_FROM_VMC(currentThread);
+		J9DecodedFrameCacheEntry *entry = (J9DecodedFrameCacheEntry *)j9mem_allocate_memory(
+				offsetof(J9DecodedFrameCacheEntry, frames) + (sizeof(J9DecodedFrame) * frameCount), J9MEM_CATEGORY_VM);
+
+		if (NULL != entry) {
+			UDATA index = hashPC(pc) & cache->tableMask;
+			J9DecodedFrameCacheEntry *victim = NULL;
+			UDATA victimIndex = 0;
+
+			entry->pc = pc;
+			entry->metaData = metaData;
+			entry->next = NULL;
+			entry->codeGeneration = codeGeneration;
+			entry->frameCount = frameCount;
+			memcpy(entry->frames, frames, sizeof(J9DecodedFrame) * frameCount);
+			/* the entry must be complete before any reader can see it */
+			VM_AtomicSupport::writeBarrier();
+
+			for (UDATA probe = 0; probe < DECODED_FRAME_CACHE_MAX_PROBES; probe++) {
+				J9DecodedFrameCacheEntry *existing = cache->table[index];
+				if (NULL == existing) {
+					existing = (J9DecodedFrameCacheEntry *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&cache->table[index], (uintptr_t)NULL, (uintptr_t)entry);
+					if (NULL == existing) {
+						VM_AtomicSupport::add(&cache->entryCount, 1);
+						return;
+					}
+					/* lost the race for this slot; compare against the winner */
+				}
+				if (isStaleEntry(existing, codeGeneration)) {
+					/* prefer replacing a stale entry over a live one */
+					if ((NULL == victim) || !isStaleEntry(victim, codeGeneration)) {
+						victim = existing;
+						victimIndex = index;
+					}
+				} else if (pc == existing->pc) {
+					/* already cached */
+					goto freeEntry;
+				} else if (NULL == victim) {
+					victim = existing;
+					victimIndex = index;
+				}
+				index = (index + 1) & cache->tableMask;
+			}
+
+			/* no free slot within reach: replace the victim, unless too many replaced entries are still waiting to be freed */
+			if ((cache->deferredCount < cache->maxDeferred)
+				&& (victim == (J9DecodedFrameCacheEntry *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&cache->table[victimIndex], (uintptr_t)victim, (uintptr_t)entry))
+			) {
+				deferEntry(cache, victim);
+				return;
+			}
+freeEntry:
+			j9mem_free_memory(entry);
+		}
+	}
+}
+
+} /* extern "C" */
@@ -1575,6 +1575,37 @@ VM_JFRChunkWriter::writeGCHeapSummaryEvent(void *anElement, void *userData)
 	writeEventSize(bufferWriter, dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeObjectAllocationSampleEvent(void *anElement, void *userData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(ObjectAllocationSampleID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write stacktrace index */
+	bufferWriter->writeLEB128(entry->stackTraceIndex);
+
+	/* Write object class index */
+	bufferWriter->writeLEB128(entry->objectClass);
+
+	/* Write weight, the bytes allocated by the thread since its previous sample */
+	bufferWriter->writeLEB128(entry->weight);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
 void
 VM_JFRChunkWriter::writeModuleRequire(void *anElement, void *userData)
 {
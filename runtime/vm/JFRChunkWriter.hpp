@@ -93,6 +93,7 @@ enum MetadataTypeID {
 	SystemGCID = 36,
 	YoungGarbageCollectionID = 38,
 	OldGarbageCollectionID = 39,
+	ObjectAllocationSampleID = 83,
 	JVMInformationID = 87,
 	OSInformationID = 88,
 	VirtualizationInformationID = 89,
@@ -223,6 +224,7 @@ private:
 	static constexpr int YOUNG_GARBAGE_COLLECTION_EVENT_SIZE = sizeof(U_8) + (2 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE);
 	static constexpr int GARBAGE_COLLECTION_EVENT_SIZE = sizeof(U_8) + (4 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE) + (2 * STRING_BUFFER_LENGTH);
 	static constexpr int GC_HEAP_SUMMARY_EVENT_SIZE = sizeof(U_8) + (7 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE) + STRING_BUFFER_LENGTH;
+	static constexpr int OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE = sizeof(U_8) + (2 * LEB128_64_SIZE) + (4 * LEB128_32_SIZE);
 
 	static constexpr int METADATA_ID = 1;
 
@@ -451,6 +453,8 @@ done:
 
 			pool_do(_constantPoolTypes.getGCHeapSummaryTable(), &writeGCHeapSummaryEvent, _bufferWriter);
 
+			pool_do(_constantPoolTypes.getObjectAllocationSampleTable(), &writeObjectAllocationSampleEvent, _bufferWriter);
+
 			/* Only write constant events in first chunk */
 			if (0 == _vm->jfrState.jfrChunkCount) {
 				writeJVMInformationEvent();
@@ -907,6 +911,8 @@ done:
 
 	static void writeGCHeapSummaryEvent(void *anElement, void *userData);
 
+	static void writeObjectAllocationSampleEvent(void *anElement, void *userData);
+
 	UDATA
 	calculateRequiredBufferSize()
 	{
@@ -1001,6 +1007,8 @@ done:
 
 		requiredBufferSize += (_constantPoolTypes.getGCHeapSummaryCount() * GC_HEAP_SUMMARY_EVENT_SIZE);
 
+		requiredBufferSize += (_constantPoolTypes.getObjectAllocationSampleCount() * OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE);
+
 		return requiredBufferSize;
 	}
 
@@ -1486,6 +1486,34 @@ done:
 	return;
 }
 
+void
+VM_JFRConstantPoolTypes::addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)pool_newElement(_objectAllocationSampleTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = objectAllocationSampleData->startTicks;
+	entry->weight = (I_64)objectAllocationSampleData->weight;
+
+	entry->eventThreadIndex = addThreadEntry(objectAllocationSampleData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->stackTraceIndex = consumeStackTrace(objectAllocationSampleData->vmThread, J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(objectAllocationSampleData), objectAllocationSampleData->stackTraceSize);
+	if (isResultNotOKay()) goto done;
+
+	entry->objectClass = getClassEntry(objectAllocationSampleData->objectClass);
+	if (isResultNotOKay()) goto done;
+
+	_objectAllocationSampleCount += 1;
+
+done:
+	return;
+}
+
 void
 VM_JFRConstantPoolTypes::printTables()
 {
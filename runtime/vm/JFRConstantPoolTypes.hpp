@@ -333,6 +333,14 @@ struct GCHeapSummaryEntry {
 	I_64 heapUsed;
 };
 
+struct ObjectAllocationSampleEntry {
+	I_64 ticks;
+	U_32 eventThreadIndex;
+	U_32 stackTraceIndex;
+	U_32 objectClass;
+	I_64 weight;
+};
+
 struct ModuleRequireEntry {
 	I_64 ticks;
 	U_32 sourceModuleIndex;
@@ -488,6 +496,8 @@ private:
 	UDATA _garbageCollectionCount;
 	J9Pool *_gcHeapSummaryTable;
 	UDATA _gcHeapSummaryCount;
+	J9Pool *_objectAllocationSampleTable;
+	UDATA _objectAllocationSampleCount;
 
 	/* Processing buffers */
 	StackFrame *_currentStackFrameBuffer;
@@ -777,6 +787,8 @@ public:
 
 	void addGCHeapSummaryEntry(J9JFRGCHeapSummary *gcHeapSummaryData);
 
+	void addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData);
+
 	J9Pool *getExecutionSampleTable()
 	{
 		return _executionSampleTable;
@@ -917,6 +929,16 @@ public:
 		return _gcHeapSummaryCount;
 	}
 
+	J9Pool *getObjectAllocationSampleTable()
+	{
+		return _objectAllocationSampleTable;
+	}
+
+	UDATA getObjectAllocationSampleCount()
+	{
+		return _objectAllocationSampleCount;
+	}
+
 	UDATA getThreadStartCount()
 	{
 		return _threadStartCount;
@@ -1188,6 +1210,9 @@ public:
 			case J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY:
 				addGCHeapSummaryEntry((J9JFRGCHeapSummary *)event);
 				break;
+			case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+				addObjectAllocationSampleEntry((J9JFRObjectAllocationSample *)event);
+				break;
 			default:
 				Assert_VM_unreachable();
 				break;
@@ -1848,6 +1873,8 @@ done:
 		, _garbageCollectionCount(0)
 		, _gcHeapSummaryTable(NULL)
 		, _gcHeapSummaryCount(0)
+		, _objectAllocationSampleTable(NULL)
+		, _objectAllocationSampleCount(0)
 		, _previousStackTraceEntry(NULL)
 		, _firstStackTraceEntry(NULL)
 		, _previousThreadEntry(NULL)
@@ -2054,6 +2081,12 @@ done:
 			goto done;
 		}
 
+		_objectAllocationSampleTable = pool_new(sizeof(ObjectAllocationSampleEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _objectAllocationSampleTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
 		/* Add reserved index for default entries. For strings zero is the empty or NUll string.
 		 * For package zero is the deafult package, for Module zero is the unnamed module. ThreadGroup
 		 * zero is NULL threadGroup.
@@ -2157,6 +2190,7 @@ done:
 		pool_kill(_youngGarbageCollectionTable);
 		pool_kill(_garbageCollectionTable);
 		pool_kill(_gcHeapSummaryTable);
+		pool_kill(_objectAllocationSampleTable);
 		j9mem_free_memory(_globalStringTable);
 	}
 
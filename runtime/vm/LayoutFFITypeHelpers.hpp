@@ -31,6 +31,39 @@
 
 #define J9VM_LAYOUT_STRING_ON_STACK_LIMIT 128
 
+#if JAVA_SPEC_VERSION >= 16
+#if defined(J9VM_ARCH_X86) && defined(J9VM_ENV_DATA64) && !defined(WIN32)
+/* Downcalls whose arguments all fit in the argument registers of the
+ * x86-64 System V ABI are called directly instead of via ffi_call.
+ */
+#define J9VM_FFI_DIRECT_DOWNCALL
+#define J9VM_FFI_DIRECT_DOWNCALL_GPR_COUNT 6
+#define J9VM_FFI_DIRECT_DOWNCALL_FPR_COUNT 8
+#define J9VM_FFI_DIRECT_DOWNCALL_REGISTER_COUNT (J9VM_FFI_DIRECT_DOWNCALL_GPR_COUNT + J9VM_FFI_DIRECT_DOWNCALL_FPR_COUNT)
+
+/* How directDowncallThunk() stores the return value, see xa64/directDowncall.m4 */
+#define J9VM_FFI_DIRECT_DOWNCALL_RETURN_INTEGER 0
+#define J9VM_FFI_DIRECT_DOWNCALL_RETURN_FLOAT 1
+#define J9VM_FFI_DIRECT_DOWNCALL_RETURN_DOUBLE 2
+#endif /* defined(J9VM_ARCH_X86) && defined(J9VM_ENV_DATA64) && !defined(WIN32) */
+
+/* The element of vm->cifNativeCalloutDataCache. The ffi_cif must remain the first
+ * field as the address of the element is passed around as the ffi_cif of the downcall.
+ */
+typedef struct J9DowncallCif {
+	ffi_cif cif;
+	BOOLEAN isDirectCall;
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+	/* The return kind passed to directDowncallThunk() */
+	UDATA directReturnKind;
+	/* The index of each argument in the register array loaded by directDowncallThunk(),
+	 * in which the general purpose registers precede the vector registers.
+	 */
+	U_8 directArgSlots[J9VM_FFI_DIRECT_DOWNCALL_REGISTER_COUNT];
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
+} J9DowncallCif;
+#endif /* JAVA_SPEC_VERSION >= 16 */
+
 class LayoutFFITypeHelpers
 {
 #if JAVA_SPEC_VERSION >= 16
@@ -175,6 +208,77 @@ public:
 		return typeCode;
 	}
 
+	/**
+	 * @brief Determine whether a downcall can be dispatched directly to the native function
+	 * rather than through ffi_call, which classifies every argument again on each call,
+	 * and if so record the register of each argument and the kind of the return value
+	 * for directDowncallThunk().
+	 *
+	 * This is only the case for non-variadic functions without struct arguments or return
+	 * value whose arguments are all passed in registers.
+	 *
+	 * @param downcallCif[in] The pointer to the J9DowncallCif containing the prepared ffi_cif of the downcall
+	 * @param varArgIndex[in] The index of the first variadic argument, or -1 if none
+	 */
+	static VMINLINE void
+	prepareDirectDowncall(J9DowncallCif *downcallCif, I_32 varArgIndex)
+	{
+		BOOLEAN isSupported = FALSE;
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+		ffi_cif *cif = &(downcallCif->cif);
+
+		/* A variadic callee expects the count of the used vector registers in %al,
+		 * which is not set up for a direct call.
+		 */
+		if (varArgIndex < 0) {
+			U_32 gprCount = 0;
+			U_32 fprCount = 0;
+
+			isSupported = TRUE;
+			switch (getJ9NativeTypeCodeFromFFIType(cif->rtype)) {
+			case J9NtcStruct:
+				isSupported = FALSE;
+				break;
+			case J9NtcFloat:
+				downcallCif->directReturnKind = J9VM_FFI_DIRECT_DOWNCALL_RETURN_FLOAT;
+				break;
+			case J9NtcDouble:
+				downcallCif->directReturnKind = J9VM_FFI_DIRECT_DOWNCALL_RETURN_DOUBLE;
+				break;
+			default:
+				/* The bits above the size of the return type are discarded in convertFFIReturnValue(). */
+				downcallCif->directReturnKind = J9VM_FFI_DIRECT_DOWNCALL_RETURN_INTEGER;
+				break;
+			}
+
+			for (U_32 argIndex = 0; isSupported && (argIndex < cif->nargs); argIndex++) {
+				switch (getJ9NativeTypeCodeFromFFIType(cif->arg_types[argIndex])) {
+				case J9NtcStruct:
+					isSupported = FALSE;
+					break;
+				case J9NtcFloat:
+					/* Fall through is intentional */
+				case J9NtcDouble:
+					isSupported = (fprCount < J9VM_FFI_DIRECT_DOWNCALL_FPR_COUNT);
+					if (isSupported) {
+						downcallCif->directArgSlots[argIndex] = (U_8)(J9VM_FFI_DIRECT_DOWNCALL_GPR_COUNT + fprCount);
+						fprCount += 1;
+					}
+					break;
+				default:
+					isSupported = (gprCount < J9VM_FFI_DIRECT_DOWNCALL_GPR_COUNT);
+					if (isSupported) {
+						downcallCif->directArgSlots[argIndex] = (U_8)gprCount;
+						gprCount += 1;
+					}
+					break;
+				}
+			}
+		}
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
+		downcallCif->isDirectCall = isSupported;
+	}
+
 	/**
 	 * @brief Obtain the ffi_type from the layout symbol (the preceding letter of the layout type. e.g. I for INT).
 	 *
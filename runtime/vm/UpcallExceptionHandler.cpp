@@ -24,12 +24,20 @@
 #include "vm_internal.h"
 #if JAVA_SPEC_VERSION >= 16
 #include "ffi.h"
+#include "LayoutFFITypeHelpers.hpp"
+#include "VMHelpers.hpp"
 #include <setjmp.h>
+#include <string.h>
 #endif /* JAVA_SPEC_VERSION >= 16 */
 
 extern "C" {
 
 #if JAVA_SPEC_VERSION >= 16
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+/* Defined in xa64/directDowncall.m4 */
+extern void directDowncallThunk(void *function, U_64 *registerArgs, UDATA *returnStorage, UDATA returnKind);
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
+
 /**
  * @brief Save the contents of registers in the call-out for longjmp in
  * the dispatcher to restore back to this call site whenever an exception
@@ -76,6 +84,116 @@ ffiCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *functi
 	currentThread->jmpBufEnvPtr = jmpBufEnvPtr;
 }
 
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+/**
+ * @brief Call the native function directly in the x86-64 System V ABI instead of via
+ * ffi_call, saving the contents of registers for longjmp in the same way as
+ * ffiCallWithSetJmpForUpcall().
+ *
+ * The arguments are placed in the register array as recorded by
+ * LayoutFFITypeHelpers::prepareDirectDowncall() and loaded into the argument registers
+ * by directDowncallThunk(), which also stores the result from the return register
+ * that matches the return type. The unused argument registers are ignored by the callee.
+ *
+ * @param currentThread[in] The pointer to the current J9VMThread
+ * @param cif[in] The pointer to the ffi_cif structure
+ * @param function[in] The pointer to the native function address
+ * @param returnStorage[in] The pointer to the return value
+ * @param values[in] The pointer to an array of the passed-in arguments
+ */
+void
+directCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *function, UDATA *returnStorage, void **values)
+{
+	jmp_buf jmpBufferEnv = {};
+	void *jmpBufEnvPtr = currentThread->jmpBufEnvPtr;
+	J9DowncallCif *downcallCif = (J9DowncallCif *)cif;
+	U_64 registerArgs[J9VM_FFI_DIRECT_DOWNCALL_REGISTER_COUNT] = {0};
+
+	for (U_32 argIndex = 0; argIndex < cif->nargs; argIndex++) {
+		/* A float is passed in the low 32 bits of the vector register, which is
+		 * where the bits of the float are placed in the argument slot.
+		 */
+		registerArgs[downcallCif->directArgSlots[argIndex]] = *(U_64 *)values[argIndex];
+	}
+
+	currentThread->jmpBufEnvPtr = (void *)&jmpBufferEnv;
+
+	if (!setjmp(jmpBufferEnv)) {
+		directDowncallThunk(function, registerArgs, returnStorage, downcallCif->directReturnKind);
+	}
+	currentThread->jmpBufEnvPtr = jmpBufEnvPtr;
+}
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
+
+/**
+ * @brief Call the native function of a downcall from compiled code, which has already
+ * built the JNI call-out frame, copied the arguments out of the argument array and
+ * released VM access.
+ *
+ * Only the downcalls without heap arguments, the critical linker option or the captured
+ * call state are dispatched here, so every argument is passed by value except that a
+ * struct argument is the address of the native memory storing the struct.
+ *
+ * @param currentThread[in] The pointer to the current J9VMThread
+ * @param cifAddress[in] The pointer to the ffi_cif structure
+ * @param function[in] The pointer to the native function address
+ * @param argValues[in] The pointer to an array of at most J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT arguments
+ * @param returnStructMemAddr[in] The pointer to the native memory for the returned struct
+ * @return The return value converted as in the interpreter
+ */
+U_64 JNICALL
+invokeDowncallFromJIT(J9VMThread *currentThread, void *cifAddress, void *function, U_64 *argValues, void *returnStructMemAddr)
+{
+	ffi_cif *cif = (ffi_cif *)cifAddress;
+	U_8 returnType = LayoutFFITypeHelpers::getJ9NativeTypeCodeFromFFIType(cif->rtype);
+	UDATA *returnStorage = &(currentThread->returnValue);
+	void *values[J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT];
+#if FFI_NATIVE_RAW_API
+	ffi_raw values_raw[(((sizeof(double) - 1U) / sizeof(ffi_raw)) + 1U) * J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT];
+#endif /* FFI_NATIVE_RAW_API */
+
+	Assert_VM_true(cif->nargs <= J9_FFI_DOWNCALL_JIT_MAX_ARG_COUNT);
+
+	if (J9NtcStruct == returnType) {
+		returnStorage = (UDATA *)returnStructMemAddr;
+	}
+
+	for (U_32 argIndex = 0; argIndex < cif->nargs; argIndex++) {
+		U_8 argType = LayoutFFITypeHelpers::getJ9NativeTypeCodeFromFFIType(cif->arg_types[argIndex]);
+
+		if (J9NtcStruct == argType) {
+			values[argIndex] = (void *)(UDATA)argValues[argIndex];
+		} else {
+			values[argIndex] = &(argValues[argIndex]);
+#if !defined(J9VM_ENV_LITTLE_ENDIAN)
+			if ((J9NtcInt == argType) || (J9NtcFloat == argType)) {
+				values[argIndex] = (void *)((UDATA)values[argIndex] + 4);
+			} else if ((J9NtcShort == argType) || (J9NtcChar == argType)) {
+				values[argIndex] = (void *)((UDATA)values[argIndex] + 6);
+			} else if ((J9NtcBoolean == argType) || (J9NtcByte == argType)) {
+				values[argIndex] = (void *)((UDATA)values[argIndex] + 7);
+			}
+#endif /* !defined(J9VM_ENV_LITTLE_ENDIAN) */
+		}
+	}
+
+#if defined(J9VM_FFI_DIRECT_DOWNCALL)
+	if (((J9DowncallCif *)cif)->isDirectCall) {
+		directCallWithSetJmpForUpcall(currentThread, cif, function, returnStorage, values);
+	} else
+#endif /* defined(J9VM_FFI_DIRECT_DOWNCALL) */
+	{
+#if FFI_NATIVE_RAW_API
+		ffiCallWithSetJmpForUpcall(currentThread, cif, function, returnStorage, values, values_raw);
+#else /* FFI_NATIVE_RAW_API */
+		ffiCallWithSetJmpForUpcall(currentThread, cif, function, returnStorage, values);
+#endif /* FFI_NATIVE_RAW_API */
+	}
+
+	VM_VMHelpers::convertFFIReturnValue(currentThread, returnType, cif->rtype->size, returnStorage);
+	return (U_64)currentThread->returnValue;
+}
+
 /**
  * @brief This function serves as a wrapper of longjmp that restore back to
  * the call site with all registered saved via setjmp whenever an exception
@@ -665,7 +665,7 @@ attemptDynamicClassLoad(J9VMThread* vmThread, J9Module *j9module, U_8* className
 
 					/* this function exits the class table mutex */
 					foundClass = dynamicLoadBuffers->internalDefineClassFunction(vmThread, className, classNameLength,
-						dynamicLoadBuffers->sunClassFileBuffer, dynamicLoadBuffers->currentSunClassFileSize,
+						dynamicLoadBuffers->currentSunClassFileData, dynamicLoadBuffers->currentSunClassFileSize,
 						NULL, classLoader, NULL, defineClassOptions, NULL, NULL, &localBuffer); /* this function exits the class table mutex */
 				}
 			} else {
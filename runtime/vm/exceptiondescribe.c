@@ -41,6 +41,11 @@ static void printExceptionInThread (J9VMThread* vmThread);
 static UDATA isSubclassOfThreadDeath (J9VMThread *vmThread, j9object_t exception);
 static void printExceptionMessage (J9VMThread* vmThread, j9object_t exception);
 static J9Class* findJ9ClassForROMClass(J9VMThread *vmThread, J9ROMClass *romClass, J9ClassLoader **resultClassLoader);
+static UDATA decodeInterpretedPC(J9VMThread *vmThread, UDATA methodPC, J9ROMClass **resultROMClass, J9ROMMethod **resultROMMethod, J9ClassLoader **resultClassLoader, J9Class **resultRAMClass);
+#ifdef J9VM_INTERP_NATIVE_SUPPORT
+static UDATA decodeFramesFromPC(J9VMThread *vmThread, UDATA methodPC, J9DecodedFrame *frames, J9JITExceptionTable **resultMetaData);
+static UDATA getDecodedFrames(J9VMThread *vmThread, UDATA methodPC, J9DecodedFrame *frames, J9JITExceptionTable **resultMetaData);
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
 
 
 /* assumes VM access */
@@ -338,6 +343,197 @@ done:
 	return ret;
 }
 
+/**
+ * Find the method containing an interpreted walkback PC.
+ *
+ * @param vmThread the current J9VMThread
+ * @param methodPC the walkback PC
+ * @param resultROMClass returns the ROM class containing the PC, or NULL
+ * @param resultROMMethod returns the ROM method containing the PC, or NULL
+ * @param resultClassLoader returns the class loader of the ROM class
+ * @param resultRAMClass returns the RAM class (possibly a replaced one) whose methods include the ROM method, or NULL
+ * @return the bytecode offset of the PC within the ROM method, or UDATA_MAX if the method is unknown
+ */
+static UDATA
+decodeInterpretedPC(J9VMThread *vmThread, UDATA methodPC, J9ROMClass **resultROMClass, J9ROMMethod **resultROMMethod, J9ClassLoader **resultClassLoader, J9Class **resultRAMClass)
+{
+	J9ROMClass *romClass = NULL;
+	J9ROMMethod *romMethod = NULL;
+	J9ClassLoader *classLoader = NULL;
+	J9Class *ramClass = NULL;
+
+	romClass = findROMClassFromPC(vmThread, methodPC, &classLoader);
+	if (NULL != romClass) {
+		ramClass = findJ9ClassForROMClass(vmThread, romClass, &classLoader);
+		while (NULL != ramClass) {
+			U_32 i = 0;
+			J9Method *methods = ramClass->ramMethods;
+			UDATA romMethodCount = ramClass->romClass->romMethodCount;
+			for (i = 0; i < romMethodCount; ++i) {
+				J9ROMMethod *possibleMethod = J9_ROM_METHOD_FROM_RAM_METHOD(&methods[i]);
+
+				/* Note that we cannot use `J9_BYTECODE_START_FROM_ROM_METHOD` here because native method PCs
+				 * point to the start of the J9ROMMethod data structure
+				 */
+				if ((methodPC >= (UDATA)possibleMethod) && (methodPC < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(possibleMethod))) {
+					romMethod = possibleMethod;
+					methodPC -= (UDATA)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+					romClass = ramClass->romClass;
+					goto foundROMMethod;
+				}
+			}
+
+			ramClass = ramClass->replacedClass;
+		}
+
+		romMethod = findROMMethodInROMClass(vmThread, romClass, methodPC);
+		if (NULL != romMethod) {
+			methodPC -= (UDATA)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+		} else {
+			methodPC = UDATA_MAX;
+		}
+foundROMMethod: ;
+	} else {
+		methodPC = UDATA_MAX;
+	}
+
+	*resultROMClass = romClass;
+	*resultROMMethod = romMethod;
+	*resultClassLoader = classLoader;
+	*resultRAMClass = ramClass;
+	return methodPC;
+}
+
+#ifdef J9VM_INTERP_NATIVE_SUPPORT
+/**
+ * Decode a walkback PC into the Java frames it represents, innermost inlined frame first.
+ * Pruning and hidden frame filtering are left to the consumer so that the result can be shared.
+ *
+ * @param vmThread the current J9VMThread
+ * @param methodPC the walkback PC
+ * @param frames buffer of J9_DECODED_FRAME_CACHE_MAX_FRAMES frames
+ * @param resultMetaData returns the JIT metadata the PC belongs to, or NULL for interpreted PCs
+ * @return the number of frames decoded, or 0 if the PC should be decoded without the cache
+ *
+ * @note Assumes VM access
+ */
+static UDATA
+decodeFramesFromPC(J9VMThread *vmThread, UDATA methodPC, J9DecodedFrame *frames, J9JITExceptionTable **resultMetaData)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9JITExceptionTable *metaData = NULL;
+	UDATA frameCount = 0;
+	UDATA i = 0;
+	J9JITConfig *jitConfig = vm->jitConfig;
+
+	if (NULL != jitConfig) {
+		metaData = jitConfig->jitGetExceptionTableFromPC(vmThread, methodPC);
+	}
+	if (NULL != metaData) {
+		void *inlineMap = NULL;
+		void *inlinedCallSite = NULL;
+		UDATA inlineDepth = 0;
+
+		/* Leave unloaded code to the uncached path, which reports it */
+		if (NULL == metaData->ramMethod) {
+			return 0;
+		}
+		inlineMap = jitConfig->jitGetInlinerMapFromPC(vmThread, vm, metaData, methodPC);
+		if (NULL != inlineMap) {
+			inlinedCallSite = jitConfig->getFirstInlinedCallSite(metaData, inlineMap);
+			if (NULL != inlinedCallSite) {
+				inlineDepth = jitConfig->getJitInlineDepthFromCallSite(metaData, inlinedCallSite);
+			}
+		}
+		if (inlineDepth >= J9_DECODED_FRAME_CACHE_MAX_FRAMES) {
+			return 0;
+		}
+
+		for (;;) {
+			J9DecodedFrame *frame = &frames[frameCount];
+			J9Method *ramMethod = NULL;
+			UDATA isSameReceiver = FALSE;
+
+			if (0 == inlineDepth) {
+				if (NULL == inlineMap) {
+					frame->bytecodeOffset = UDATA_MAX;
+				} else {
+					frame->bytecodeOffset = jitConfig->getCurrentByteCodeIndexAndIsSameReceiver(metaData, inlineMap, NULL, &isSameReceiver);
+				}
+				ramMethod = metaData->ramMethod;
+				frame->frameType = J9VM_STACK_FRAME_JIT;
+			} else {
+				frame->bytecodeOffset = jitConfig->getCurrentByteCodeIndexAndIsSameReceiver(metaData, inlineMap, inlinedCallSite, &isSameReceiver);
+				ramMethod = jitConfig->getInlinedMethod(inlinedCallSite);
+				frame->frameType = J9VM_STACK_FRAME_JIT_INLINE;
+			}
+			frame->isSameReceiver = isSameReceiver;
+			frame->romMethod = getOriginalROMMethodUnchecked(ramMethod);
+			frame->ramClass = J9_CLASS_FROM_CP(J9_CP_FROM_METHOD(ramMethod));
+			frame->romClass = frame->ramClass->romClass;
+			frame->classLoader = frame->ramClass->classLoader;
+			++frameCount;
+
+			if (0 == inlineDepth) {
+				break;
+			}
+			--inlineDepth;
+			inlinedCallSite = jitConfig->getNextInlinedCallSite(metaData, inlinedCallSite);
+		}
+	} else {
+		J9DecodedFrame *frame = &frames[0];
+
+		frame->bytecodeOffset = decodeInterpretedPC(vmThread, methodPC, &frame->romClass, &frame->romMethod, &frame->classLoader, &frame->ramClass);
+		/* PCs outside any known method may belong to classes which are still being loaded; don't remember them */
+		if (NULL == frame->romMethod) {
+			return 0;
+		}
+		frame->frameType = J9VM_STACK_FRAME_INTERPRETER;
+		frame->isSameReceiver = FALSE;
+		frameCount = 1;
+	}
+
+	for (i = 0; i < frameCount; ++i) {
+		J9DecodedFrame *frame = &frames[i];
+
+		frame->lineNumber = 0;
+#ifdef J9VM_OPT_DEBUG_INFO_SERVER
+		if (J9_ARE_ALL_BITS_SET(frame->romMethod->modifiers, J9AccNative)) {
+			frame->frameType = J9VM_STACK_FRAME_NATIVE;
+		}
+		frame->lineNumber = getLineNumberForROMClassFromROMMethod(vm, frame->romMethod, frame->romClass, frame->classLoader, frame->bytecodeOffset);
+		releaseOptInfoBuffer(vm, frame->romClass);
+#endif /* J9VM_OPT_DEBUG_INFO_SERVER */
+	}
+
+	*resultMetaData = metaData;
+	return frameCount;
+}
+
+/**
+ * Fetch the decoded frames for a walkback PC from the decoded frame cache, decoding and
+ * publishing them on a miss.
+ *
+ * @return the number of frames, or 0 if the PC must be decoded without the cache
+ *
+ * @note Assumes VM access
+ */
+static UDATA
+getDecodedFrames(J9VMThread *vmThread, UDATA methodPC, J9DecodedFrame *frames, J9JITExceptionTable **resultMetaData)
+{
+	UDATA codeGeneration = 0;
+	UDATA frameCount = lookupDecodedFrames(vmThread, methodPC, frames, resultMetaData, &codeGeneration);
+
+	if (0 == frameCount) {
+		frameCount = decodeFramesFromPC(vmThread, methodPC, frames, resultMetaData);
+		if (0 != frameCount) {
+			storeDecodedFrames(vmThread, methodPC, frames, frameCount, *resultMetaData, codeGeneration);
+		}
+	}
+	return frameCount;
+}
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+
 /*
  * Walks the backtrace of an exception instance, invoking a user-supplied callback function for
  * each frame on the call stack.
@@ -375,7 +571,9 @@ iterateStackTraceImpl(J9VMThread * vmThread, j9object_t* exception, callback_fun
 
 		U_32 currentElement = 0;
 		UDATA callbackResult = TRUE;
-#ifndef J9VM_INTERP_NATIVE_SUPPORT
+#ifdef J9VM_INTERP_NATIVE_SUPPORT
+		J9DecodedFrame frames[J9_DECODED_FRAME_CACHE_MAX_FRAMES];
+#else
 		pruneConstructors = FALSE;
 #endif
 		if (exceptionIsJavaObject) {
@@ -408,6 +606,7 @@ iterateStackTraceImpl(J9VMThread * vmThread, j9object_t* exception, callback_fun
 			void * inlinedCallSite = NULL;
 			void * inlineMap = NULL;
 			J9JITConfig * jitConfig = vm->jitConfig;
+			UDATA frameCount = 0;
 
 			if (exceptionIsJavaObject) {
 				methodPC = J9JAVAARRAYOFUDATA_LOAD(vmThread, J9VMJAVALANGTHROWABLE_WALKBACK(vmThread, (*exception)), currentElement);
@@ -415,6 +614,58 @@ iterateStackTraceImpl(J9VMThread * vmThread, j9object_t* exception, callback_fun
 				methodPC = ((UDATA *)exception)[currentElement];
 			}
 
+			if (NULL != vm->decodedFrameCache) {
+				frameCount = getDecodedFrames(vmThread, methodPC, frames, &metaData);
+			}
+			if (0 != frameCount) {
+				++currentElement;
+				totalEntries += frameCount;
+				if ((callback != NULL) || pruneConstructors || skipHiddenFrames) {
+					UDATA frameIndex = 0;
+
+					for (frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+						J9DecodedFrame *frame = &frames[frameIndex];
+
+						/* The frames are a copy, but the code may have been unloaded while a previous callback ran */
+						if ((NULL != metaData) && (NULL == metaData->ramMethod)) {
+							totalEntries = 0;
+							goto done;
+						}
+						if (pruneConstructors) {
+							if ((NULL != metaData) && frame->isSameReceiver) {
+								--totalEntries;
+								continue;
+							}
+							pruneConstructors = FALSE;
+						}
+						if (skipHiddenFrames) {
+							/* Skip Hidden methods and methods from Hidden or Anonymous classes */
+							if (J9ROMCLASS_IS_ANON_OR_HIDDEN(frame->romClass) || J9_ARE_ANY_BITS_SET(frame->romMethod->modifiers, J9AccMethodFrameIteratorSkip)) {
+								--totalEntries;
+								continue;
+							}
+						}
+#ifdef J9VM_OPT_DEBUG_INFO_SERVER
+						fileName = getSourceFileNameForROMClass(vm, frame->classLoader, frame->romClass);
+#endif
+						if (callback != NULL) {
+							callbackResult = callback(vmThread, userData, frame->bytecodeOffset, frame->romClass, frame->romMethod, fileName, frame->lineNumber, frame->classLoader, frame->ramClass, frame->frameType);
+						}
+#ifdef J9VM_OPT_DEBUG_INFO_SERVER
+						releaseOptInfoBuffer(vm, frame->romClass);
+#endif
+						if (!callbackResult) {
+							break;
+						}
+					}
+					/* Abort the walk if the callback said to do so */
+					if (!callbackResult) {
+						break;
+					}
+				}
+				continue;
+			}
+
 			if (jitConfig) {
 				metaData = jitConfig->jitGetExceptionTableFromPC(vmThread, methodPC);
 				if (metaData) {
@@ -471,42 +722,7 @@ inlinedEntry:
 				} else {
 					pruneConstructors = FALSE;
 #endif
-					romClass = findROMClassFromPC(vmThread, methodPC, &classLoader);
-					if (NULL != romClass) {
-						ramClass = findJ9ClassForROMClass(vmThread, romClass, &classLoader);
-						while (NULL != ramClass) {
-							U_32 i = 0;
-							J9Method *methods = ramClass->ramMethods;
-							UDATA romMethodCount = ramClass->romClass->romMethodCount;
-							for (i = 0; i < romMethodCount; ++i) {
-								J9ROMMethod *possibleMethod = J9_ROM_METHOD_FROM_RAM_METHOD(&methods[i]);
-
-								/* Note that we cannot use `J9_BYTECODE_START_FROM_ROM_METHOD` here because native method PCs
-								 * point to the start of the J9ROMMethod data structure
-								 */
-								if ((methodPC >= (UDATA)possibleMethod) && (methodPC < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(possibleMethod))) {
-									romMethod = possibleMethod;
-									methodPC -= (UDATA)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
-									romClass = ramClass->romClass;
-									goto foundROMMethod;
-								}
-							}
-
-							ramClass = ramClass->replacedClass;
-						}
-
-						if (NULL == romMethod) {
-							romMethod = findROMMethodInROMClass(vmThread, romClass, methodPC);
-							if (NULL != romMethod) {
-								methodPC -= (UDATA)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
-							} else {
-								methodPC = UDATA_MAX;
-							}
-						}
-foundROMMethod: ;
-					} else {
-						methodPC = UDATA_MAX;
-					}
+					methodPC = decodeInterpretedPC(vmThread, methodPC, &romClass, &romMethod, &classLoader, &ramClass);
 #ifdef J9VM_INTERP_NATIVE_SUPPORT
 				}
 #endif
@@ -585,6 +801,35 @@ iterateStackTrace(J9VMThread * vmThread, j9object_t* exception, callback_func_t
 	return iterateStackTraceImpl(vmThread, exception, callback, userData, pruneConstructors, skipHiddenFrames, 0, TRUE);
 }
 
+UDATA
+getLineNumberForStackWalkFrame(J9StackWalkState *walkState, J9ROMMethod *romMethod, J9ROMClass *romClass, J9ClassLoader *classLoader)
+{
+	J9VMThread *currentThread = walkState->currentThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	UDATA bytecodeOffset = walkState->bytecodePCOffset;
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT) && defined(J9VM_OPT_DEBUG_INFO_SERVER)
+	/* JIT frames are keyed by the same PC the exception walkback records, and decoding one
+	 * inlined frame decodes the rest of the chain that the walk is about to visit.
+	 * Interpreted walk PCs may point into breakpointed copies of bytecodes, so they are not cached.
+	 */
+	if ((NULL != vm->decodedFrameCache) && (NULL != walkState->jitInfo)) {
+		J9DecodedFrame frames[J9_DECODED_FRAME_CACHE_MAX_FRAMES];
+		J9JITExceptionTable *metaData = NULL;
+		UDATA frameCount = getDecodedFrames(currentThread, (UDATA)walkState->pc, frames, &metaData);
+
+		if (walkState->inlineDepth < frameCount) {
+			J9DecodedFrame *frame = &frames[frameCount - 1 - walkState->inlineDepth];
+			if ((romMethod == frame->romMethod) && (bytecodeOffset == frame->bytecodeOffset)) {
+				return frame->lineNumber;
+			}
+		}
+	}
+#endif /* defined(J9VM_INTERP_NATIVE_SUPPORT) && defined(J9VM_OPT_DEBUG_INFO_SERVER) */
+
+	return getLineNumberForROMClassFromROMMethod(vm, romMethod, romClass, classLoader, bytecodeOffset);
+}
+
 /**
  * This is an helper function to call exceptionDescribe indirectly from gpProtectAndRun function.
  *
@@ -104,6 +104,13 @@ UDATA   growJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 }
 
 
+UDATA   trimJavaStack(J9VMThread * vmThread, UDATA newStackSize)
+{
+	/* Relocating the frames works the same way regardless of the direction of the size change */
+	return internalGrowJavaStack(vmThread, newStackSize);
+}
+
+
 static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 {
 	PORT_ACCESS_FROM_VMC(vmThread);
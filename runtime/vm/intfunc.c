@@ -452,6 +452,7 @@ J9InternalVMFunctions J9InternalFunctions = {
 	native2InterpJavaUpcallD,
 	native2InterpJavaUpcallStruct,
 	hasMemoryScope,
+	invokeDowncallFromJIT,
 #endif /* JAVA_SPEC_VERSION >= 16 */
 #if JAVA_SPEC_VERSION >= 19
 	copyFieldsFromContinuation,
@@ -499,4 +500,5 @@ J9InternalVMFunctions J9InternalFunctions = {
 	disclaimClassMemory,
 	totalNumberOfDisclaimableClassMemorySegments,
 	signalNameToValue,
+	getLineNumberForStackWalkFrame,
 };
@@ -26,6 +26,7 @@
 #include "thread_api.h"
 #include "ut_j9vm.h"
 #include "vm_internal.h"
+#include "mmhook.h"
 #include "mmomrhook.h"
 
 #if defined(J9VM_OPT_JFR)
@@ -46,6 +47,9 @@ typedef struct J9JFRTypeID {
 #define J9JFR_THREAD_BUFFER_SIZE (1024*1024)
 #define J9JFR_GLOBAL_BUFFER_SIZE (10 * J9JFR_THREAD_BUFFER_SIZE)
 #define J9JFR_SAMPLING_RATE 10
+/* Maximum number of full thread buffers waiting for the flusher thread */
+#define J9JFR_MAX_FULL_BUFFERS 32
+#define J9JFR_ALLOCATION_SAMPLE_WINDOW J9CONST64(1000000000)
 
 /* Value needs to be the same as jdk.jfr.internal.JVM.RESERVED_CLASS_ID_LIMIT. */
 #define RESERVED_CLASS_ID_LIMIT 500
@@ -62,8 +66,11 @@ typedef struct J9JFRTypeID {
 #define STACKTRACE_TYPE_ID 9
 
 static void jfrStartSamplingThread(J9JavaVM *vm);
+static void jfrStartFlusherThread(J9JavaVM *vm);
+static bool flushFullBuffersToGlobal(J9VMThread *currentThread);
 static void initializeEventFields(J9VMThread *currentThread, J9JFREvent *jfrEvent, UDATA eventType);
 static int J9THREAD_PROC jfrSamplingThreadProc(void *entryArg);
+static int J9THREAD_PROC jfrFlusherThreadProc(void *entryArg);
 static void jfrExecutionSampleCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
 static void jfrThreadCPULoadCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
 
@@ -130,6 +137,9 @@ jfrEventSize(J9JFREvent *jfrEvent)
 	case J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY:
 		size = sizeof(J9JFRGCHeapSummary);
 		break;
+	case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+		size = sizeof(J9JFRObjectAllocationSample) + (((J9JFRObjectAllocationSample *)jfrEvent)->stackTraceSize * sizeof(UDATA));
+		break;
 	default:
 		Assert_VM_unreachable();
 		break;
@@ -167,6 +177,76 @@ jfrBufferNextDo(J9JFRBufferWalkState *walkState)
 	return (J9JFREvent*)next;
 }
 
+/**
+ * Allocate a thread local buffer, preceded by its J9JFRBufferHeader.
+ *
+ * @param vm[in] the J9JavaVM
+ *
+ * @returns pointer to the start of the event space or NULL if the buffer could not be allocated
+ */
+static U_8*
+allocateThreadBuffer(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_8 *buffer = NULL;
+	J9JFRBufferHeader *header = (J9JFRBufferHeader *)j9mem_allocate_memory(sizeof(J9JFRBufferHeader) + J9JFR_THREAD_BUFFER_SIZE, J9MEM_CATEGORY_JFR);
+	if (NULL != header) {
+		buffer = (U_8 *)(header + 1);
+#if defined(DEBUG)
+		memset(buffer, 0, J9JFR_THREAD_BUFFER_SIZE);
+#endif /* defined(DEBUG) */
+	}
+	return buffer;
+}
+
+/**
+ * Free a thread local buffer allocated by allocateThreadBuffer.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param buffer[in] the start of the event space of the buffer, may be NULL
+ */
+static void
+freeThreadBuffer(J9JavaVM *vm, U_8 *buffer)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	if (NULL != buffer) {
+		j9mem_free_memory((void *)(((J9JFRBufferHeader *)buffer) - 1));
+	}
+}
+
+/**
+ * Make an empty buffer the local buffer of a thread.
+ *
+ * @param thread[in] the J9VMThread
+ * @param buffer[in] the start of the event space of the buffer
+ */
+static void
+setThreadBuffer(J9VMThread *thread, U_8 *buffer)
+{
+	thread->jfrBuffer.bufferStart = buffer;
+	thread->jfrBuffer.bufferCurrent = buffer;
+	thread->jfrBuffer.bufferSize = J9JFR_THREAD_BUFFER_SIZE;
+	thread->jfrBuffer.bufferRemaining = J9JFR_THREAD_BUFFER_SIZE;
+}
+
+/**
+ * Free the local and spare buffers of a thread.
+ *
+ * The thread must be the current thread or be paused, and must not
+ * have any buffer waiting for the flusher thread.
+ *
+ * @param thread[in] the J9VMThread
+ */
+static void
+freeThreadBuffers(J9VMThread *thread)
+{
+	J9JavaVM *vm = thread->javaVM;
+	freeThreadBuffer(vm, thread->jfrBuffer.bufferStart);
+	memset(&thread->jfrBuffer, 0, sizeof(thread->jfrBuffer));
+	freeThreadBuffer(vm, thread->jfrSpareBuffer);
+	thread->jfrSpareBuffer = NULL;
+}
+
 static bool
 areJFRBuffersReadyForWrite(J9VMThread *currentThread)
 {
@@ -270,6 +350,145 @@ done:
 	return success;
 }
 
+/**
+ * Hand the full local buffer of a thread off to the flusher thread and continue
+ * with the spare buffer of the thread, or with a new buffer if the flusher thread
+ * has not returned the spare one yet. This never waits for the flusher thread.
+ *
+ * If the flusher thread is not running, J9JFR_MAX_FULL_BUFFERS buffers are
+ * already waiting for it or a new buffer cannot be allocated, the buffers
+ * waiting and then the local buffer are copied to the global buffer by this
+ * thread instead.
+ *
+ * The bufferThread parameter must be either the current thread or be
+ * paused (e.g. by exclusive VM access).
+ *
+ * @param bufferThread[in] the J9VMThread whose buffer is full
+ *
+ * @returns true on success, false if the buffer could not be flushed
+ */
+static bool
+handOffThreadBuffer(J9VMThread *bufferThread)
+{
+	J9JavaVM *vm = bufferThread->javaVM;
+	J9JFRBufferHeader *header = ((J9JFRBufferHeader *)bufferThread->jfrBuffer.bufferStart) - 1;
+	J9JFRBufferHeader *head = NULL;
+	U_8 *newBuffer = NULL;
+	bool success = true;
+
+	if (J9JFR_SAMPLER_STATE_RUNNING == vm->jfrFlusherState) {
+		if (VM_AtomicSupport::add(&vm->jfrFullBufferCount, 1) <= J9JFR_MAX_FULL_BUFFERS) {
+			newBuffer = bufferThread->jfrSpareBuffer;
+			if (NULL != newBuffer) {
+				/* The flusher thread only returns a buffer while there is no spare. */
+				bufferThread->jfrSpareBuffer = NULL;
+			} else {
+				newBuffer = allocateThreadBuffer(vm);
+			}
+		}
+		if (NULL == newBuffer) {
+			VM_AtomicSupport::subtract(&vm->jfrFullBufferCount, 1);
+		}
+	}
+
+	if (NULL == newBuffer) {
+		/* Buffers already handed off hold older events than this one. */
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		success = flushFullBuffersToGlobal(bufferThread);
+		if (!flushBufferToGlobal(bufferThread, bufferThread)) {
+			success = false;
+		}
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+		goto done;
+	}
+
+	header->owner = bufferThread;
+	header->size = bufferThread->jfrBuffer.bufferCurrent - bufferThread->jfrBuffer.bufferStart;
+	do {
+		head = vm->jfrFullBuffers;
+		header->next = head;
+	} while ((UDATA)head != VM_AtomicSupport::lockCompareExchange((UDATA *)&vm->jfrFullBuffers, (UDATA)head, (UDATA)header));
+
+	setThreadBuffer(bufferThread, newBuffer);
+
+	/* The flusher thread drains the whole list, so it only needs waking for the first buffer. */
+	if (NULL == head) {
+		omrthread_monitor_enter(vm->jfrFlusherMutex);
+		omrthread_monitor_notify(vm->jfrFlusherMutex);
+		omrthread_monitor_exit(vm->jfrFlusherMutex);
+	}
+
+done:
+	return success;
+}
+
+/**
+ * Copy the buffers handed off by handOffThreadBuffer to the global buffer,
+ * in the order they were handed off, and return them to their threads.
+ *
+ * The current thread must hold the jfrBufferMutex and VM access (so that
+ * the owners of the buffers cannot exit), or have exclusive VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ *
+ * @returns true on success, false on failure
+ */
+static bool
+flushFullBuffersToGlobal(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9JFRBufferHeader *list = NULL;
+	J9JFRBufferHeader *reversed = NULL;
+	bool ready = vm->jfrState.isStarted && (NULL != vm->jfrBuffer.bufferCurrent);
+	bool success = true;
+
+	/* Detach the whole list; producers only ever push, so this is not subject to ABA. */
+	do {
+		list = vm->jfrFullBuffers;
+		if (NULL == list) {
+			goto done;
+		}
+	} while ((UDATA)list != VM_AtomicSupport::lockCompareExchange((UDATA *)&vm->jfrFullBuffers, (UDATA)list, 0));
+
+	while (NULL != list) {
+		J9JFRBufferHeader *next = list->next;
+		list->next = reversed;
+		reversed = list;
+		list = next;
+		VM_AtomicSupport::subtract(&vm->jfrFullBufferCount, 1);
+	}
+
+	while (NULL != reversed) {
+		J9JFRBufferHeader *header = reversed;
+		U_8 *buffer = (U_8 *)(header + 1);
+		UDATA bufferSize = (UDATA)header->size;
+		reversed = header->next;
+
+		if (ready) {
+			if (vm->jfrBuffer.bufferRemaining < bufferSize) {
+				if (!writeOutGlobalBuffer(currentThread, false, false)) {
+					success = false;
+				}
+			}
+			memcpy(vm->jfrBuffer.bufferCurrent, buffer, bufferSize);
+			vm->jfrBuffer.bufferCurrent += bufferSize;
+			vm->jfrBuffer.bufferRemaining -= bufferSize;
+		}
+
+#if defined(DEBUG)
+		memset(buffer, 0, J9JFR_THREAD_BUFFER_SIZE);
+#endif /* defined(DEBUG) */
+
+		/* Keep the buffer as the spare of its thread, unless the thread already has one. */
+		if (0 != VM_AtomicSupport::lockCompareExchange((UDATA *)&header->owner->jfrSpareBuffer, 0, (UDATA)buffer)) {
+			freeThreadBuffer(vm, buffer);
+		}
+	}
+
+done:
+	return success;
+}
+
 /**
  * Flush all thread local buffers to the global buffer.
  *
@@ -283,7 +502,6 @@ done:
 static bool
 flushAllThreadBuffers(J9VMThread *currentThread, bool freeBuffers)
 {
-	PORT_ACCESS_FROM_VMC(currentThread);
 	J9JavaVM *vm = currentThread->javaVM;
 	J9VMThread *loopThread = vm->mainThread;
 	bool allSucceeded = true;
@@ -293,13 +511,17 @@ flushAllThreadBuffers(J9VMThread *currentThread, bool freeBuffers)
 	Assert_VM_true(currentThread->omrVMThread->exclusiveCount > 0);
 	Assert_VM_true((J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState) || (J9_XACCESS_EXCLUSIVE == vm->safePointState));
 
+	/* Buffers handed off to the flusher thread hold older events than the local buffers. */
+	if (!flushFullBuffersToGlobal(currentThread)) {
+		allSucceeded = false;
+	}
+
 	do {
 		if (!flushBufferToGlobal(currentThread, loopThread)) {
 			allSucceeded = false;
 		}
 		if (freeBuffers) {
-			j9mem_free_memory((void*)loopThread->jfrBuffer.bufferStart);
-			memset(&loopThread->jfrBuffer, 0, sizeof(loopThread->jfrBuffer));
+			freeThreadBuffers(loopThread);
 		}
 
 		if (loopThread == currentThread) {
@@ -315,8 +537,7 @@ flushAllThreadBuffers(J9VMThread *currentThread, bool freeBuffers)
 			allSucceeded = false;
 		}
 		if (freeBuffers) {
-			j9mem_free_memory((void*)currentThread->jfrBuffer.bufferStart);
-			memset(&currentThread->jfrBuffer, 0, sizeof(currentThread->jfrBuffer));
+			freeThreadBuffers(currentThread);
 		}
 	}
 
@@ -347,9 +568,9 @@ reserveBuffer(J9VMThread *currentThread, UDATA size)
 
 	/* If the event is larger than the buffer, fail without attemptiong to flush */
 	if (size <= currentThread->jfrBuffer.bufferSize) {
-		/* If there isn't enough space, flush the thread buffer to global */
+		/* If there isn't enough space, hand the thread buffer off to the flusher thread */
 		if (size > currentThread->jfrBuffer.bufferRemaining) {
-			if (!flushBufferToGlobal(currentThread, currentThread)) {
+			if (!handOffThreadBuffer(currentThread)) {
 				goto done;
 			}
 		}
@@ -412,24 +633,18 @@ jfrThreadCreated(J9HookInterface **hook, UDATA eventNum, void *eventData, void *
 {
 	J9VMThreadCreatedEvent *event = (J9VMThreadCreatedEvent *)eventData;
 	J9VMThread *currentThread = event->vmThread;
-	PORT_ACCESS_FROM_VMC(currentThread);
 
 #if defined(DEBUG)
+	PORT_ACCESS_FROM_VMC(currentThread);
 	j9tty_printf(PORTLIB, "\n!!! thread created  %p\n", currentThread);
 #endif /* defined(DEBUG) */
 
 	/* TODO: allow different buffer sizes on different threads. */
-	U_8 *buffer = (U_8 *)j9mem_allocate_memory(J9JFR_THREAD_BUFFER_SIZE, J9MEM_CATEGORY_JFR);
+	U_8 *buffer = allocateThreadBuffer(currentThread->javaVM);
 	if (NULL == buffer) {
 		event->continueInitialization = FALSE;
 	} else {
-		currentThread->jfrBuffer.bufferStart = buffer;
-		currentThread->jfrBuffer.bufferCurrent = buffer;
-		currentThread->jfrBuffer.bufferSize = J9JFR_THREAD_BUFFER_SIZE;
-		currentThread->jfrBuffer.bufferRemaining = J9JFR_THREAD_BUFFER_SIZE;
-#if defined(DEBUG)
-		memset(currentThread->jfrBuffer.bufferStart, 0, J9JFR_THREAD_BUFFER_SIZE);
-#endif /* defined(DEBUG) */
+		setThreadBuffer(currentThread, buffer);
 	}
 }
 
@@ -557,14 +772,12 @@ jfrThreadEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *user
 	if (NULL != jfrEvent) {
 		initializeEventFields(currentThread, jfrEvent, J9JFR_EVENT_TYPE_THREAD_END);
 	}
-	PORT_ACCESS_FROM_VMC(currentThread);
 	acquireExclusiveVMAccess(currentThread);
 	flushAllThreadBuffers(currentThread, false);
 	writeOutGlobalBuffer(currentThread, false, false);
 
-	/* Free the thread local buffer */
-	j9mem_free_memory((void*)currentThread->jfrBuffer.bufferStart);
-	memset(&currentThread->jfrBuffer, 0, sizeof(currentThread->jfrBuffer));
+	/* Free the thread local buffers */
+	freeThreadBuffers(currentThread);
 	releaseExclusiveVMAccess(currentThread);
 	internalReleaseVMAccess(currentThread);
 }
@@ -616,6 +829,7 @@ jfrVMInitialized(J9HookInterface **hook, UDATA eventNum, void *eventData, void *
 	j9tty_printf(PORTLIB, "\n!!! VM init %p\n", currentThread);
 #endif /* defined(DEBUG) */
 	jfrStartSamplingThread(currentThread->javaVM);
+	jfrStartFlusherThread(currentThread->javaVM);
 }
 
 /**
@@ -640,6 +854,27 @@ jfrStartSamplingThread(J9JavaVM *vm)
 	}
 }
 
+/**
+ * Start JFR flusher thread. Called without VM access.
+ *
+ * @param vm[in] pointer to the J9JavaVM
+ */
+static void
+jfrStartFlusherThread(J9JavaVM *vm)
+{
+	IDATA rc = omrthread_create(&(vm->jfrFlusherThread), vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, jfrFlusherThreadProc, (void*)vm);
+	if (0 == rc) {
+		omrthread_monitor_enter(vm->jfrFlusherMutex);
+		while (J9JFR_SAMPLER_STATE_UNINITIALIZED == vm->jfrFlusherState) {
+			omrthread_monitor_wait(vm->jfrFlusherMutex);
+		}
+		omrthread_monitor_exit(vm->jfrFlusherMutex);
+		Trc_VM_jfrStartFlusherThread_jfrFlusherState(vm->jfrFlusherState);
+	} else {
+		Trc_VM_jfrStartFlusherThread_omrthread_create_failed(rc);
+	}
+}
+
 /**
  * Hook for VM monitor waited. Called without VM access.
  *
@@ -811,6 +1046,63 @@ jfrYoungGarbageCollection(J9HookInterface **hook, UDATA eventNum, void *eventDat
 	}
 }
 
+/**
+ * Hook for sampled object allocation. Called with VM access.
+ *
+ * Samples are throttled to at most allocationSampleRate events per second across all threads.
+ * The weight of an emitted sample is the number of bytes the thread allocated since its last
+ * emitted sample, so dropped samples are still accounted for.
+ *
+ * @param hook[in] the GC hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrObjectAllocationSampling(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSamplingEvent *event = (MM_ObjectAllocationSamplingEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_64 window = ((U_64)j9time_nano_time() / J9JFR_ALLOCATION_SAMPLE_WINDOW) << 32;
+	U_64 oldState = 0;
+	U_64 newState = 0;
+
+	/* The weight of a sample is every byte allocated by the thread since its previous sample, including
+	 * the events of other requesters and those dropped by the throttle.
+	 */
+	currentThread->jfrAllocationSampleBytes += event->allocatedBytes;
+
+	if (J9_ARE_NO_BITS_SET(event->requesters, (UDATA)1 << J9_GC_ALLOCATION_SAMPLING_REQUESTER_JFR)) {
+		return;
+	}
+
+	/* The window and the count of samples emitted in it share one word, so that moving to
+	 * a new window and counting the first sample in it is a single atomic step.
+	 */
+	do {
+		U_64 count = 0;
+		oldState = vm->jfrState.allocationSampleWindow;
+		/* A thread that read the clock before another moved the window on counts in the newer window. */
+		if (window <= (oldState & J9CONST64(0xFFFFFFFF00000000))) {
+			window = oldState & J9CONST64(0xFFFFFFFF00000000);
+			count = oldState & J9CONST64(0xFFFFFFFF);
+		}
+		if ((count >= vm->jfrState.allocationSampleRate) || (J9CONST64(0xFFFFFFFF) == count)) {
+			return;
+		}
+		newState = window | (count + 1);
+	} while (oldState != VM_AtomicSupport::lockCompareExchangeU64(&vm->jfrState.allocationSampleWindow, oldState, newState));
+
+	J9JFRObjectAllocationSample *jfrEvent = (J9JFRObjectAllocationSample *)reserveBufferWithStackTrace(currentThread, currentThread, J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE, sizeof(*jfrEvent));
+	if (NULL != jfrEvent) {
+		jfrEvent->objectClass = event->clazz;
+		jfrEvent->weight = currentThread->jfrAllocationSampleBytes;
+		currentThread->jfrAllocationSampleBytes = 0;
+	}
+}
+
 jint
 initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 {
@@ -818,6 +1110,7 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	OMRPORT_ACCESS_FROM_J9PORT(PORTLIB);
 	jint rc = JNI_ERR;
 	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
 	J9HookInterface **gcOmrHooks = vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
 	U_8 *buffer = NULL;
 	UDATA timeSuccess = 0;
@@ -926,6 +1219,9 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	if (omrthread_monitor_init_with_name(&vm->jfrSamplerMutex, 0, "JFR sampler mutex")) {
 		goto fail;
 	}
+	if (omrthread_monitor_init_with_name(&vm->jfrFlusherMutex, 0, "JFR flusher mutex")) {
+		goto fail;
+	}
 	if (omrthread_monitor_init_with_name(&vm->jfrState.isConstantEventsInitializedMutex, 0, "Is JFR constantEvents initialized mutex")) {
 		goto fail;
 	}
@@ -940,14 +1236,11 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 		while (NULL != walkThread) {
 			/* only initialize a thread once */
 			if (NULL == walkThread->jfrBuffer.bufferStart) {
-				U_8 *buffer = (U_8 *)j9mem_allocate_memory(J9JFR_THREAD_BUFFER_SIZE, J9MEM_CATEGORY_JFR);
+				U_8 *buffer = allocateThreadBuffer(vm);
 				if (NULL == buffer) {
 					goto fail;
 				} else {
-					walkThread->jfrBuffer.bufferStart = buffer;
-					walkThread->jfrBuffer.bufferCurrent = buffer;
-					walkThread->jfrBuffer.bufferSize = J9JFR_THREAD_BUFFER_SIZE;
-					walkThread->jfrBuffer.bufferRemaining = J9JFR_THREAD_BUFFER_SIZE;
+					setThreadBuffer(walkThread, buffer);
 				}
 			}
 
@@ -955,6 +1248,17 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 		}
 
 		jfrStartSamplingThread(vm);
+		jfrStartFlusherThread(vm);
+	}
+
+	if (0 != vm->jfrState.allocationSampleRate) {
+		/* The hook can only be registered if it was reserved during startup, so failing to register is not fatal. */
+		if (0 == (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSampling, OMR_GET_CALLSITE(), NULL)) {
+			vm->jfrState.allocationSampleWindow = 0;
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JFR, vm->jfrState.allocationSamplingInterval);
+		} else {
+			Trc_VM_initializeJFR_allocationSamplingUnavailable();
+		}
 	}
 
 done:
@@ -972,6 +1276,7 @@ tearDownJFR(J9JavaVM *vm)
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	J9VMThread *currentThread = currentVMThread(vm);
 	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
 	J9HookInterface **gcOmrHooks = vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
 
 	Assert_VM_mustHaveVMAccess(currentThread);
@@ -993,10 +1298,34 @@ tearDownJFR(J9JavaVM *vm)
 		vm->jfrSamplerMutex = NULL;
 	}
 
+	/* Stop the flusher thread */
+	if (NULL != vm->jfrFlusherMutex) {
+		omrthread_monitor_enter(vm->jfrFlusherMutex);
+		if (J9JFR_SAMPLER_STATE_RUNNING == vm->jfrFlusherState) {
+			vm->jfrFlusherState = J9JFR_SAMPLER_STATE_STOP;
+			omrthread_monitor_notify_all(vm->jfrFlusherMutex);
+			while (J9JFR_SAMPLER_STATE_DEAD != vm->jfrFlusherState) {
+				omrthread_monitor_wait(vm->jfrFlusherMutex);
+			}
+		}
+		omrthread_monitor_exit(vm->jfrFlusherMutex);
+		omrthread_monitor_destroy(vm->jfrFlusherMutex);
+		vm->jfrFlusherMutex = NULL;
+	}
+
 	internalAcquireVMAccess(currentThread);
 
 	vm->jfrState.isStarted = FALSE;
 	vm->jfrSamplerState = J9JFR_SAMPLER_STATE_UNINITIALIZED;
+	vm->jfrFlusherState = J9JFR_SAMPLER_STATE_UNINITIALIZED;
+
+	/* Free any buffer still waiting for the flusher thread */
+	while (NULL != vm->jfrFullBuffers) {
+		J9JFRBufferHeader *header = vm->jfrFullBuffers;
+		vm->jfrFullBuffers = header->next;
+		freeThreadBuffer(vm, (U_8 *)(header + 1));
+	}
+	vm->jfrFullBufferCount = 0;
 
 	VM_JFRWriter::teardownJFRWriter(vm);
 
@@ -1015,6 +1344,10 @@ tearDownJFR(J9JavaVM *vm)
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_SYSTEM_GC_CALLED, jfrSystemGC, NULL);
 	(*gcOmrHooks)->J9HookUnregister(gcOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_END, jfrOldGarbageCollection, NULL);
 	(*gcOmrHooks)->J9HookUnregister(gcOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_END, jfrYoungGarbageCollection, NULL);
+	if (0 != vm->jfrState.allocationSampleRate) {
+		(*gcHooks)->J9HookUnregister(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSampling, NULL);
+		vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9_GC_ALLOCATION_SAMPLING_REQUESTER_JFR, UDATA_MAX);
+	}
 
 	/* Free global data */
 	VM_JFRConstantPoolTypes::freeJFRConstantEvents(vm);
@@ -1277,6 +1610,49 @@ jfrSamplingThreadProc(void *entryArg)
 	return 0;
 }
 
+/**
+ * Copy the buffers handed off by the application threads to the global buffer
+ * as they arrive, writing out the global buffer to the file when it is full.
+ * Serialization and file I/O thus happen on this thread rather than on the
+ * threads emitting the events. The thread sleeps until handOffThreadBuffer
+ * notifies it, and drains any remaining buffer before stopping.
+ */
+static int J9THREAD_PROC
+jfrFlusherThreadProc(void *entryArg)
+{
+	J9JavaVM *vm = (J9JavaVM*)entryArg;
+	J9VMThread *currentThread = NULL;
+
+	if (JNI_OK == attachSystemDaemonThread(vm, &currentThread, "JFR flusher")) {
+		omrthread_monitor_enter(vm->jfrFlusherMutex);
+		vm->jfrFlusherState = J9JFR_SAMPLER_STATE_RUNNING;
+		omrthread_monitor_notify_all(vm->jfrFlusherMutex);
+		for (;;) {
+			if (NULL != vm->jfrFullBuffers) {
+				omrthread_monitor_exit(vm->jfrFlusherMutex);
+				internalAcquireVMAccess(currentThread);
+				omrthread_monitor_enter(vm->jfrBufferMutex);
+				flushFullBuffersToGlobal(currentThread);
+				omrthread_monitor_exit(vm->jfrBufferMutex);
+				internalReleaseVMAccess(currentThread);
+				omrthread_monitor_enter(vm->jfrFlusherMutex);
+			} else if (J9JFR_SAMPLER_STATE_STOP == vm->jfrFlusherState) {
+				break;
+			} else {
+				omrthread_monitor_wait(vm->jfrFlusherMutex);
+			}
+		}
+		omrthread_monitor_exit(vm->jfrFlusherMutex);
+		DetachCurrentThread((JavaVM*)vm);
+	}
+
+	omrthread_monitor_enter(vm->jfrFlusherMutex);
+	vm->jfrFlusherState = J9JFR_SAMPLER_STATE_DEAD;
+	omrthread_monitor_notify_all(vm->jfrFlusherMutex);
+	omrthread_exit(vm->jfrFlusherMutex);
+	return 0;
+}
+
 jboolean
 setJFRRecordingFileName(J9JavaVM *vm, char *newFileName)
 {
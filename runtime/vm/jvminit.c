@@ -785,6 +785,7 @@ freeJavaVM(J9JavaVM * vm)
 	if (!IS_SNAPSHOTTING_ENABLED(vm)) {
 		freeHiddenInstanceFieldsList(vm);
 	}
+	freeFieldLayoutHints(vm);
 	cleanupLockwordConfig(vm);
 	cleanupEnsureHashedConfig(vm);
 
@@ -930,6 +931,8 @@ freeJavaVM(J9JavaVM * vm)
 	}
 #endif
 
+	freeDecodedFrameCache(vm);
+
 	shutdownVMHookInterface(vm);
 
 	freeSystemProperties(vm);
@@ -2827,6 +2830,10 @@ VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved)
 				(*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_SHUTTING_DOWN, dumpLoadedClassList, OMR_GET_CALLSITE(), optionValue);
 			}
 
+			if (0 != initializeFieldLayoutHints(vm)) {
+				goto _error;
+			}
+
 #if defined(AIXPPC)
 			if (FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXSETHWPREFETCH_NONE, NULL) >= 0) {
 				vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_SET_HW_PREFETCH;
@@ -3070,6 +3077,11 @@ VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved)
 				vm->j9ras
 			);
 
+			/* FastClassHashTable is resolved with the VM options, before this module is registered with trace */
+			if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)) {
+				Trc_VM_VMPhases_FastClassHashTable_Enabled();
+			}
+
 #if defined(OMR_THR_YIELD_ALG) && defined(LINUX)
 			Trc_VM_yieldAlgorithmSelected(vm->mainThread, j9util_sched_compat_yield_value(vm), **(UDATA**)omrthread_global("yieldAlgorithm"), **(UDATA**)omrthread_global("yieldUsleepMultiplier"));
 #endif /* defined(OMR_THR_YIELD_ALG) && defined(LINUX) */
@@ -3141,6 +3153,18 @@ VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved)
 				vm->requiredDebugAttributes |= J9VM_DEBUG_ATTRIBUTE_MAINTAIN_ORIGINAL_METHOD_ORDER;
 			}
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
+#if defined(J9VM_OPT_JFR)
+			/* The allocation sampling hook is disabled once the VM bootstraps unless it has been reserved,
+			 * so reserve it now if a recording was requested on the command line.
+			 */
+			if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_JFR_ENABLED)
+				&& (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_START_FLIGHT_RECORDING) || (NULL != vm->jfrState.jfrCMDLineOption))
+				&& (0 != vm->jfrState.allocationSampleRate)
+			) {
+				J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+				(*gcHooks)->J9HookReserve(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING);
+			}
+#endif /* defined(J9VM_OPT_JFR) */
 			TRIGGER_J9HOOK_VM_ABOUT_TO_BOOTSTRAP(vm->hookInterface, vm->mainThread);
 			/* At this point, the decision about which interpreter to use has been made */
 
@@ -3942,6 +3966,12 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		} else if (fastClassHashTable < noFastClassHashTable) {
 			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE;
 		}
+		/* No class loader exists yet, so every class hash table is created non-growable and
+		 * lookups of loaded classes can be done without the classTableMutex from the start.
+		 */
+		if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE)) {
+			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE;
+		}
 	}
 
 #if (JAVA_SPEC_VERSION <= 19)
@@ -4329,6 +4359,52 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		/* Map cached zip files (e.g. the bootstrap and shared classes class path) instead of reading them */
+		IDATA enableMapZipFiles = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXENABLEMAPZIPFILES, NULL);
+		IDATA disableMapZipFiles = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXDISABLEMAPZIPFILES, NULL);
+		if (enableMapZipFiles > disableMapZipFiles) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES;
+		} else if (enableMapZipFiles < disableMapZipFiles) {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES;
+		}
+	}
+
+#if JAVA_SPEC_VERSION >= 19
+	{
+		/* Give back the stack memory of parked virtual threads that only needed it transiently */
+		IDATA enableTrimStacks = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXTRIMCONTINUATIONSTACKS, NULL);
+		IDATA disableTrimStacks = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOTRIMCONTINUATIONSTACKS, NULL);
+		if (enableTrimStacks > disableTrimStacks) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_TRIM_CONTINUATION_STACKS;
+		} else if (enableTrimStacks < disableTrimStacks) {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_TRIM_CONTINUATION_STACKS;
+		}
+	}
+#endif /* JAVA_SPEC_VERSION >= 19 */
+
+	{
+		/* Lay out instance fields using hot field hints recorded in the shared classes cache by earlier runs */
+		IDATA enableFieldLayoutHints = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXPROFILEGUIDEDFIELDLAYOUT, NULL);
+		IDATA disableFieldLayoutHints = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOPROFILEGUIDEDFIELDLAYOUT, NULL);
+		if (enableFieldLayoutHints > disableFieldLayoutHints) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_PROFILE_GUIDED_FIELD_LAYOUT;
+		} else if (enableFieldLayoutHints < disableFieldLayoutHints) {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_PROFILE_GUIDED_FIELD_LAYOUT;
+		}
+	}
+
+	{
+		/* Share decoded walkback PCs between exception stack traces, StackWalker and JFR; enabled by default */
+		IDATA enableDecodedFrameCache = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXDECODEDFRAMECACHE, NULL);
+		IDATA disableDecodedFrameCache = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNODECODEDFRAMECACHE, NULL);
+		if (enableDecodedFrameCache >= disableDecodedFrameCache) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_DECODED_FRAME_CACHE;
+		} else {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_DECODED_FRAME_CACHE;
+		}
+	}
+
 	/* -Xbootclasspath and -Xbootclasspath/p are not supported from Java 9 onwards */
 	if (J2SE_VERSION(vm) >= J2SE_V11) {
 		PORT_ACCESS_FROM_JAVAVM(vm);
@@ -4533,6 +4609,47 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 			}
 		}
 	}
+	{
+		IDATA argIndex = FIND_AND_CONSUME_VMARG(STARTSWITH_MATCH, VMOPT_XXJFRALLOCATIONSAMPLINGINTERVAL_EQUALS, NULL);
+		if (argIndex >= 0) {
+			UDATA value = 0;
+			char *optname = VMOPT_XXJFRALLOCATIONSAMPLINGINTERVAL_EQUALS;
+
+			IDATA parseError = GET_MEMORY_VALUE(argIndex, optname, value);
+			if ((OPTION_OK != parseError) || (0 == value)) {
+				PORT_ACCESS_FROM_JAVAVM(vm);
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_INVALID_CMD_LINE_OPT, VMOPT_XXJFRALLOCATIONSAMPLINGINTERVAL_EQUALS);
+				return JNI_ERR;
+			}
+
+			vm->jfrState.allocationSamplingInterval = value;
+		} else {
+#define DEFAULT_JFR_ALLOCATION_SAMPLING_INTERVAL (512 * 1024)
+			/* Check for an allocation sample every 512KB allocated by a thread, the same default as JVMTI. */
+			vm->jfrState.allocationSamplingInterval = DEFAULT_JFR_ALLOCATION_SAMPLING_INTERVAL;
+		}
+	}
+	{
+		IDATA argIndex = FIND_AND_CONSUME_VMARG(STARTSWITH_MATCH, VMOPT_XXJFRALLOCATIONSAMPLERATE_EQUALS, NULL);
+		if (argIndex >= 0) {
+			UDATA value = 0;
+			char *optname = VMOPT_XXJFRALLOCATIONSAMPLERATE_EQUALS;
+
+			IDATA parseError = GET_INTEGER_VALUE(argIndex, optname, value);
+			if (OPTION_OK != parseError) {
+				PORT_ACCESS_FROM_JAVAVM(vm);
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_INVALID_CMD_LINE_OPT, VMOPT_XXJFRALLOCATIONSAMPLERATE_EQUALS);
+				return JNI_ERR;
+			}
+
+			/* A rate of 0 disables the ObjectAllocationSample event. */
+			vm->jfrState.allocationSampleRate = value;
+		} else {
+#define DEFAULT_JFR_ALLOCATION_SAMPLE_RATE 150
+			/* Emit at most 150 allocation samples per second, matching the default JFR throttle. */
+			vm->jfrState.allocationSampleRate = DEFAULT_JFR_ALLOCATION_SAMPLE_RATE;
+		}
+	}
 #endif /* defined(J9VM_OPT_JFR) */
 
 #if JAVA_SPEC_VERSION >= 24
@@ -7801,6 +7918,12 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 	}
 #endif
 
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_DECODED_FRAME_CACHE)) {
+		if (0 != initializeDecodedFrameCache(vm)) {
+			goto error;
+		}
+	}
+
 #ifdef J9VM_OPT_ZIP_SUPPORT
 	if (NULL == vm->zipCachePool) {
 		vm->zipCachePool = zipCachePool_new(portLibrary, vm);
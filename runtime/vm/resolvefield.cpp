@@ -32,6 +32,8 @@
 #include "ObjectFieldInfo.hpp"
 #include "util_api.h"
 #include "vm_api.h"
+#include "SCQueryFunctions.h"
+#include "AtomicSupport.hpp"
 
 /* Extra hidden fields are lockword and finalizeLink. */
 #define NUMBER_OF_EXTRA_HIDDEN_FIELDS 2
@@ -61,6 +63,18 @@ static J9ROMFieldShape* findFieldInTable(J9VMThread *vmThread, J9Class *clazz, U
 
 #define SUPERCLASS(clazz) (((clazz)->superclasses[ J9CLASS_DEPTH(clazz) - 1 ]))
 
+#define FIELD_LAYOUT_HINT_KEY_PREFIX "J9FieldLayout:"
+#define FIELD_LAYOUT_HINT_KEY_MAX 256
+#define FIELD_LAYOUT_HINTS_INITIAL_TABLE_SIZE 64
+
+/* Field layout hint waiting to be stored into the shared classes cache, followed by the J9FieldLayoutHint */
+typedef struct J9PendingFieldLayoutHint {
+	struct J9PendingFieldLayoutHint *next;
+	UDATA keyLength;
+	UDATA hintSize;
+	char key[FIELD_LAYOUT_HINT_KEY_MAX];
+} J9PendingFieldLayoutHint;
+
 static J9ROMFieldShape * findFieldInClass (J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, UDATA *offsetOrAddress, J9Class **definingClass);
 static J9ROMFieldShape* findFieldAndCheckVisibility (J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9Class **definingClass, UDATA *offsetOrAddress, UDATA options, J9Class *sourceClass);
 static J9ROMFieldShape* findField (J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9Class **definingClass, UDATA *offsetOrAddress, UDATA options);
@@ -74,6 +88,8 @@ static J9ROMFieldShape *allocAndInitFakeJ9ROMFieldShape(J9JavaVM *vm, const char
 VMINLINE static J9HiddenInstanceField *initJ9HiddenField(J9HiddenInstanceField *field, J9UTF8 *classNameUTF8, J9ROMFieldShape *shape, UDATA *offsetReturn, J9HiddenInstanceField *next);
 
 static void fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field);
+static void initializeFieldLayoutHint(J9ROMFieldOffsetWalkState *state);
+static VMINLINE U_32 fieldLayoutPosition(J9ROMFieldOffsetWalkState *state, U_32 seen, U_32 *hotSeen, U_32 hotCount);
 
 /* Methods for managing hot fields when scavenger DynamicBreadthFirstScanOrdering is enabled */
 VMINLINE bool createClassLoaderHotFieldPool(J9JavaVM *javaVM, J9ClassLoader* classLoader);
@@ -842,6 +858,458 @@ releaseMutex:
 	}
 }
 
+/**
+ * Hash function for the field layout hint table, keyed by ROM class.
+ * @param key table entry
+ * @param userData not used
+ */
+static UDATA
+fieldLayoutHintHashFn(void *key, void *userData)
+{
+	return (UDATA)((J9FieldLayoutHintEntry *)key)->romClass;
+}
+
+/**
+ * Compare two field layout hint table entries for equality.
+ * @param leftKey table entry
+ * @param rightKey table entry
+ * @param userData not used
+ */
+static UDATA
+fieldLayoutHintHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	return ((J9FieldLayoutHintEntry *)leftKey)->romClass == ((J9FieldLayoutHintEntry *)rightKey)->romClass;
+}
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+ * Build the shared classes cache key under which the field layout hint for a class is stored.
+ *
+ * @param romClass[in] the ROM class
+ * @param key[out] buffer of FIELD_LAYOUT_HINT_KEY_MAX bytes receiving the key
+ * @return the length of the key, or 0 if the class name is too long to be keyed
+ */
+static UDATA
+buildFieldLayoutHintKey(J9ROMClass *romClass, char *key)
+{
+	J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+	UDATA prefixLength = LITERAL_STRLEN(FIELD_LAYOUT_HINT_KEY_PREFIX);
+	UDATA keyLength = prefixLength + J9UTF8_LENGTH(className);
+
+	if (keyLength > FIELD_LAYOUT_HINT_KEY_MAX) {
+		keyLength = 0;
+	} else {
+		memcpy(key, FIELD_LAYOUT_HINT_KEY_PREFIX, prefixLength);
+		memcpy(key + prefixLength, J9UTF8_DATA(className), J9UTF8_LENGTH(className));
+	}
+	return keyLength;
+}
+
+/**
+ * Record the hot instance fields of a class as a field layout hint, in terms of ROM field indices.
+ * The JIT reports hot fields as reference-sized slot offsets from the start of the object, and only
+ * for reference fields, so only the reference fields at exactly those offsets are marked hot.
+ * Must be called with VM access.
+ *
+ * @param vm[in] pointer to the J9JavaVM
+ * @param clazz[in] the class, which has hot field information
+ * @param hint[out] the hint to fill in, J9FIELDLAYOUTHINT_SIZE(clazz->romClass->romFieldCount) bytes
+ * @return true if any hot field was found
+ */
+static bool
+fillFieldLayoutHint(J9JavaVM *vm, J9Class *clazz, J9FieldLayoutHint *hint)
+{
+	UDATA const referenceSize = J9JAVAVM_REFERENCE_SIZE(vm);
+	UDATA const objectHeaderSize = J9JAVAVM_OBJECT_HEADER_SIZE(vm);
+	J9ROMClass *romClass = clazz->romClass;
+	J9ClassLoader *classLoader = clazz->classLoader;
+	J9ROMFieldOffsetWalkState state;
+	J9ROMFieldOffsetWalkResult *result = NULL;
+	bool found = false;
+
+	memset(hint, 0, J9FIELDLAYOUTHINT_SIZE(romClass->romFieldCount));
+	hint->romSize = romClass->romSize;
+	hint->romFieldCount = romClass->romFieldCount;
+
+#if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
+	result = fieldOffsetsStartDo(vm, romClass, SUPERCLASS(clazz), &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE | J9VM_FIELD_OFFSET_WALK_ONLY_OBJECT_SLOTS, clazz->flattenedClassCache);
+#else /* defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES) */
+	result = fieldOffsetsStartDo(vm, romClass, SUPERCLASS(clazz), &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE | J9VM_FIELD_OFFSET_WALK_ONLY_OBJECT_SLOTS);
+#endif /* defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES) */
+
+	omrthread_monitor_enter(classLoader->hotFieldPoolMutex);
+	while (NULL != result->field) {
+		UDATA offset = result->offset + objectHeaderSize;
+		J9HotField *hotField = clazz->hotFieldsInfo->hotFieldListHead;
+
+#if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
+		/* A flattened field is not a reference slot, even if one of its own fields is at a hot offset */
+		if (NULL != result->flattenedClass) {
+			hotField = NULL;
+		}
+#endif /* defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES) */
+		while (NULL != hotField) {
+			if (offset == ((UDATA)hotField->hotFieldOffset * referenceSize)) {
+				UDATA index = result->index - 1;
+				J9FIELDLAYOUTHINT_BITS(hint)[index / 32] |= (U_32)1 << (index % 32);
+				found = true;
+				break;
+			}
+			hotField = hotField->next;
+		}
+		result = fieldOffsetsNextDo(&state);
+	}
+	omrthread_monitor_exit(classLoader->hotFieldPoolMutex);
+
+	return found;
+}
+
+/**
+ * Store field layout hints for the classes with hot fields into the shared classes cache at shutdown.
+ * Only the first hint stored for a class is kept, so layouts stay stable from run to run.
+ *
+ * @param hook[in] the VM hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the J9VMShutdownEvent
+ * @param userData[in] not used
+ */
+static void
+hookStoreFieldLayoutHints(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9VMShutdownEvent *event = (J9VMShutdownEvent *)eventData;
+	J9VMThread *currentThread = event->vmThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9SharedClassConfig *sharedClassConfig = vm->sharedClassConfig;
+
+	if ((NULL != vm->hotFieldClassInfoPool) && (NULL != sharedClassConfig)) {
+		bool needsVMAccess = J9_ARE_NO_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+		J9PendingFieldLayoutHint *pendingHints = NULL;
+		J9ClassWalkState classWalkState;
+		J9Class *clazz = NULL;
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		/* Collect the hints with VM access, but store them without it as the cache may block on other JVMs */
+		if (needsVMAccess) {
+			internalAcquireVMAccess(currentThread);
+		}
+		clazz = allLiveClassesStartDo(&classWalkState, vm, NULL);
+		while (NULL != clazz) {
+			J9ROMClass *romClass = clazz->romClass;
+
+			if ((NULL != clazz->hotFieldsInfo)
+				&& (0 != J9CLASS_DEPTH(clazz))
+				&& j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize)
+			) {
+				UDATA hintSize = J9FIELDLAYOUTHINT_SIZE(romClass->romFieldCount);
+				J9PendingFieldLayoutHint *pending = (J9PendingFieldLayoutHint *)j9mem_allocate_memory(sizeof(J9PendingFieldLayoutHint) + hintSize, OMRMEM_CATEGORY_VM);
+
+				if (NULL != pending) {
+					pending->keyLength = buildFieldLayoutHintKey(romClass, pending->key);
+					pending->hintSize = hintSize;
+					if ((0 != pending->keyLength) && fillFieldLayoutHint(vm, clazz, (J9FieldLayoutHint *)(pending + 1))) {
+						pending->next = pendingHints;
+						pendingHints = pending;
+					} else {
+						j9mem_free_memory(pending);
+					}
+				}
+			}
+			clazz = allLiveClassesNextDo(&classWalkState);
+		}
+		allLiveClassesEndDo(&classWalkState);
+		if (needsVMAccess) {
+			internalReleaseVMAccess(currentThread);
+		}
+
+		if (NULL != pendingHints) {
+			/* Mark the cache as holding hints, so that runs without any skip looking them up class by class */
+			U_32 marker = 1;
+			J9SharedDataDescriptor descriptor;
+
+			descriptor.address = (U_8 *)&marker;
+			descriptor.length = sizeof(marker);
+			descriptor.type = J9SHR_DATA_TYPE_VM;
+			descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+			sharedClassConfig->storeSharedData(currentThread, FIELD_LAYOUT_HINT_KEY_PREFIX, LITERAL_STRLEN(FIELD_LAYOUT_HINT_KEY_PREFIX), &descriptor);
+		}
+		while (NULL != pendingHints) {
+			J9PendingFieldLayoutHint *next = pendingHints->next;
+			J9SharedDataDescriptor descriptor;
+
+			descriptor.address = (U_8 *)(pendingHints + 1);
+			descriptor.length = pendingHints->hintSize;
+			descriptor.type = J9SHR_DATA_TYPE_VM;
+			descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+			sharedClassConfig->storeSharedData(currentThread, pendingHints->key, pendingHints->keyLength, &descriptor);
+			j9mem_free_memory(pendingHints);
+			pendingHints = next;
+		}
+	}
+}
+
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
+UDATA
+initializeFieldLayoutHints(J9JavaVM *vm)
+{
+	UDATA rc = 0;
+
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_PROFILE_GUIDED_FIELD_LAYOUT)) {
+		J9HookInterface **vmHooks = J9_VM_FUNCTION_VIA_JAVAVM(vm, getVMHookInterface)(vm);
+
+		if (0 != omrthread_monitor_init_with_name(&vm->fieldLayoutHintsMutex, 0, "VM field layout hints")) {
+			rc = 1;
+			goto done;
+		}
+		vm->fieldLayoutHints = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), FIELD_LAYOUT_HINTS_INITIAL_TABLE_SIZE,
+				sizeof(J9FieldLayoutHintEntry), sizeof(J9ROMClass *), 0, OMRMEM_CATEGORY_VM, fieldLayoutHintHashFn, fieldLayoutHintHashEqualFn, NULL, vm);
+		if (NULL == vm->fieldLayoutHints) {
+			omrthread_monitor_destroy(vm->fieldLayoutHintsMutex);
+			vm->fieldLayoutHintsMutex = NULL;
+			rc = 1;
+			goto done;
+		}
+#if defined(J9VM_OPT_SHARED_CLASSES)
+		/* Hot fields are only reported when the GC orders its scan by them; otherwise the hook finds nothing to record */
+		(*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_SHUTTING_DOWN, hookStoreFieldLayoutHints, OMR_GET_CALLSITE(), NULL);
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+	}
+done:
+	return rc;
+}
+
+void
+freeFieldLayoutHints(J9JavaVM *vm)
+{
+	if (NULL != vm->fieldLayoutHints) {
+		hashTableFree(vm->fieldLayoutHints);
+		vm->fieldLayoutHints = NULL;
+		omrthread_monitor_destroy(vm->fieldLayoutHintsMutex);
+		vm->fieldLayoutHintsMutex = NULL;
+	}
+}
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+ * Decide once per run whether field layout hints can apply. Hints are ignored when AOT is enabled,
+ * since AOT code validates the class chain but not field offsets, and when HCR is enabled, since a
+ * redefined class is not in the cache but must keep the same layout. Otherwise they apply if the
+ * shared classes cache holds any, which hookStoreFieldLayoutHints() records under the bare key prefix.
+ * The first answer recorded wins, so a class is never laid out both with and without its hint.
+ *
+ * @param vm[in] pointer to the J9JavaVM
+ * @return J9_FIELD_LAYOUT_HINTS_NONE or J9_FIELD_LAYOUT_HINTS_PRESENT, or J9_FIELD_LAYOUT_HINTS_UNKNOWN
+ * if there is no cache or no current thread to consult it with
+ */
+static UDATA
+findFieldLayoutHintsState(J9JavaVM *vm)
+{
+	J9SharedClassConfig *sharedClassConfig = vm->sharedClassConfig;
+	UDATA hintsState = J9_FIELD_LAYOUT_HINTS_UNKNOWN;
+
+	/* Without a cache no hint is ever found, but one may not be attached yet */
+	if (NULL != sharedClassConfig) {
+		if (J9_ARE_ANY_BITS_SET(sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_AOT)
+			|| J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_ENABLE_HCR)
+		) {
+			hintsState = J9_FIELD_LAYOUT_HINTS_NONE;
+		} else {
+			J9VMThread *currentThread = currentVMThread(vm);
+
+			if (NULL != currentThread) {
+				J9SharedDataDescriptor descriptor;
+
+				descriptor.address = NULL;
+				descriptor.length = 0;
+				if (1 == sharedClassConfig->findSharedData(currentThread, FIELD_LAYOUT_HINT_KEY_PREFIX, LITERAL_STRLEN(FIELD_LAYOUT_HINT_KEY_PREFIX), J9SHR_DATA_TYPE_VM, FALSE, &descriptor, NULL)) {
+					hintsState = J9_FIELD_LAYOUT_HINTS_PRESENT;
+				} else {
+					hintsState = J9_FIELD_LAYOUT_HINTS_NONE;
+				}
+			}
+		}
+	}
+
+	if (J9_FIELD_LAYOUT_HINTS_UNKNOWN != hintsState) {
+		UDATA oldState = VM_AtomicSupport::lockCompareExchange(&vm->fieldLayoutHintsState, J9_FIELD_LAYOUT_HINTS_UNKNOWN, hintsState);
+		if (J9_FIELD_LAYOUT_HINTS_UNKNOWN != oldState) {
+			hintsState = oldState;
+		}
+	}
+	return hintsState;
+}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
+/**
+ * Find the field layout hint recorded by an earlier run for a ROM class. Hints are only used for
+ * ROM classes in the shared classes cache, and the first answer for a ROM class is remembered so
+ * that every layout computed for it in this run agrees, even if another JVM stores a hint meanwhile.
+ * When no hints can apply, the answer is NULL without taking the mutex or searching the cache.
+ *
+ * @param vm[in] pointer to the J9JavaVM
+ * @param romClass[in] the ROM class being laid out
+ * @return the hint, or NULL if the class is laid out in declaration order
+ */
+static const J9FieldLayoutHint *
+findFieldLayoutHint(J9JavaVM *vm, J9ROMClass *romClass)
+{
+	const J9FieldLayoutHint *hint = NULL;
+	UDATA hintsState = vm->fieldLayoutHintsState;
+
+	if (NULL == vm->fieldLayoutHints) {
+		goto done;
+	}
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	if (J9_FIELD_LAYOUT_HINTS_UNKNOWN == hintsState) {
+		hintsState = findFieldLayoutHintsState(vm);
+	}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
+	if (J9_FIELD_LAYOUT_HINTS_PRESENT == hintsState) {
+		J9FieldLayoutHintEntry query;
+		J9FieldLayoutHintEntry *entry = NULL;
+
+		query.romClass = romClass;
+		query.hint = NULL;
+		omrthread_monitor_enter(vm->fieldLayoutHintsMutex);
+		entry = (J9FieldLayoutHintEntry *)hashTableFind(vm->fieldLayoutHints, &query);
+		omrthread_monitor_exit(vm->fieldLayoutHintsMutex);
+
+		if (NULL != entry) {
+			hint = entry->hint;
+		} else {
+#if defined(J9VM_OPT_SHARED_CLASSES)
+			J9SharedClassConfig *sharedClassConfig = vm->sharedClassConfig;
+			J9VMThread *currentThread = currentVMThread(vm);
+
+			if ((NULL != sharedClassConfig)
+				&& (NULL != currentThread)
+				&& j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize)
+			) {
+				char key[FIELD_LAYOUT_HINT_KEY_MAX];
+				UDATA keyLength = buildFieldLayoutHintKey(romClass, key);
+
+				if (0 != keyLength) {
+					J9SharedDataDescriptor descriptor;
+
+					descriptor.address = NULL;
+					descriptor.length = 0;
+					if ((1 == sharedClassConfig->findSharedData(currentThread, key, keyLength, J9SHR_DATA_TYPE_VM, FALSE, &descriptor, NULL))
+						&& (descriptor.length >= sizeof(J9FieldLayoutHint))
+					) {
+						const J9FieldLayoutHint *candidate = (const J9FieldLayoutHint *)descriptor.address;
+						/* Reject hints recorded for a different class of the same name */
+						if ((candidate->romSize == romClass->romSize)
+							&& (candidate->romFieldCount == romClass->romFieldCount)
+							&& (descriptor.length == J9FIELDLAYOUTHINT_SIZE(candidate->romFieldCount))
+						) {
+							hint = candidate;
+						}
+					}
+				}
+
+				/* The shared classes cache was consulted without the mutex; the first answer recorded wins */
+				query.hint = hint;
+				omrthread_monitor_enter(vm->fieldLayoutHintsMutex);
+				entry = (J9FieldLayoutHintEntry *)hashTableAdd(vm->fieldLayoutHints, &query);
+				omrthread_monitor_exit(vm->fieldLayoutHintsMutex);
+				hint = (NULL == entry) ? NULL : entry->hint;
+			}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+		}
+	}
+done:
+	return hint;
+}
+
+/**
+ * Apply the field layout hint, if any, for the class being walked. Hot instance fields are placed
+ * ahead of cold ones within each size area, so they share the cache lines nearest the header.
+ * The field placed in the backfill slot is not moved, and neither are classes with null-restricted fields.
+ *
+ * @param state[in] the walk state, with the backfill walk flags already decided
+ */
+static void
+initializeFieldLayoutHint(J9ROMFieldOffsetWalkState *state)
+{
+	const J9FieldLayoutHint *hint = findFieldLayoutHint(state->vm, state->romClass);
+
+	if (NULL != hint) {
+		bool backfillSingle = J9_ARE_ANY_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_BACKFILL_SINGLE_FIELD);
+		bool backfillObject = J9_ARE_ANY_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD);
+		U_32 hotSingles = 0;
+		U_32 hotObjects = 0;
+		U_32 hotDoubles = 0;
+		UDATA index = 0;
+		J9ROMFieldWalkState fieldWalkState;
+		J9ROMFieldShape *field = romFieldsStartDo(state->romClass, &fieldWalkState);
+
+		while (NULL != field) {
+			U_32 modifiers = field->modifiers;
+
+			if (J9_ARE_NO_BITS_SET(modifiers, J9AccStatic)) {
+				bool isHot = J9FIELDLAYOUTHINT_IS_HOT(hint, index);
+#if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
+				if (J9_ARE_ALL_BITS_SET(modifiers, J9FieldFlagIsNullRestricted)) {
+					return;
+				}
+#endif /* defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES) */
+				if (J9_ARE_ALL_BITS_SET(modifiers, J9FieldFlagObject)) {
+					if (backfillObject) {
+						backfillObject = false;
+					} else if (isHot) {
+						hotObjects += 1;
+					}
+				} else if (J9_ARE_ALL_BITS_SET(modifiers, J9FieldSizeDouble)) {
+					if (isHot) {
+						hotDoubles += 1;
+					}
+				} else {
+					if (backfillSingle) {
+						backfillSingle = false;
+					} else if (isHot) {
+						hotSingles += 1;
+					}
+				}
+			}
+			index += 1;
+			field = romFieldsNextDo(&fieldWalkState);
+		}
+
+		state->fieldLayoutHint = hint;
+		state->hotSinglesCount = hotSingles;
+		state->hotObjectsCount = hotObjects;
+		state->hotDoublesCount = hotDoubles;
+	}
+}
+
+/**
+ * Return the position within its size area of the instance field being walked. Without a layout hint
+ * this is declaration order. With one, the hot fields come first in declaration order, then the cold ones.
+ *
+ * @param state[in] the walk state
+ * @param seen[in] the number of fields already placed in the area, excluding the backfilled field
+ * @param hotSeen[in/out] the number of hot fields already placed in the area
+ * @param hotCount[in] the number of hot fields in the area
+ * @return the slot index of the field within the area
+ */
+static VMINLINE U_32
+fieldLayoutPosition(J9ROMFieldOffsetWalkState *state, U_32 seen, U_32 *hotSeen, U_32 hotCount)
+{
+	U_32 position = seen;
+
+	if (NULL != state->fieldLayoutHint) {
+		/* result.index is the 1-based JVMTI index, which counts every ROM field */
+		if (J9FIELDLAYOUTHINT_IS_HOT(state->fieldLayoutHint, state->result.index - 1)) {
+			position = *hotSeen;
+			*hotSeen += 1;
+		} else {
+			position = hotCount + (seen - *hotSeen);
+		}
+	}
+	return position;
+}
+
 J9ROMFieldOffsetWalkResult *
 #if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
 fieldOffsetsStartDo(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClazz, J9ROMFieldOffsetWalkState *state, U_32 flags, J9FlattenedClassCache *flattenedClassCache)
@@ -1001,6 +1469,12 @@ fieldOffsetsStartDo(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClazz, J9R
 #endif /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
 		}
 
+		if (J9_ARE_ANY_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE)
+			&& !fieldInfo.isContendedClassLayout()
+		) {
+			initializeFieldLayoutHint(state);
+		}
+
 		/*
 		 * Calculate offsets (from the object header) for hidden fields.  Hidden fields follow immediately the instance fields of the same type.
 		 * Give instance fields priority for backfill slots.
@@ -1209,7 +1683,7 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 									state->result.offset = state->backfillOffsetToUse;
 									state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
 								} else {
-									state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
+									state->result.offset = state->firstObjectOffset + fieldLayoutPosition(state, state->objectsSeen, &state->hotObjectsSeen, state->hotObjectsCount) * referenceSize;
 									state->objectsSeen++;
 								}
 							} else {
@@ -1266,7 +1740,7 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 								state->result.offset = state->backfillOffsetToUse;
 								state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
 							} else {
-								state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
+								state->result.offset = state->firstObjectOffset + fieldLayoutPosition(state, state->objectsSeen, &state->hotObjectsSeen, state->hotObjectsCount) * referenceSize;
 								state->objectsSeen++;
 							}
 						}
@@ -1276,14 +1750,14 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 							state->result.offset = state->backfillOffsetToUse;
 							state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
 						} else {
-							state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
+							state->result.offset = state->firstObjectOffset + fieldLayoutPosition(state, state->objectsSeen, &state->hotObjectsSeen, state->hotObjectsCount) * referenceSize;
 							state->objectsSeen++;
 						}
 #endif /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
 						break;
 					} else if ( 0 == (state->walkFlags & J9VM_FIELD_OFFSET_WALK_ONLY_OBJECT_SLOTS) ) {
 						if( modifiers & J9FieldSizeDouble ) {
-							state->result.offset = state->firstDoubleOffset + state->doublesSeen * sizeof( U_64 );
+							state->result.offset = state->firstDoubleOffset + fieldLayoutPosition(state, state->doublesSeen, &state->hotDoublesSeen, state->hotDoublesCount) * sizeof( U_64 );
 							state->doublesSeen++;
 						} else {
 							if (state->walkFlags & J9VM_FIELD_OFFSET_WALK_BACKFILL_SINGLE_FIELD) {
@@ -1291,7 +1765,7 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 								state->result.offset = state->backfillOffsetToUse;
 								state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_SINGLE_FIELD;
 							} else {
-								state->result.offset = state->firstSingleOffset + state->singlesSeen * sizeof( U_32 );
+								state->result.offset = state->firstSingleOffset + fieldLayoutPosition(state, state->singlesSeen, &state->hotSinglesSeen, state->hotSinglesCount) * sizeof( U_32 );
 								state->singlesSeen++;
 							}
 						}
@@ -97,6 +97,52 @@ fieldIndexTableNew(J9JavaVM* vm, J9PortLibrary *portLib);
 void
 fieldIndexTableFree(J9JavaVM* vm);
 
+/* ---------------- DecodedFrameCache.cpp ---------------- */
+
+/**
+ * Allocate the decoded frame cache and register the hooks which flush it.
+ * Called at VM startup.
+ * @param vm the J9JavaVM
+ * @return 0 on success, non-zero on failure
+ */
+UDATA
+initializeDecodedFrameCache(J9JavaVM *vm);
+
+/**
+ * Unregister the flush hooks and free the decoded frame cache and all of its entries.
+ * Called during VM shutdown.
+ * @param vm the J9JavaVM
+ */
+void
+freeDecodedFrameCache(J9JavaVM *vm);
+
+/**
+ * Copy the cached frames for a walkback PC into a caller-supplied buffer.
+ * The copy remains usable if the cache is flushed while the caller has released VM access.
+ * @param currentThread the current J9VMThread, which must have VM access
+ * @param pc the walkback PC
+ * @param frames buffer of J9_DECODED_FRAME_CACHE_MAX_FRAMES frames
+ * @param metaData returns the JIT metadata the PC belongs to, or NULL for interpreted PCs
+ * @param codeGeneration returns the code generation to pass to storeDecodedFrames() on a miss
+ * @return the number of frames copied, 0 if the PC is not cached
+ */
+UDATA
+lookupDecodedFrames(J9VMThread *currentThread, UDATA pc, J9DecodedFrame *frames, struct J9JITExceptionTable **metaData, UDATA *codeGeneration);
+
+/**
+ * Publish the decoded frames for a walkback PC. The frames are copied. Nothing is stored if
+ * another thread has published the same PC, if JIT code was unloaded since the lookup, or if
+ * the cache is full and too many replaced entries are waiting to be freed.
+ * @param currentThread the current J9VMThread, which must have VM access
+ * @param pc the walkback PC
+ * @param frames the decoded frames, innermost inlined frame first
+ * @param frameCount the number of frames, at most J9_DECODED_FRAME_CACHE_MAX_FRAMES
+ * @param metaData the JIT metadata the PC belongs to, or NULL for interpreted PCs
+ * @param codeGeneration the code generation returned by the lookup which missed, read before decoding
+ */
+void
+storeDecodedFrames(J9VMThread *currentThread, UDATA pc, J9DecodedFrame *frames, UDATA frameCount, struct J9JITExceptionTable *metaData, UDATA codeGeneration);
+
 /* ---------------- jniinv.c ---------------- */
 
 /**
@@ -0,0 +1,81 @@
+dnl Copyright IBM Corp. and others 2026
+dnl
+dnl This program and the accompanying materials are made available under
+dnl the terms of the Eclipse Public License 2.0 which accompanies this
+dnl distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+dnl or the Apache License, Version 2.0 which accompanies this distribution and
+dnl is available at https://www.apache.org/licenses/LICENSE-2.0.
+dnl
+dnl This Source Code may also be made available under the following
+dnl Secondary Licenses when the conditions for such availability set
+dnl forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+dnl General Public License, version 2 with the GNU Classpath
+dnl Exception [1] and GNU General Public License, version 2 with the
+dnl OpenJDK Assembly Exception [2].
+dnl
+dnl [1] https://www.gnu.org/software/classpath/license.html
+dnl [2] https://openjdk.org/legal/assembly-exception.html
+dnl
+dnl SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+
+include(xhelpers.m4)
+
+	FILE_START
+
+	DECLARE_PUBLIC(directDowncallThunk)
+
+dnl Prototype: void directDowncallThunk(void *function, U_64 *registerArgs, UDATA *returnStorage, UDATA returnKind);
+dnl Defined in: #Args: 4
+dnl
+dnl Load the 6 general purpose argument registers from registerArgs[0..5] and
+dnl the 8 vector argument registers from registerArgs[6..13], call function and
+dnl store the result according to returnKind (see J9VM_FFI_DIRECT_DOWNCALL_RETURN_*
+dnl in LayoutFFITypeHelpers.hpp): 0 stores rax, 1 stores the float in the low
+dnl 32 bits of xmm0 and 2 stores the double in xmm0.
+dnl
+dnl rbx and r12 are callee-saved, so they keep returnStorage and returnKind
+dnl across the call. Pushing them keeps the stack 16-byte aligned at the call.
+
+START_PROC(directDowncallThunk)
+	push rbp
+	mov rbp, rsp
+	push rbx
+	push r12
+	mov rbx, rdx
+	mov r12, rcx
+	mov r11, rdi
+	mov rax, rsi
+	movq xmm0, qword ptr [rax+48]
+	movq xmm1, qword ptr [rax+56]
+	movq xmm2, qword ptr [rax+64]
+	movq xmm3, qword ptr [rax+72]
+	movq xmm4, qword ptr [rax+80]
+	movq xmm5, qword ptr [rax+88]
+	movq xmm6, qword ptr [rax+96]
+	movq xmm7, qword ptr [rax+104]
+	mov rdi, qword ptr [rax]
+	mov rsi, qword ptr [rax+8]
+	mov rdx, qword ptr [rax+16]
+	mov rcx, qword ptr [rax+24]
+	mov r8, qword ptr [rax+32]
+	mov r9, qword ptr [rax+40]
+	call r11
+	cmp r12, 1
+	je LABEL(directDowncallReturnFloat)
+	cmp r12, 2
+	je LABEL(directDowncallReturnDouble)
+	mov qword ptr [rbx], rax
+	jmp LABEL(directDowncallDone)
+LABEL(directDowncallReturnFloat):
+	movss dword ptr [rbx], xmm0
+	jmp LABEL(directDowncallDone)
+LABEL(directDowncallReturnDouble):
+	movsd qword ptr [rbx], xmm0
+LABEL(directDowncallDone):
+	pop r12
+	pop rbx
+	pop rbp
+	ret
+END_PROC(directDowncallThunk)
+
+	FILE_END
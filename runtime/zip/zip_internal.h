@@ -123,6 +123,7 @@ typedef struct J9ZipCacheInternal {
 	J9ZipCacheEntry *entry;
 	IDATA zipFileFd;
 	U_8 zipFileType;
+	J9MmapHandle *zipFileMmap; /* read-only mapping of the whole file, or NULL when it is read through zipFileFd */
 } J9ZipCacheInternal;
 
 /**
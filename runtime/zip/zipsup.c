@@ -91,6 +91,8 @@ static I_32 getZipEntryUsingDirectory(J9PortLibrary *portLib, J9ZipFile *zipFile
 		const char *fileName, IDATA fileNameLength, BOOLEAN readDataPointer);
 static BOOLEAN isSeekFailure(I_64 seekResult, I_64 expectedValue);
 static BOOLEAN isOutside4Gig(I_64 value);
+static U_8 *getMappedData(J9ZipFile *zipFile, I_64 offset, I_64 *size);
+static void mapZipFile(J9PortLibrary *portLib, J9ZipFile *zipFile);
 
 #if defined(J9VM_THR_PREEMPTIVE)
 #include "omrthread.h"
@@ -204,6 +206,47 @@ isOutside4Gig(I_64 value) {
 	return (value < 0) || (value > UINT32_MAX);
 }
 
+/*
+	Return a pointer to the data at offset in the read-only mapping of zipFile, or NULL if the file is not
+	mapped or offset is outside the mapping.  On input *size is the number of bytes wanted, on return it is
+	the number of bytes actually available at the pointer (fewer than requested near the end of the file).
+
+	When a file is mapped, zipFile->pointer still tracks the logical position but the position of zipFile->fd
+	is not maintained.  Every path that falls back to j9file_read() must seek first.
+*/
+static U_8 *
+getMappedData(J9ZipFile *zipFile, I_64 offset, I_64 *size)
+{
+	if (NULL != zipFile->cache) {
+		J9MmapHandle *handle = ((J9ZipCacheInternal *)zipFile->cache)->zipFileMmap;
+		if ((NULL != handle) && (offset >= 0) && ((U_64)offset <= (U_64)handle->size)) {
+			I_64 available = (I_64)(handle->size - (UDATA)offset);
+			if (*size > available) {
+				*size = available;
+			}
+			return (U_8 *)handle->pointer + offset;
+		}
+	}
+	return NULL;
+}
+
+/*
+	Map the whole file read-only and attach the mapping to the new cache of zipFile, where it is shared by
+	every J9ZipFile using that cache and released by zipCache_kill().  Failing to map is not an error, the
+	file is then read through the file descriptor.
+*/
+static void
+mapZipFile(J9PortLibrary *portLib, J9ZipFile *zipFile)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipFile->cache;
+	I_64 fileSize = j9file_flength(zipFile->fd);
+
+	if ((NULL != zci) && (NULL == zci->zipFileMmap) && (fileSize > 0) && !isOutside4Gig(fileSize)) {
+		zci->zipFileMmap = j9mmap_map_file(zipFile->fd, 0, (UDATA)fileSize, (const char *)zipFile->filename, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+	}
+}
+
 /*
 	Returns 0 on success or one of the following:
 			ZIP_ERR_UNSUPPORTED_FILE_TYPE
@@ -490,6 +533,7 @@ I_32 scanForCentralEnd(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipCentralE
 {
 	U_8 *current;
 	U_8 buffer[SCAN_CHUNK_SIZE + MIN_ZIPFILE_SIZE];
+	U_8 *chunk = buffer;
 	I_32 state = 0;
 	I_64 size = 0;
 	U_32 dataSize = 0;
@@ -497,16 +541,21 @@ I_32 scanForCentralEnd(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipCentralE
 	I_64 fileSize = 0;
 	I_64 bytesAlreadyRead = 0;
 	BOOLEAN readFromEnd = TRUE;
+	U_8 *mappedFile = NULL;
 
 
 	PORT_ACCESS_FROM_PORT(portLib);
 
-	seekResult = j9file_seek(zipFile->fd, 0, EsSeekEnd);
-	if (isOutside4Gig(seekResult)) {
-		zipFile->pointer = -1;
-		return ZIP_ERR_FILE_READ_ERROR;
+	fileSize = UINT32_MAX;
+	mappedFile = getMappedData(zipFile, 0, &fileSize);
+	if (NULL == mappedFile) {
+		seekResult = j9file_seek(zipFile->fd, 0, EsSeekEnd);
+		if (isOutside4Gig(seekResult)) {
+			zipFile->pointer = -1;
+			return ZIP_ERR_FILE_READ_ERROR;
+		}
+		fileSize = seekResult;
 	}
-	fileSize = seekResult;
 	zipFile->pointer = (U_32) fileSize;
 
 	while(TRUE)  {
@@ -522,10 +571,14 @@ I_32 scanForCentralEnd(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipCentralE
 			size = fileSize-bytesAlreadyRead;
 		}
 		bytesAlreadyRead += size;
-		seekResult = j9file_seek(zipFile->fd, fileSize-bytesAlreadyRead, EsSeekSet);
-		if (isOutside4Gig(seekResult)) {
-			zipFile->pointer = -1;
-			return ZIP_ERR_FILE_READ_ERROR;
+		if (NULL != mappedFile) {
+			seekResult = fileSize-bytesAlreadyRead;
+		} else {
+			seekResult = j9file_seek(zipFile->fd, fileSize-bytesAlreadyRead, EsSeekSet);
+			if (isOutside4Gig(seekResult)) {
+				zipFile->pointer = -1;
+				return ZIP_ERR_FILE_READ_ERROR;
+			}
 		}
 		zipFile->pointer = (U_32)seekResult;
 		if(readFromEnd == FALSE) {
@@ -538,7 +591,10 @@ I_32 scanForCentralEnd(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipCentralE
 			 */
 			size += MIN_ZIPFILE_SIZE;
 		}
-		if (j9file_read( zipFile->fd, buffer, (IDATA)size) != (IDATA)size)  {
+		if (NULL != mappedFile) {
+			/* Scan the mapping in place, the overlap above is always inside the file */
+			chunk = mappedFile + seekResult;
+		} else if (j9file_read( zipFile->fd, buffer, (IDATA)size) != (IDATA)size)  {
 				zipFile->pointer = -1;
 				return ZIP_ERR_FILE_READ_ERROR;
 		}
@@ -551,28 +607,28 @@ I_32 scanForCentralEnd(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipCentralE
 			{
 				case 0:
 					/* Nothing yet. */
-					if(buffer[i] == 6) state = 1;
+					if(chunk[i] == 6) state = 1;
 					break;
 
 				case 1:
 					/* Seen ^F */
-					if(buffer[i] == 5) state = 2;
+					if(chunk[i] == 5) state = 2;
 					else state = 0;
 					break;
 
 				case 2:
 					/* Seen ^E^F */
-					if(buffer[i] == 'K') state = 3;
+					if(chunk[i] == 'K') state = 3;
 					else state = 0;
 					break;
 
 				case 3:
 					/* Seen K^E^F */
-					if(buffer[i] == 'P' && dataSize >= ZIPFILE_COMMENT_OFFSET)
+					if(chunk[i] == 'P' && dataSize >= ZIPFILE_COMMENT_OFFSET)
 					{
 						endEntry->endCentralDirRecordPosition = seekResult + i;
 						/* Found it.  Read the data from the end-of-central-dir record. */
-						current = buffer+i+4;
+						current = chunk+i+4;
 						ZIP_NEXT_U16(endEntry->diskNumber, current);
 						ZIP_NEXT_U16(endEntry->dirStartDisk, current);
 						ZIP_NEXT_U16(endEntry->thisDiskEntries, current);
@@ -751,6 +807,8 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 	J9ZipCachePool *cachePool;
 	BOOLEAN freeFilename = FALSE;
 	BOOLEAN freeBuffer = FALSE;
+	U_8 *mappedDir = NULL;
+	I_64 mappedSize = 0;
 
 	if (!zipFile->cache)  return ZIP_ERR_INTERNAL_ERROR;
 
@@ -759,15 +817,28 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 	if (zipFile->pointer != startCentralDir)  {
 		zipFile->pointer = (U_32) startCentralDir;
 	}
-	seekResult = j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
-	if (isSeekFailure(seekResult, zipFile->pointer)) {
-		zipFile->pointer = -1;
-		result = ZIP_ERR_FILE_READ_ERROR;
-		goto finished;
+	mappedSize = unreadSize;
+	mappedDir = getMappedData(zipFile, startCentralDir, &mappedSize);
+	if ((NULL != mappedDir) && (mappedSize != unreadSize)) {
+		/* The directory runs past the end of the file, let the read path report it */
+		mappedDir = NULL;
+	}
+	if (NULL == mappedDir) {
+		seekResult = j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
+		if (isSeekFailure(seekResult, zipFile->pointer)) {
+			zipFile->pointer = -1;
+			result = ZIP_ERR_FILE_READ_ERROR;
+			goto finished;
+		}
 	}
 
 	/* Allocate some space to hold central directory goo as we eat through it */
 	cachePool = zipFile->cachePool;
+	if (NULL != mappedDir) {
+		/* The whole directory is parsed in place, only the filename scratch space is needed */
+		bufferSize = unreadSize;
+		buffer = mappedDir;
+	}
 	if (cachePool != NULL) {
 		if (cachePool->allocateWorkBuffer) {
 			cachePool->allocateWorkBuffer = FALSE;
@@ -775,22 +846,26 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 		}
 		if (cachePool->workBuffer != NULL) {
 			filename = (U_8*)cachePool->workBuffer;
-			buffer = (U_8*)cachePool->workBuffer + filenameSize;
-			bufferSize -= filenameSize;
+			if (NULL == mappedDir) {
+				buffer = (U_8*)cachePool->workBuffer + filenameSize;
+				bufferSize -= filenameSize;
+			}
 		}
 	}
 
 	/* No point in allocating more than we'll actually need.. */
 	if (bufferSize > unreadSize)  bufferSize = unreadSize;
 
-	if (buffer == NULL) {
-		freeBuffer = freeFilename = TRUE;
+	if (filename == NULL) {
+		freeFilename = TRUE;
 		filename = j9mem_allocate_memory(filenameSize, J9MEM_CATEGORY_VM_JCL);
 		if (!filename)  {
 			result = ZIP_ERR_OUT_OF_MEMORY;
 			goto finished;
 		}
-
+	}
+	if (buffer == NULL) {
+		freeBuffer = TRUE;
 		buffer = j9mem_allocate_memory(bufferSize, J9MEM_CATEGORY_VM_JCL);
 	}
 	if(!buffer && (bufferSize > 4096))	 {
@@ -808,7 +883,12 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 		/* Read as much as needed into buffer. */
 		bytesToRead = bufferSize-bufferedSize;
 		if (bytesToRead > unreadSize)  bytesToRead = unreadSize;
-		readResult = j9file_read(zipFile->fd, buffer+bufferedSize, bytesToRead);
+		if (NULL != mappedDir) {
+			/* Everything is already in the buffer, this is the only pass */
+			readResult = bytesToRead;
+		} else {
+			readResult = j9file_read(zipFile->fd, buffer+bufferedSize, bytesToRead);
+		}
 		if (readResult < 0)  {
 			result = ZIP_ERR_FILE_READ_ERROR;
 			zipFile->pointer = -1;
@@ -885,7 +965,7 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 
 				/* Otherwise, we ran out of source string.  Load another chunk.. */
 				bufferedSize = 0;
-				if (!unreadSize)  {
+				if (!unreadSize || (NULL != mappedDir))  {
 					/* Central header is supposedly done?  Bak */
 					result = ZIP_ERR_FILE_CORRUPT;
 					goto finished;
@@ -927,6 +1007,10 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 			bytesToRead = entry.extraFieldLength + entry.fileCommentLength;
 			if (bufferedSize - (current-buffer) >= bytesToRead)  {
 				current += bytesToRead;
+			} else if (NULL != mappedDir) {
+				/* The extra field or comment runs past the end of the directory */
+				result = ZIP_ERR_FILE_CORRUPT;
+				goto finished;
 			} else  {
 				/* The rest of the buffer is uninteresting.  Skip ahead to where the good stuff is */
 				bytesToRead -= (bufferedSize - (current-buffer));
@@ -942,6 +1026,10 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 				zipFile->pointer = (U_32) seekResult;
 			}
 		}
+		if (NULL != mappedDir) {
+			/* The mapping is read-only and there is nothing left to read */
+			break;
+		}
 		bufferedSize -= (current-buffer);
 		memmove(buffer, current, bufferedSize);
 	}
@@ -1003,18 +1091,23 @@ readZipEntry(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry * zipEntry
 		readLength++;
 	}
 
-	/* Allocate some memory if necessary */
-	if (readLength <= sizeof(buffer)) {
-		current = buffer;
-	} else {
-		current = readBuffer = j9mem_allocate_memory((IDATA) readLength, J9MEM_CATEGORY_VM_JCL);
-		if (!readBuffer)
-			return ZIP_ERR_OUT_OF_MEMORY;
-	}
-
 	currentEntryPointer = localEntryPointer = zipFile->pointer;
 
-	readResult = j9file_read(zipFile->fd, current, (IDATA) readLength);
+	/* Use the header in place if the file is mapped */
+	readResult = readLength;
+	current = getMappedData(zipFile, zipFile->pointer, &readResult);
+	if (NULL == current) {
+		/* Allocate some memory if necessary */
+		if (readLength <= sizeof(buffer)) {
+			current = buffer;
+		} else {
+			current = readBuffer = j9mem_allocate_memory((IDATA) readLength, J9MEM_CATEGORY_VM_JCL);
+			if (!readBuffer)
+				return ZIP_ERR_OUT_OF_MEMORY;
+		}
+
+		readResult = j9file_read(zipFile->fd, current, (IDATA) readLength);
+	}
 	if ((readResult < 22) || (filename && !(readResult == readLength || (findDirectory && readResult == (readLength-1))))) {
 		/* We clearly didn't get enough bytes */
 		result = ZIP_ERR_FILE_READ_ERROR;
@@ -1115,8 +1208,16 @@ readZipEntry(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry * zipEntry
 
 	/* Read the rest of the filename if necessary.  Allocate space in J9ZipEntry for it! */
 	if (readLength < zipEntry->filenameLength) {
-		readResult = j9file_read(zipFile->fd, zipEntry->filename + readLength,
-				(IDATA) (zipEntry->filenameLength - readLength));
+		U_8 *mappedName = NULL;
+
+		readResult = zipEntry->filenameLength - readLength;
+		mappedName = getMappedData(zipFile, zipFile->pointer, &readResult);
+		if (NULL != mappedName) {
+			memcpy(zipEntry->filename + readLength, mappedName, (IDATA) readResult);
+		} else {
+			readResult = j9file_read(zipFile->fd, zipEntry->filename + readLength,
+					(IDATA) (zipEntry->filenameLength - readLength));
+		}
 		if (readResult != (zipEntry->filenameLength - readLength)) {
 			result = ZIP_ERR_FILE_READ_ERROR;
 			goto finished;
@@ -1162,7 +1263,15 @@ readZipEntry(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry * zipEntry
 		 * the extra field data in the corresponding local entry.
 		 */
 		if (readDataPointer) {
-			if ( j9file_seek( zipFile->fd, localEntryPointer + 28, EsSeekSet ) == localEntryPointer+28 ) {
+			I_64 lostSize = 2;
+			U_8 *mappedLost = getMappedData(zipFile, localEntryPointer + 28, &lostSize);
+			if (NULL != mappedLost) {
+				if (2 == lostSize) {
+					ZIP_NEXT_U16( lost, mappedLost );
+					zipEntry->dataPointer = zipEntry->extraFieldPointer + lost;
+					zipFile->pointer = (U_32) (localEntryPointer + 30);
+				}
+			} else if ( j9file_seek( zipFile->fd, localEntryPointer + 28, EsSeekSet ) == localEntryPointer+28 ) {
 				if ( j9file_read( zipFile->fd, buf, 2 ) == 2 ) {
 					ZIP_NEXT_U16( lost, buf2 );
 					zipEntry->dataPointer = zipEntry->extraFieldPointer + lost;
@@ -1616,6 +1725,7 @@ zip_getZipEntry(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry *entry,
 	IDATA position = -1;
 	BOOLEAN retryAllowed = TRUE;
 	I_64 seekResult = -1;
+	I_64 mappedSize = 0;
 	BOOLEAN findDirectory = J9_ARE_ANY_BITS_SET(flags, J9ZIP_GETENTRY_FIND_DIRECTORY);
 	BOOLEAN readDataPointer = J9_ARE_ANY_BITS_SET(flags, J9ZIP_GETENTRY_READ_DATA_POINTER);
 	ENTER();
@@ -1634,15 +1744,18 @@ zip_getZipEntry(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry *entry,
 			goto finished;
 		}
 
-		/* Seek to the entry's position in the file. */
+		/* Seek to the entry's position in the file.  A mapped file is read in place by readZipEntry(). */
 		if (zipFile->pointer != position) {
 			zipFile->pointer = (U_32) position;
 		}
-		seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
-		if (isSeekFailure(seekResult, zipFile->pointer)) {
-			zipFile->pointer = -1;
-			status = ZIP_ERR_FILE_READ_ERROR;
-			goto finished;
+		mappedSize = 0;
+		if (NULL == getMappedData(zipFile, position, &mappedSize)) {
+			seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
+			if (isSeekFailure(seekResult, zipFile->pointer)) {
+				zipFile->pointer = -1;
+				status = ZIP_ERR_FILE_READ_ERROR;
+				goto finished;
+			}
 		}
 
 		/* Read the entry */
@@ -1840,6 +1953,8 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 	U_8* dataBuffer;
 	struct workBuffer wb;
 	I_64 seekResult;
+	U_8* mappedData;
+	I_64 mappedSize;
 
 	ENTER();
 
@@ -1875,6 +1990,18 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 		if (zipFile->pointer != entry->dataPointer)  {
 			zipFile->pointer = (U_32) entry->dataPointer;
 		}
+		mappedSize = entry->compressedSize;
+		mappedData = getMappedData(zipFile, entry->dataPointer, &mappedSize);
+		if (NULL != mappedData) {
+			if (mappedSize != entry->compressedSize) {
+				result = ZIP_ERR_FILE_READ_ERROR;
+				goto finished;
+			}
+			memcpy(dataBuffer, mappedData, entry->compressedSize);
+			zipFile->pointer += entry->compressedSize;
+			EXIT();
+			return 0;
+		}
 		seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
 		if (isSeekFailure(seekResult, zipFile->pointer)) {
 			zipFile->pointer = -1;
@@ -1907,6 +2034,21 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 				}
 			}
 		}
+		/* Inflate straight from a mapped file, the work buffer is left to zlib. */
+		mappedSize = entry->compressedSize;
+		mappedData = getMappedData(zipFile, entry->dataPointer, &mappedSize);
+		if (NULL != mappedData) {
+			if (mappedSize != entry->compressedSize) {
+				result = ZIP_ERR_FILE_READ_ERROR;
+				goto finished;
+			}
+			zipFile->pointer = (U_32) (entry->dataPointer + entry->compressedSize);
+			result = inflateData(&wb, mappedData, entry->compressedSize, dataBuffer, entry->uncompressedSize);
+			if(result)  goto finished;
+			EXIT();
+			return 0;
+		}
+
 		readBuffer = zdataalloc(&wb, 1, entry->compressedSize);
 		if(!readBuffer) {
 			result = ZIP_ERR_OUT_OF_MEMORY;
@@ -2247,6 +2389,7 @@ J9HookInterface** zip_getVMZipCachePoolHookInterface(J9ZipCachePool *cachePool)
  * Valid flags are:
  * J9ZIP_OPEN_READ_CACHE_DATA: build a cache of the central directory
  * J9ZIP_OPEN_ALLOW_NONSTANDARD_ZIP: open the file even if it does not start with a local header
+ * J9ZIP_OPEN_MAP_FILE: map the file when a new cache is built and read from the mapping (requires a cachePool)
  *
  * 
  * @return 0 on success
@@ -2368,6 +2511,9 @@ zip_openZipFile(J9PortLibrary *portLib, char *filename, J9ZipFile *zipFile, J9Zi
 	if (NULL != cachePool) {
 		result = zip_setupCache(portLib, zipFile, cache, cachePool);
 		fd = zipFile->fd;
+		if ((0 == result) && (NULL == cache) && J9_ARE_ANY_BITS_SET(flags, J9ZIP_OPEN_MAP_FILE)) {
+			mapZipFile(portLib, zipFile);
+		}
 		if ((0 == result) && (TRUE == doReadCacheData)) {
 			result = zip_readCacheData(portLib, zipFile);
 		}
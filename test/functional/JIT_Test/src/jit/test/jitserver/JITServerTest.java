@@ -59,6 +59,8 @@ public class JITServerTest {
 	private static final String SERVER_PORT_ENV_VAR_NAME = "JITServerTest_SERVER_PORT";
 	private static final String JITSERVER_PORT_OPTION_FORMAT_STRING = "-XX:JITServerPort=%d";
 	private final String aotCacheOption = "-XX:+JITServerUseAOTCache";
+	// Message compression is negotiated, so it must be enabled at the server as well
+	private final String compressMessagesOption = "-XX:+JITServerCompressMessages";
 
 	private static final String CLIENT_EXE = System.getProperty("CLIENT_EXE");
 	// This handy regex pattern uses positive lookahead to match a string containing either zero or an even number of " (double quote) characters.
@@ -90,10 +92,12 @@ public class JITServerTest {
 		}
 
 		clientBuilder = new ProcessBuilder(stripQuotesFromEachArg(String.join(" ", CLIENT_EXE, portOption, "-XX:+UseJITServer", CLIENT_PROGRAM).split(SPLIT_ARGS_PATTERN)));
+		String serverCommand = String.join(" ", SERVER_EXE, portOption, "-XX:-JITServerHealthProbes");
 		if (CLIENT_PROGRAM.contains(aotCacheOption))
-			serverBuilder = new ProcessBuilder(stripQuotesFromEachArg(String.join(" ", SERVER_EXE, portOption, "-XX:-JITServerHealthProbes", aotCacheOption).split(SPLIT_ARGS_PATTERN)));
-		else
-			serverBuilder = new ProcessBuilder(stripQuotesFromEachArg(String.join(" ", SERVER_EXE, portOption, "-XX:-JITServerHealthProbes").split(SPLIT_ARGS_PATTERN)));
+			serverCommand = String.join(" ", serverCommand, aotCacheOption);
+		if (CLIENT_PROGRAM.contains(compressMessagesOption))
+			serverCommand = String.join(" ", serverCommand, compressMessagesOption);
+		serverBuilder = new ProcessBuilder(stripQuotesFromEachArg(serverCommand.split(SPLIT_ARGS_PATTERN)));
 
 		// Redirect stderr to stdout, one log for each of the client and server is sufficient.
 		clientBuilder.redirectErrorStream(true);
@@ -680,4 +684,99 @@ public class JITServerTest {
 			destroyAndCheckProcess(server, serverBuilder);
 		}
 	}
+
+	public void testServerAOTCachePersistence() throws IOException, InterruptedException {
+		logger.info("running testServerAOTCachePersistence: INFO and above level logging enabled");
+
+		// Run this test only for the test variation with AOT Cache option specified
+		if (System.getProperty("CLIENT_PROGRAM").contains(aotCacheOption)) {
+			updateJITServerPort();
+
+			final File cacheDir = new File("testServerAOTCachePersistence.cacheDir");
+			cacheDir.mkdirs();
+			for (File file : cacheDir.listFiles())
+				file.delete();
+
+			// Save a snapshot as soon as a few methods are cached so that the first client produces one
+			final ProcessBuilder persistentServerBuilder = new ProcessBuilder(new ArrayList<String>(serverBuilder.command()));
+			persistentServerBuilder.command().add("-XX:+JITServerAOTCachePersistence");
+			persistentServerBuilder.command().add("-XX:JITServerAOTCacheDir=" + cacheDir.getAbsolutePath());
+			persistentServerBuilder.redirectErrorStream(true);
+			persistentServerBuilder.environment().putAll(serverBuilder.environment());
+			persistentServerBuilder.environment().compute("TR_Options",
+				(k, v) -> String.join(",", "aotCachePersistenceMinDeltaMethods=10,aotCachePersistenceMinPeriodMs=1000", v));
+
+			redirectProcessOutputs(clientBuilder, "testServerAOTCachePersistence.client");
+			redirectProcessOutputs(persistentServerBuilder, "testServerAOTCachePersistence.server");
+
+			if (checkCacheExists("test_jitscc"))
+				destroyCache("test_jitscc");
+
+			Process server = startProcess(persistentServerBuilder, "server");
+
+			Thread.sleep(SERVER_START_WAIT_TIME_MS);
+
+			Process client = startProcess(clientBuilder, "client");
+
+			logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+			Thread.sleep(CLIENT_TEST_TIME_MS);
+
+			logger.info("Stopping client...");
+			destroyAndCheckProcess(client, clientBuilder);
+
+			logger.info("Stopping server...");
+			destroyAndCheckProcess(server, persistentServerBuilder);
+
+			logger.info("Checking if the AOT cache snapshot was saved by the server");
+			if (!checkLogFiles("testServerAOTCachePersistence.server.jitverboselog.out.*", "Saved cache '.*' to file")) {
+				AssertJUnit.fail("The server did not save an AOT cache snapshot.");
+			}
+			AssertJUnit.assertTrue("There is no AOT cache snapshot in " + cacheDir, cacheDir.listFiles().length > 0);
+
+			// Without a local SCC the restarted client must get its AOT methods from the restarted server,
+			// which only has them in the snapshot.
+			logger.info("Destroy the cache test_jitscc");
+			destroyCache("test_jitscc");
+			Thread.sleep(DESTROY_SCC_WAIT_TIME_MS);
+
+			logger.info("Restarting server and client...");
+			int randomLogId = new Random().nextInt();
+			redirectProcessOutputs(clientBuilder, "testServerAOTCachePersistence.client" + randomLogId);
+			redirectProcessOutputs(persistentServerBuilder, "testServerAOTCachePersistence.server" + randomLogId);
+
+			server = startProcess(persistentServerBuilder, "server");
+
+			Thread.sleep(SERVER_START_WAIT_TIME_MS);
+
+			client = startProcess(clientBuilder, "client");
+
+			logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+			Thread.sleep(CLIENT_TEST_TIME_MS);
+
+			logger.info("Stopping client...");
+			destroyAndCheckProcess(client, clientBuilder);
+
+			logger.info("Stopping server...");
+			destroyAndCheckProcess(server, persistentServerBuilder);
+
+			// Destroy the SCC and the snapshot for cleanup
+			logger.info("Destroy the cache test_jitscc");
+			destroyCache("test_jitscc");
+			Thread.sleep(DESTROY_SCC_WAIT_TIME_MS);
+			for (File file : cacheDir.listFiles())
+				file.delete();
+			cacheDir.delete();
+
+			final String serverLogPattern = "testServerAOTCachePersistence.server" + randomLogId + ".jitverboselog.out.*";
+			if (!checkLogFiles(serverLogPattern, "Opened file .* to load cache")) {
+				AssertJUnit.fail("The restarted server did not load the AOT cache snapshot.");
+			}
+			if (!checkLogFiles(serverLogPattern, "read method .* from snapshot")) {
+				AssertJUnit.fail("The restarted server did not read any method from the AOT cache snapshot.");
+			}
+			if (!checkLogFiles("testServerAOTCachePersistence.client" + randomLogId + ".jitverboselog.out.*", "remote deserialized")) {
+				AssertJUnit.fail("There are no deserialized methods at the restarted client.");
+			}
+		}
+	}
 }
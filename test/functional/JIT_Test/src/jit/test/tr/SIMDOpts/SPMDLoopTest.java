@@ -0,0 +1,274 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package jit.test.tr.SIMDOpts;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+
+/**
+ * Checks loops that SPMDKernelParallelization auto-vectorizes at hot and scorching against
+ * scalar results. The kernel* methods are the ones meant to be compiled; the expected results
+ * are computed inline by the test methods.
+ *
+ * Array lengths cover loops that are too short for one vectorized trip, loops that are an exact
+ * multiple of it and loops with a remainder run by the scalar residue loop. Element-wise kernels
+ * are also called with aliasing arguments, including overlapping ranges of the same array, which
+ * the alias versioning done ahead of vectorization must keep on the scalar path.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class SPMDLoopTest {
+	private static final int ITERATIONS = 200;
+	private static final int MAX_LENGTH = 150;
+
+	static void kernelAddBytes(byte[] a, byte[] b, byte[] c, int n) {
+		for (int i = 0; i < n; i++)
+			c[i] = (byte)(a[i] + b[i]);
+	}
+
+	static void kernelAddShorts(short[] a, short[] b, short[] c, int n) {
+		for (int i = 0; i < n; i++)
+			c[i] = (short)(a[i] + b[i]);
+	}
+
+	static void kernelAddInts(int[] a, int[] b, int[] c, int n) {
+		for (int i = 0; i < n; i++)
+			c[i] = a[i] + b[i];
+	}
+
+	static void kernelMultiplyLongs(long[] a, long[] b, long[] c, int n) {
+		for (int i = 0; i < n; i++)
+			c[i] = a[i] * b[i];
+	}
+
+	static void kernelMultiplyFloats(float[] a, float[] b, float[] c, int n) {
+		for (int i = 0; i < n; i++)
+			c[i] = a[i] * b[i];
+	}
+
+	static void kernelSubtractDoubles(double[] a, double[] b, double[] c, int n) {
+		for (int i = 0; i < n; i++)
+			c[i] = a[i] - b[i];
+	}
+
+	static void kernelShiftedAddInts(int[] a, int srcPos, int[] b, int dstPos, int n) {
+		for (int i = 0; i < n; i++)
+			b[dstPos + i] = a[srcPos + i] + 1;
+	}
+
+	static int kernelSumInts(int[] a, int n) {
+		int sum = 0;
+		for (int i = 0; i < n; i++)
+			sum += a[i];
+		return sum;
+	}
+
+	static long kernelSumLongs(long[] a, int n) {
+		long sum = 0;
+		for (int i = 0; i < n; i++)
+			sum += a[i];
+		return sum;
+	}
+
+	private static int lengthFor(int iteration) {
+		/* lengths 0 to MAX_LENGTH, with remainders of every size for each vector width */
+		return (iteration * 37) % (MAX_LENGTH + 1);
+	}
+
+	@Test
+	public void testElementWiseBytes() {
+		byte[] a = new byte[MAX_LENGTH];
+		byte[] b = new byte[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			byte[] c = new byte[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = (byte)(i + iteration);
+				b[i] = (byte)(i * 7);
+			}
+			kernelAddBytes(a, b, c, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong byte at " + i + " for length " + n, (i < n) ? (byte)(a[i] + b[i]) : 0, c[i]);
+		}
+	}
+
+	@Test
+	public void testElementWiseShorts() {
+		short[] a = new short[MAX_LENGTH];
+		short[] b = new short[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			short[] c = new short[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = (short)(i * 1000 + iteration);
+				b[i] = (short)(i * 333);
+			}
+			kernelAddShorts(a, b, c, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong short at " + i + " for length " + n, (i < n) ? (short)(a[i] + b[i]) : 0, c[i]);
+		}
+	}
+
+	@Test
+	public void testElementWiseInts() {
+		int[] a = new int[MAX_LENGTH];
+		int[] b = new int[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			int[] c = new int[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = i * 65537 + iteration;
+				b[i] = Integer.MAX_VALUE - i;
+			}
+			kernelAddInts(a, b, c, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong int at " + i + " for length " + n, (i < n) ? a[i] + b[i] : 0, c[i]);
+		}
+	}
+
+	@Test
+	public void testElementWiseLongs() {
+		long[] a = new long[MAX_LENGTH];
+		long[] b = new long[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			long[] c = new long[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = ((long)i << 33) + iteration;
+				b[i] = i - 75;
+			}
+			kernelMultiplyLongs(a, b, c, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong long at " + i + " for length " + n, (i < n) ? a[i] * b[i] : 0, c[i]);
+		}
+	}
+
+	@Test
+	public void testElementWiseFloats() {
+		float[] a = new float[MAX_LENGTH];
+		float[] b = new float[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			float[] c = new float[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = i + 0.25f * iteration;
+				b[i] = 1.5f - i;
+			}
+			kernelMultiplyFloats(a, b, c, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong float at " + i + " for length " + n, (i < n) ? a[i] * b[i] : 0.0f, c[i], 0.0f);
+		}
+	}
+
+	@Test
+	public void testElementWiseDoubles() {
+		double[] a = new double[MAX_LENGTH];
+		double[] b = new double[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			double[] c = new double[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = i * 1.125 + iteration;
+				b[i] = 0.1 * i;
+			}
+			kernelSubtractDoubles(a, b, c, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong double at " + i + " for length " + n, (i < n) ? a[i] - b[i] : 0.0, c[i], 0.0);
+		}
+	}
+
+	@Test
+	public void testElementWiseAliasing() {
+		int[] b = new int[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			int[] a = new int[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = i + iteration;
+				b[i] = i * 3;
+			}
+
+			/* result written over the first source */
+			kernelAddInts(a, b, a, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong int at " + i + " with c == a for length " + n, i + iteration + ((i < n) ? i * 3 : 0), a[i]);
+
+			/* all three arrays are the same */
+			int[] expected = a.clone();
+			for (int i = 0; i < n; i++)
+				expected[i] = expected[i] * 2;
+			kernelAddInts(a, a, a, n);
+			for (int i = 0; i < MAX_LENGTH; i++)
+				AssertJUnit.assertEquals("Wrong int at " + i + " with a == b == c for length " + n, expected[i], a[i]);
+		}
+	}
+
+	@Test
+	public void testOverlappingRanges() {
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration) / 2;
+			int distance = 1 + (iteration % 20);
+			int[] forward = new int[MAX_LENGTH];
+			int[] backward = new int[MAX_LENGTH];
+			int[] expectedForward = new int[MAX_LENGTH];
+			int[] expectedBackward = new int[MAX_LENGTH];
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				forward[i] = backward[i] = expectedForward[i] = expectedBackward[i] = i * 11;
+			}
+
+			/* each store feeds a load distance iterations later, a dependence vectorization must not break */
+			for (int i = 0; i < n; i++)
+				expectedForward[distance + i] = expectedForward[i] + 1;
+			kernelShiftedAddInts(forward, 0, forward, distance, n);
+
+			/* each load reads an element before it is overwritten */
+			for (int i = 0; i < n; i++)
+				expectedBackward[i] = expectedBackward[distance + i] + 1;
+			kernelShiftedAddInts(backward, distance, backward, 0, n);
+
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				AssertJUnit.assertEquals("Wrong int at " + i + " storing ahead by " + distance + " for length " + n, expectedForward[i], forward[i]);
+				AssertJUnit.assertEquals("Wrong int at " + i + " storing behind by " + distance + " for length " + n, expectedBackward[i], backward[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testReductions() {
+		int[] a = new int[MAX_LENGTH];
+		long[] b = new long[MAX_LENGTH];
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int n = lengthFor(iteration);
+			for (int i = 0; i < MAX_LENGTH; i++) {
+				a[i] = (i * 0x01000193) ^ iteration;
+				b[i] = ((long)i << 40) - iteration;
+			}
+			int intSum = 0;
+			long longSum = 0;
+			for (int i = 0; i < n; i++) {
+				intSum += a[i];
+				longSum += b[i];
+			}
+			AssertJUnit.assertEquals("Wrong int sum for length " + n, intSum, kernelSumInts(a, n));
+			AssertJUnit.assertEquals("Wrong long sum for length " + n, longSum, kernelSumLongs(b, n));
+		}
+	}
+}
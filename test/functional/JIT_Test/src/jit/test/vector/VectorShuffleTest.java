@@ -0,0 +1,299 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package jit.test.vector;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+import java.util.Arrays;
+
+import jdk.incubator.vector.ByteVector;
+import jdk.incubator.vector.IntVector;
+import jdk.incubator.vector.LongVector;
+import jdk.incubator.vector.ShortVector;
+import jdk.incubator.vector.VectorShuffle;
+import jdk.incubator.vector.VectorSpecies;
+
+/**
+ * Checks VectorShuffle loads, stores, boxing and Vector.rearrange against scalar results.
+ * Each kernel is run often enough to be compiled, so that VectorAPIExpansion handles the
+ * shuffle operations, and is checked on every iteration so that interpreted and compiled
+ * results are both compared.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class VectorShuffleTest {
+	private static final int ITERATIONS = 20000;
+
+	private static final VectorSpecies<Byte> B128 = ByteVector.SPECIES_128;
+	private static final VectorSpecies<Short> S128 = ShortVector.SPECIES_128;
+	private static final VectorSpecies<Integer> I128 = IntVector.SPECIES_128;
+	private static final VectorSpecies<Integer> I64 = IntVector.SPECIES_64;
+	private static final VectorSpecies<Long> L128 = LongVector.SPECIES_128;
+
+	/* a shuffle stored here escapes, so it must be boxed */
+	private static VectorShuffle<Integer> escapedShuffle;
+
+	private static int[] reversedIndexes(int length) {
+		int[] indexes = new int[length];
+		for (int i = 0; i < length; i++) {
+			indexes[i] = length - 1 - i;
+		}
+		return indexes;
+	}
+
+	private static int[] rotatedIndexes(int length, int distance) {
+		int[] indexes = new int[length];
+		for (int i = 0; i < length; i++) {
+			indexes[i] = (i + distance) % length;
+		}
+		return indexes;
+	}
+
+	private static int[] loadStoreShuffle(int[] indexes, int offset) {
+		int[] result = new int[I128.length()];
+		VectorShuffle.fromArray(I128, indexes, offset).intoArray(result, 0);
+		return result;
+	}
+
+	private static int[] iotaShuffleToArray(int start, int step) {
+		return VectorShuffle.iota(I128, start, step, true).toArray();
+	}
+
+	private static VectorShuffle<Integer> boxShuffle(int[] indexes) {
+		return VectorShuffle.fromArray(I128, indexes, 0);
+	}
+
+	private static int[] unboxShuffle(VectorShuffle<Integer> shuffle) {
+		int[] result = new int[I128.length()];
+		shuffle.intoArray(result, 0);
+		return result;
+	}
+
+	private static void escapeShuffle(int[] indexes) {
+		escapedShuffle = VectorShuffle.fromArray(I128, indexes, 0);
+	}
+
+	private static void rearrangeBytes(byte[] src, int[] indexes, byte[] dst) {
+		VectorShuffle<Byte> shuffle = VectorShuffle.fromArray(B128, indexes, 0);
+		for (int i = 0; i < B128.loopBound(src.length); i += B128.length()) {
+			ByteVector.fromArray(B128, src, i).rearrange(shuffle).intoArray(dst, i);
+		}
+	}
+
+	private static void rearrangeShorts(short[] src, int[] indexes, short[] dst) {
+		VectorShuffle<Short> shuffle = VectorShuffle.fromArray(S128, indexes, 0);
+		for (int i = 0; i < S128.loopBound(src.length); i += S128.length()) {
+			ShortVector.fromArray(S128, src, i).rearrange(shuffle).intoArray(dst, i);
+		}
+	}
+
+	private static void rearrangeInts(VectorSpecies<Integer> species, int[] src, int[] indexes, int[] dst) {
+		VectorShuffle<Integer> shuffle = VectorShuffle.fromArray(species, indexes, 0);
+		for (int i = 0; i < species.loopBound(src.length); i += species.length()) {
+			IntVector.fromArray(species, src, i).rearrange(shuffle).intoArray(dst, i);
+		}
+	}
+
+	private static void rearrangeLongs(long[] src, int[] indexes, long[] dst) {
+		VectorShuffle<Long> shuffle = VectorShuffle.fromArray(L128, indexes, 0);
+		for (int i = 0; i < L128.loopBound(src.length); i += L128.length()) {
+			LongVector.fromArray(L128, src, i).rearrange(shuffle).intoArray(dst, i);
+		}
+	}
+
+	private static int[] rearrangeInPlace(int[] data, int[] indexes) {
+		/* the shuffle is applied twice and the source and destination arrays alias */
+		VectorShuffle<Integer> shuffle = VectorShuffle.fromArray(I128, indexes, 0);
+		IntVector.fromArray(I128, data, 0).rearrange(shuffle).rearrange(shuffle).intoArray(data, 0);
+		return data;
+	}
+
+	private static int rearrangeExceptional(int[] data, int[] indexes) {
+		VectorShuffle<Integer> shuffle = VectorShuffle.fromArray(I128, indexes, 0);
+		return IntVector.fromArray(I128, data, 0).rearrange(shuffle).lane(0);
+	}
+
+	@Test
+	public void testShuffleLoadStore() {
+		int length = I128.length();
+		int[] indexes = new int[length * 2];
+		for (int i = 0; i < indexes.length; i++) {
+			indexes[i] = (i * 3) % length;
+		}
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int offset = iteration % (length + 1);
+			int[] result = loadStoreShuffle(indexes, offset);
+			for (int i = 0; i < length; i++) {
+				AssertJUnit.assertEquals("Wrong shuffle lane " + i + " at offset " + offset, indexes[offset + i], result[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testShuffleIota() {
+		int length = I128.length();
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int start = iteration % length;
+			int step = 1 + (iteration % 3);
+			int[] result = iotaShuffleToArray(start, step);
+			for (int i = 0; i < length; i++) {
+				AssertJUnit.assertEquals("Wrong iota lane " + i, (start + (i * step)) % length, result[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testShuffleBoxing() {
+		int length = I128.length();
+		int[] reversed = reversedIndexes(length);
+		int[] rotated = rotatedIndexes(length, 1);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int[] expected = (0 == (iteration & 1)) ? reversed : rotated;
+			VectorShuffle<Integer> shuffle = boxShuffle(expected);
+			AssertJUnit.assertEquals(expected.length, shuffle.length());
+			int[] result = unboxShuffle(shuffle);
+			escapeShuffle(expected);
+			int[] escaped = unboxShuffle(escapedShuffle);
+			for (int i = 0; i < length; i++) {
+				AssertJUnit.assertEquals("Wrong boxed shuffle lane " + i, expected[i], result[i]);
+				AssertJUnit.assertEquals("Wrong escaped shuffle lane " + i, expected[i], escaped[i]);
+				AssertJUnit.assertEquals("Wrong laneSource " + i, expected[i], shuffle.laneSource(i));
+			}
+		}
+	}
+
+	@Test
+	public void testRearrangeByte() {
+		int length = B128.length();
+		byte[] src = new byte[(length * 4) + 3];
+		byte[] dst = new byte[src.length];
+		for (int i = 0; i < src.length; i++) {
+			src[i] = (byte)((i * 7) - 100);
+		}
+		int[][] shuffles = { reversedIndexes(length), rotatedIndexes(length, 5) };
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int[] indexes = shuffles[iteration & 1];
+			rearrangeBytes(src, indexes, dst);
+			for (int i = 0; i < B128.loopBound(src.length); i++) {
+				int base = i - (i % length);
+				AssertJUnit.assertEquals("Wrong byte lane " + i, src[base + indexes[i % length]], dst[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testRearrangeShort() {
+		int length = S128.length();
+		short[] src = new short[(length * 4) + 3];
+		short[] dst = new short[src.length];
+		for (int i = 0; i < src.length; i++) {
+			src[i] = (short)((i * 1009) - 30000);
+		}
+		int[][] shuffles = { reversedIndexes(length), rotatedIndexes(length, 3) };
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int[] indexes = shuffles[iteration & 1];
+			rearrangeShorts(src, indexes, dst);
+			for (int i = 0; i < S128.loopBound(src.length); i++) {
+				int base = i - (i % length);
+				AssertJUnit.assertEquals("Wrong short lane " + i, src[base + indexes[i % length]], dst[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testRearrangeInt() {
+		for (VectorSpecies<Integer> species : Arrays.asList(I64, I128)) {
+			int length = species.length();
+			int[] src = new int[(length * 4) + 1];
+			int[] dst = new int[src.length];
+			for (int i = 0; i < src.length; i++) {
+				src[i] = (i * 65537) ^ 0x5a5a5a5a;
+			}
+			int[][] shuffles = { reversedIndexes(length), rotatedIndexes(length, 1), new int[length] };
+			for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+				int[] indexes = shuffles[iteration % shuffles.length];
+				rearrangeInts(species, src, indexes, dst);
+				for (int i = 0; i < species.loopBound(src.length); i++) {
+					int base = i - (i % length);
+					AssertJUnit.assertEquals("Wrong int lane " + i + " for " + species, src[base + indexes[i % length]], dst[i]);
+				}
+			}
+		}
+	}
+
+	@Test
+	public void testRearrangeLong() {
+		int length = L128.length();
+		long[] src = new long[(length * 4) + 1];
+		long[] dst = new long[src.length];
+		for (int i = 0; i < src.length; i++) {
+			src[i] = ((long)i << 40) | (i * 31);
+		}
+		int[][] shuffles = { reversedIndexes(length), new int[length] };
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int[] indexes = shuffles[iteration & 1];
+			rearrangeLongs(src, indexes, dst);
+			for (int i = 0; i < L128.loopBound(src.length); i++) {
+				int base = i - (i % length);
+				AssertJUnit.assertEquals("Wrong long lane " + i, src[base + indexes[i % length]], dst[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testRearrangeInPlace() {
+		int length = I128.length();
+		int[] indexes = rotatedIndexes(length, 1);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			int[] data = new int[length];
+			for (int i = 0; i < length; i++) {
+				data[i] = iteration + i;
+			}
+			rearrangeInPlace(data, indexes);
+			for (int i = 0; i < length; i++) {
+				AssertJUnit.assertEquals("Wrong in place lane " + i, iteration + ((i + 2) % length), data[i]);
+			}
+		}
+	}
+
+	@Test
+	public void testRearrangeExceptionalIndex() {
+		int length = I128.length();
+		int[] data = new int[length];
+		int[] valid = rotatedIndexes(length, 1);
+		int[] exceptional = rotatedIndexes(length, 1);
+		exceptional[length - 1] = length + 1;
+		for (int i = 0; i < length; i++) {
+			data[i] = i * 10;
+		}
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			AssertJUnit.assertEquals(data[1], rearrangeExceptional(data, valid));
+			if (0 == (iteration % 100)) {
+				try {
+					rearrangeExceptional(data, exceptional);
+					AssertJUnit.fail("Out of range shuffle index did not throw");
+				} catch (IndexOutOfBoundsException e) {
+					/* expected */
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,125 @@
+package org.openj9.test.benchmark;
+
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+import java.io.BufferedReader;
+import java.io.FileReader;
+import java.io.IOException;
+import java.util.concurrent.CountDownLatch;
+
+/**
+ * Measures the resident memory per parked virtual thread. Each virtual thread first
+ * calls down to the given depth, so that its stack grows, and then parks with a
+ * shallow stack. Compare runs with -XX:+TrimContinuationStacks and
+ * -XX:-TrimContinuationStacks. Only supported on Linux, where the resident set
+ * size is read from /proc/self/status.
+ */
+public class ParkedVirtualThreadBenchmark {
+	private static volatile long sink;
+
+	public static void main(String[] args) throws Exception {
+		/* check the arguments */
+		if (args.length < 2) {
+			System.out.println("ERROR: Missing required arguments !");
+			System.out.println("	First argument is the number of virtual threads");
+			System.out.println("	Second argument is the call depth reached by each virtual thread before parking");
+			return;
+		}
+
+		final int numThreads;
+		final int depth;
+		try {
+			numThreads = Integer.parseInt(args[0]);
+			depth = Integer.parseInt(args[1]);
+		} catch (NumberFormatException e) {
+			System.out.println("ERROR: failed to parse arguments: " + e);
+			return;
+		}
+
+		final CountDownLatch parked = new CountDownLatch(numThreads);
+		final CountDownLatch release = new CountDownLatch(1);
+		Thread[] threads = new Thread[numThreads];
+
+		Runnable task = new Runnable() {
+			public void run() {
+				sink += recurse(depth);
+				parked.countDown();
+				try {
+					release.await();
+				} catch (InterruptedException e) {
+					/* exit */
+				}
+			}
+		};
+
+		System.gc();
+		long rssBefore = readResidentBytes();
+
+		long startTime = System.nanoTime();
+		for (int t = 0; t < numThreads; t++) {
+			threads[t] = Thread.ofVirtual().start(task);
+		}
+		parked.await();
+		long endTime = System.nanoTime();
+
+		System.gc();
+		long rssParked = readResidentBytes();
+
+		release.countDown();
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].join();
+		}
+
+		System.out.println("Virtual threads: " + numThreads + ", call depth: " + depth);
+		System.out.println("Number of nanoseconds to start and park all threads: " + (endTime - startTime));
+		if ((rssBefore < 0) || (rssParked < 0)) {
+			System.out.println("Resident set size is not available on this platform");
+		} else {
+			System.out.println("Resident bytes per parked virtual thread: " + ((rssParked - rssBefore) / numThreads));
+		}
+	}
+
+	private static long recurse(int depth) {
+		long a = depth;
+		long b = depth * 31L;
+		if (depth > 0) {
+			a += recurse(depth - 1);
+		}
+		return a ^ b;
+	}
+
+	private static long readResidentBytes() {
+		try (BufferedReader reader = new BufferedReader(new FileReader("/proc/self/status"))) {
+			String line;
+			while (null != (line = reader.readLine())) {
+				if (line.startsWith("VmRSS:")) {
+					String[] parts = line.substring("VmRSS:".length()).trim().split("\\s+");
+					return Long.parseLong(parts[0]) * 1024;
+				}
+			}
+		} catch (IOException | NumberFormatException e) {
+			/* fall through */
+		}
+		return -1;
+	}
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test.jep454.downcall;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+
+import java.lang.foreign.Arena;
+import java.lang.foreign.FunctionDescriptor;
+import java.lang.foreign.GroupLayout;
+import java.lang.foreign.Linker;
+import java.lang.foreign.MemoryLayout;
+import java.lang.foreign.MemoryLayout.PathElement;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.SegmentAllocator;
+import java.lang.foreign.SymbolLookup;
+import static java.lang.foreign.ValueLayout.ADDRESS;
+import static java.lang.foreign.ValueLayout.JAVA_BYTE;
+import static java.lang.foreign.ValueLayout.JAVA_DOUBLE;
+import static java.lang.foreign.ValueLayout.JAVA_FLOAT;
+import static java.lang.foreign.ValueLayout.JAVA_INT;
+import static java.lang.foreign.ValueLayout.JAVA_LONG;
+import static java.lang.foreign.ValueLayout.JAVA_SHORT;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.VarHandle;
+
+/**
+ * Test cases for JEP 454: Foreign Linker API for downcalls with integer and floating point
+ * arguments in mixed order.
+ *
+ * Note:
+ * On x86-64 System V, downcalls whose arguments all fit in the argument registers are called
+ * directly rather than via ffi_call, placing the integer and floating point arguments in separate
+ * register sequences. The test suite covers signatures on both sides of that limit as well as
+ * struct returns, which are always called via ffi_call.
+ */
+@Test(groups = { "level.sanity" })
+public class DirectDowncallTests {
+	private static boolean isAixOS = System.getProperty("os.name").toLowerCase().contains("aix");
+	private static Linker linker = Linker.nativeLinker();
+
+	static {
+		System.loadLibrary("clinkerffitests");
+	}
+	private static final SymbolLookup nativeLibLookup = SymbolLookup.loaderLookup();
+
+	@Test
+	public void test_addMixedIntsAndFloats_returnDouble() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_DOUBLE, JAVA_INT, JAVA_FLOAT, JAVA_LONG,
+				JAVA_DOUBLE, JAVA_SHORT, JAVA_FLOAT, JAVA_BYTE, JAVA_DOUBLE);
+		MemorySegment functionSymbol = nativeLibLookup.find("addMixedIntsAndFloats_returnDouble").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+		double result = (double)mh.invokeExact(112, 2.5F, 3000000000L, 4.25D, (short)-5, 6.5F, (byte)-7, 8.75D);
+		Assert.assertEquals(result, 3000000122.0D, 0.0001D);
+	}
+
+	@Test
+	public void test_addMixedIntsAndFloats_returnFloat() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_FLOAT, JAVA_FLOAT, JAVA_INT, JAVA_DOUBLE, JAVA_LONG);
+		MemorySegment functionSymbol = nativeLibLookup.find("addMixedIntsAndFloats_returnFloat").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+		float result = (float)mh.invokeExact(1.5F, 20, 3.25D, 400L);
+		Assert.assertEquals(result, 424.75F, 0.0001F);
+	}
+
+	@Test
+	public void test_addMixedIntsAndFloats_returnLong() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_LONG, JAVA_DOUBLE, JAVA_LONG, JAVA_FLOAT, JAVA_INT);
+		MemorySegment functionSymbol = nativeLibLookup.find("addMixedIntsAndFloats_returnLong").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+		long result = (long)mh.invokeExact(1.75D, 5000000000L, 2.5F, -3);
+		Assert.assertEquals(result, 5000000001L);
+	}
+
+	@Test
+	public void test_addIntFromPointerAndFloatAndDoubleFromPointer() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_DOUBLE, ADDRESS, JAVA_FLOAT, ADDRESS);
+		MemorySegment functionSymbol = nativeLibLookup.find("addIntFromPointerAndFloatAndDoubleFromPointer").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+
+		try (Arena arena = Arena.ofConfined()) {
+			MemorySegment intSegmt = arena.allocateFrom(JAVA_INT, 10);
+			MemorySegment doubleSegmt = arena.allocateFrom(JAVA_DOUBLE, 3.25D);
+			double result = (double)mh.invokeExact(intSegmt, 2.5F, doubleSegmt);
+			Assert.assertEquals(result, 15.75D, 0.0001D);
+		}
+	}
+
+	@Test
+	public void test_add6IntsAnd8Doubles() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE,
+				JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE,
+				JAVA_DOUBLE, JAVA_DOUBLE);
+		MemorySegment functionSymbol = nativeLibLookup.find("add6IntsAnd8Doubles").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+		/* Each argument is its position, so the weighted sum is the sum of the squares from 1 to 14. */
+		double result = (double)mh.invokeExact(1, 2.0D, 3, 4.0D, 5, 6.0D, 7, 8.0D, 9, 10.0D, 11, 12.0D, 13.0D, 14.0D);
+		Assert.assertEquals(result, 1015.0D, 0.0001D);
+	}
+
+	@Test
+	public void test_add7IntsAnd9Doubles() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE,
+				JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE,
+				JAVA_INT, JAVA_DOUBLE, JAVA_DOUBLE, JAVA_DOUBLE);
+		MemorySegment functionSymbol = nativeLibLookup.find("add7IntsAnd9Doubles").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+		/* Each argument is its position, so the weighted sum is the sum of the squares from 1 to 16. */
+		double result = (double)mh.invokeExact(1, 2.0D, 3, 4.0D, 5, 6.0D, 7, 8.0D, 9, 10.0D, 11, 12.0D, 13, 14.0D, 15.0D, 16.0D);
+		Assert.assertEquals(result, 1496.0D, 0.0001D);
+	}
+
+	@Test
+	public void test_addMixedIntsAndDoubles_returnStruct() throws Throwable {
+		/* The size of [int, double] on AIX/PPC 64-bit is 12 bytes without padding by default
+		 * while the same struct is 16 bytes with padding on other platforms.
+		 */
+		GroupLayout structLayout = isAixOS ? MemoryLayout.structLayout(JAVA_INT.withName("elem1"),
+				JAVA_DOUBLE.withName("elem2")) : MemoryLayout.structLayout(JAVA_INT.withName("elem1"),
+						MemoryLayout.paddingLayout(JAVA_INT.byteSize()), JAVA_DOUBLE.withName("elem2"));
+		VarHandle elemHandle1 = structLayout.varHandle(PathElement.groupElement("elem1"));
+		VarHandle elemHandle2 = structLayout.varHandle(PathElement.groupElement("elem2"));
+
+		FunctionDescriptor fd = FunctionDescriptor.of(structLayout, JAVA_INT, JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE);
+		MemorySegment functionSymbol = nativeLibLookup.find("addMixedIntsAndDoubles_returnStruct").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+
+		try (Arena arena = Arena.ofConfined()) {
+			MemorySegment resultSegmt = (MemorySegment)mh.invokeExact((SegmentAllocator)arena, 3, 1.5D, 4, 2.25D);
+			Assert.assertEquals(elemHandle1.get(resultSegmt, 0L), 7);
+			Assert.assertEquals((double)elemHandle2.get(resultSegmt, 0L), 3.75D, 0.0001D);
+		}
+	}
+
+	@Test
+	public void test_mixedSignaturesInCompiledCaller() throws Throwable {
+		FunctionDescriptor fd1 = FunctionDescriptor.of(JAVA_FLOAT, JAVA_FLOAT, JAVA_INT, JAVA_DOUBLE, JAVA_LONG);
+		MethodHandle mh1 = linker.downcallHandle(nativeLibLookup.find("addMixedIntsAndFloats_returnFloat").get(), fd1);
+		FunctionDescriptor fd2 = FunctionDescriptor.of(JAVA_LONG, JAVA_DOUBLE, JAVA_LONG, JAVA_FLOAT, JAVA_INT);
+		MethodHandle mh2 = linker.downcallHandle(nativeLibLookup.find("addMixedIntsAndFloats_returnLong").get(), fd2);
+
+		/* Call often enough for the caller to be compiled, checking the arguments are still placed correctly. */
+		for (int i = 0; i < 20000; i++) {
+			float floatResult = (float)mh1.invokeExact(0.5F, i, 0.25D, -1L);
+			Assert.assertEquals(floatResult, i - 0.25F, 0.0001F);
+			long longResult = (long)mh2.invokeExact(0.5D, (long)i, 0.5F, i);
+			Assert.assertEquals(longResult, (2L * i) + 1);
+		}
+	}
+}
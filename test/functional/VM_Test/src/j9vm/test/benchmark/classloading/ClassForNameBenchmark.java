@@ -0,0 +1,113 @@
+package j9vm.test.benchmark.classloading;
+
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+/**
+ * Measures the throughput of Class.forName() lookups of already loaded classes from a
+ * number of threads, which only read the class hash tables of the class loaders.
+ */
+public class ClassForNameBenchmark {
+	private static final String[] CLASS_NAMES = {
+		"java.lang.Object",
+		"java.lang.String",
+		"java.lang.Integer",
+		"java.lang.Thread",
+		"java.lang.StringBuilder",
+		"java.util.ArrayList",
+		"java.util.HashMap",
+		"java.util.concurrent.ConcurrentHashMap",
+		"java.io.File",
+		"java.io.InputStream",
+		"j9vm.test.benchmark.classloading.ClassForNameBenchmark",
+	};
+
+	public static void main(String[] args) throws Exception {
+		/* check the arguments */
+		if (args.length < 2) {
+			System.out.println("ERROR: Missing required arguments !");
+			System.out.println("	First argument is the number of threads");
+			System.out.println("	Second argument is the number of lookups per thread");
+			return;
+		}
+
+		final int numThreads;
+		final long iterations;
+		try {
+			numThreads = Integer.parseInt(args[0]);
+			iterations = Long.parseLong(args[1]);
+		} catch (NumberFormatException e) {
+			System.out.println("ERROR: failed to parse arguments: " + e);
+			return;
+		}
+
+		final ClassLoader loader = ClassForNameBenchmark.class.getClassLoader();
+
+		/* load all the classes up front so that the timed loop only measures lookups */
+		for (int i = 0; i < CLASS_NAMES.length; i++) {
+			Class.forName(CLASS_NAMES[i], false, loader);
+		}
+
+		final Throwable[] failures = new Throwable[numThreads];
+		Thread[] threads = new Thread[numThreads];
+		for (int t = 0; t < numThreads; t++) {
+			final int id = t;
+			threads[t] = new Thread() {
+				public void run() {
+					try {
+						int index = id % CLASS_NAMES.length;
+						for (long i = 0; i < iterations; i++) {
+							Class.forName(CLASS_NAMES[index], false, loader);
+							index += 1;
+							if (CLASS_NAMES.length == index) {
+								index = 0;
+							}
+						}
+					} catch (Throwable e) {
+						failures[id] = e;
+					}
+				}
+			};
+		}
+
+		long startTime = System.nanoTime();
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].start();
+		}
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].join();
+		}
+		long endTime = System.nanoTime();
+
+		for (int t = 0; t < numThreads; t++) {
+			if (null != failures[t]) {
+				System.out.println("ERROR: lookup failed in thread " + t + ": " + failures[t]);
+				return;
+			}
+		}
+
+		long total = numThreads * iterations;
+		System.out.println("Threads: " + numThreads + ", lookups: " + total);
+		System.out.println("Number of nanoseconds for all lookups: " + (endTime - startTime));
+		System.out.println("Lookups per second: " + ((total * 1000000000L) / Math.max(1, endTime - startTime)));
+	}
+}
@@ -0,0 +1,104 @@
+package j9vm.test.benchmark.monitor;
+
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+/**
+ * Measures the throughput of monitor enter/exit on objects whose monitors live in the VM
+ * monitor table, from a number of threads.
+ *
+ * Arrays have no lockword, so every synchronized block on an array goes through the monitor
+ * table lookup. The pool of arrays is much larger than the per-thread monitor lookup cache,
+ * so most lookups miss in the cache and search the table shared by all threads.
+ */
+public class MonitorTableBenchmark {
+	private static final int POOL_SIZE = 64 * 1024;
+
+	public static void main(String[] args) throws InterruptedException {
+		/* check the arguments */
+		if (args.length < 2) {
+			System.out.println("ERROR: Missing required arguments !");
+			System.out.println("	First argument is the number of threads");
+			System.out.println("	Second argument is the number of monitor enters per thread");
+			return;
+		}
+
+		final int numThreads;
+		final long iterations;
+		try {
+			numThreads = Integer.parseInt(args[0]);
+			iterations = Long.parseLong(args[1]);
+		} catch (NumberFormatException e) {
+			System.out.println("ERROR: failed to parse arguments: " + e);
+			return;
+		}
+
+		final Object[] pool = new Object[POOL_SIZE];
+		for (int i = 0; i < POOL_SIZE; i++) {
+			pool[i] = new byte[1];
+		}
+
+		/* inflate all the monitors up front so that the timed loop measures lookups */
+		for (int i = 0; i < POOL_SIZE; i++) {
+			synchronized (pool[i]) {
+				/* nothing to do */
+			}
+		}
+
+		final long[] counts = new long[numThreads];
+		Thread[] threads = new Thread[numThreads];
+		for (int t = 0; t < numThreads; t++) {
+			final int id = t;
+			threads[t] = new Thread() {
+				public void run() {
+					/* each thread walks the pool with a different stride to spread the lookups */
+					int index = id;
+					int stride = 2 * id + 1;
+					long count = 0;
+					for (long i = 0; i < iterations; i++) {
+						Object lock = pool[index];
+						synchronized (lock) {
+							count += 1;
+						}
+						index = (index + stride) & (POOL_SIZE - 1);
+					}
+					counts[id] = count;
+				}
+			};
+		}
+
+		long startTime = System.nanoTime();
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].start();
+		}
+		long total = 0;
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].join();
+			total += counts[t];
+		}
+		long endTime = System.nanoTime();
+
+		System.out.println("Threads: " + numThreads + ", monitor enters: " + total);
+		System.out.println("Number of nanoseconds for all monitor enters: " + (endTime - startTime));
+		System.out.println("Monitor enters per second: " + ((total * 1000000000L) / Math.max(1, endTime - startTime)));
+	}
+}
@@ -0,0 +1,200 @@
+package j9vm.test.benchmark.simd;
+
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+/**
+ * Measures simple counted array loops of the kind the JIT auto-vectorizes at hot and scorching:
+ * element-wise kernels over each primitive element width and integer reductions.
+ *
+ * Run it once as is and once with -Xjit:disableAutoSIMD to compare vectorized and scalar code.
+ * The array length should be varied as well; short arrays whose length is below one trip of the
+ * vectorized loop body run entirely in the scalar residue loop.
+ */
+public class ArrayKernelBenchmark {
+	static void addBytes(byte[] a, byte[] b, byte[] c) {
+		for (int i = 0; i < a.length; i++) {
+			c[i] = (byte)(a[i] + b[i]);
+		}
+	}
+
+	static void addShorts(short[] a, short[] b, short[] c) {
+		for (int i = 0; i < a.length; i++) {
+			c[i] = (short)(a[i] + b[i]);
+		}
+	}
+
+	static void addInts(int[] a, int[] b, int[] c) {
+		for (int i = 0; i < a.length; i++) {
+			c[i] = a[i] + b[i];
+		}
+	}
+
+	static void addLongs(long[] a, long[] b, long[] c) {
+		for (int i = 0; i < a.length; i++) {
+			c[i] = a[i] + b[i];
+		}
+	}
+
+	static void multiplyFloats(float[] a, float[] b, float[] c) {
+		for (int i = 0; i < a.length; i++) {
+			c[i] = a[i] * b[i];
+		}
+	}
+
+	static void multiplyDoubles(double[] a, double[] b, double[] c) {
+		for (int i = 0; i < a.length; i++) {
+			c[i] = a[i] * b[i];
+		}
+	}
+
+	static int sumInts(int[] a) {
+		int sum = 0;
+		for (int i = 0; i < a.length; i++) {
+			sum += a[i];
+		}
+		return sum;
+	}
+
+	static long sumLongs(long[] a) {
+		long sum = 0;
+		for (int i = 0; i < a.length; i++) {
+			sum += a[i];
+		}
+		return sum;
+	}
+
+	private static void report(String kernel, long nanos, int length, long repetitions) {
+		System.out.println(kernel + ": " + nanos + " ns, "
+				+ ((double)nanos / ((double)length * (double)repetitions)) + " ns per element");
+	}
+
+	public static void main(String[] args) {
+		/* check the arguments */
+		if (args.length < 2) {
+			System.out.println("ERROR: Missing required arguments !");
+			System.out.println("	First argument is the array length");
+			System.out.println("	Second argument is the number of times to run each kernel");
+			return;
+		}
+
+		final int length;
+		final long repetitions;
+		try {
+			length = Integer.parseInt(args[0]);
+			repetitions = Long.parseLong(args[1]);
+		} catch (NumberFormatException e) {
+			System.out.println("ERROR: failed to parse arguments: " + e);
+			return;
+		}
+		if (length < 1) {
+			System.out.println("ERROR: the array length must be at least 1");
+			return;
+		}
+
+		byte[] b1 = new byte[length], b2 = new byte[length], b3 = new byte[length];
+		short[] s1 = new short[length], s2 = new short[length], s3 = new short[length];
+		int[] i1 = new int[length], i2 = new int[length], i3 = new int[length];
+		long[] l1 = new long[length], l2 = new long[length], l3 = new long[length];
+		float[] f1 = new float[length], f2 = new float[length], f3 = new float[length];
+		double[] d1 = new double[length], d2 = new double[length], d3 = new double[length];
+		for (int i = 0; i < length; i++) {
+			b1[i] = (byte)i;
+			b2[i] = (byte)(i * 3);
+			s1[i] = (short)i;
+			s2[i] = (short)(i * 3);
+			i1[i] = i;
+			i2[i] = i * 3;
+			l1[i] = i;
+			l2[i] = (long)i * 3;
+			f1[i] = i;
+			f2[i] = 0.5f;
+			d1[i] = i;
+			d2[i] = 0.5;
+		}
+
+		/* run every kernel until it has been compiled at the highest optimization level before timing it */
+		long warmup = Math.max(repetitions / 10, 100000L);
+		long checksum = 0;
+		for (long r = 0; r < warmup; r++) {
+			addBytes(b1, b2, b3);
+			addShorts(s1, s2, s3);
+			addInts(i1, i2, i3);
+			addLongs(l1, l2, l3);
+			multiplyFloats(f1, f2, f3);
+			multiplyDoubles(d1, d2, d3);
+			checksum += sumInts(i1) + sumLongs(l1);
+		}
+
+		long startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			addBytes(b1, b2, b3);
+		}
+		report("byte add", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			addShorts(s1, s2, s3);
+		}
+		report("short add", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			addInts(i1, i2, i3);
+		}
+		report("int add", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			addLongs(l1, l2, l3);
+		}
+		report("long add", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			multiplyFloats(f1, f2, f3);
+		}
+		report("float multiply", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			multiplyDoubles(d1, d2, d3);
+		}
+		report("double multiply", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			checksum += sumInts(i1);
+		}
+		report("int sum", System.nanoTime() - startTime, length, repetitions);
+
+		startTime = System.nanoTime();
+		for (long r = 0; r < repetitions; r++) {
+			checksum += sumLongs(l1);
+		}
+		report("long sum", System.nanoTime() - startTime, length, repetitions);
+
+		/* keep the results live */
+		checksum += b3[length / 2] + s3[length / 2] + i3[length / 2] + l3[length / 2] + (long)f3[length / 2] + (long)d3[length / 2];
+		System.out.println("Checksum: " + checksum);
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package j9vm.test.mapzipfiles;
+
+import java.io.File;
+import java.lang.reflect.Method;
+
+/**
+ * Loads classes from jars appended to the bootstrap class path, which the VM reads
+ * through its zip cache, while running with -XX:+MapZipFiles.
+ * Its usage is as follows:
+ * 		java MapZipFilesTest <deflated jar> <replacement jar>
+ * 			where <deflated jar> is on the bootstrap class path and is replaced by
+ * 			<replacement jar> before the last class is loaded.
+ */
+public class MapZipFilesTest {
+	public static void main(String args[]) throws Exception {
+		if (args.length != 2) {
+			System.err.println("Usage: java MapZipFilesTest <deflated jar> <replacement jar>");
+			System.exit(1);
+		}
+
+		loadClass("j9vm.test.mapzipfiles.StoredEntry");
+		loadClass("j9vm.test.mapzipfiles.DeflatedEntry");
+
+		/* Replace the jar on disk by renaming another file over it. The VM keeps the
+		 * original file open, so its classes must still be read from the original contents.
+		 */
+		File jar = new File(args[0]);
+		File replacement = new File(args[1]);
+		if (!replacement.renameTo(jar)) {
+			System.err.println("Error: Failed to rename " + replacement + " to " + jar);
+			return;
+		}
+		System.err.println("Jarfile has been replaced");
+
+		loadClass("j9vm.test.mapzipfiles.LateEntry");
+	}
+
+	public static void loadClass(String className) throws Exception {
+		Class<?> clazz = Class.forName(className);
+		if (clazz.getClassLoader() != null) {
+			System.err.println("Error: " + className + " was not loaded by the bootstrap class loader");
+			return;
+		}
+		Method m = clazz.getMethod("describe", (Class[])null);
+		System.err.println("Loaded " + m.invoke(null, (Object[])null));
+	}
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package j9vm.test.mapzipfiles;
+
+import java.io.BufferedReader;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.InputStreamReader;
+import java.util.zip.CRC32;
+import java.util.zip.ZipEntry;
+import java.util.zip.ZipOutputStream;
+
+import j9vm.runner.Runner;
+
+/**
+ * This test ensures that classes are read correctly from mapped zip files (-XX:+MapZipFiles).
+ * It builds the following jars and appends the first two to the bootstrap class path:
+ * 1. A jar holding StoredEntry as a stored (uncompressed) entry.
+ * 2. A jar holding DeflatedEntry and LateEntry as deflated entries.
+ * 3. A replacement for the second jar that only holds DeflatedEntry.
+ * MapZipFilesTest loads StoredEntry and DeflatedEntry, renames the replacement over the
+ * second jar and then loads LateEntry, which must still be found in the original jar.
+ */
+public class MapZipFilesTestRunner extends Runner {
+	private static final String PACKAGE_PATH = "j9vm/test/mapzipfiles/";
+	private static final String EXPECTED_OUTPUT[] = { "Loaded StoredEntry", "Loaded DeflatedEntry", "Jarfile has been replaced", "Loaded LateEntry" };
+
+	private String storedJar, deflatedJar, replacementJar;
+
+	public MapZipFilesTestRunner(String className, String exeName,
+			String bootClassPath, String userClassPath, String javaVersion) throws IOException {
+		super(className, exeName, bootClassPath, userClassPath, javaVersion);
+		storedJar = createJar("MapZipFilesStored", ZipEntry.STORED, "StoredEntry");
+		deflatedJar = createJar("MapZipFilesDeflated", ZipEntry.DEFLATED, "DeflatedEntry", "LateEntry");
+		replacementJar = createJar("MapZipFilesReplacement", ZipEntry.DEFLATED, "DeflatedEntry");
+	}
+
+	private byte[] readClassBytes(String className) throws IOException {
+		InputStream in = this.getClass().getClassLoader().getResourceAsStream(PACKAGE_PATH + className + ".class");
+		ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		int count = -1;
+		byte[] data = new byte[128];
+		while ((count = in.read(data)) != -1) {
+			baos.write(data, 0, count);
+		}
+		in.close();
+		return baos.toByteArray();
+	}
+
+	private String createJar(String jarName, int method, String... classNames) throws IOException {
+		File tempFile = File.createTempFile(jarName, ".jar");
+		tempFile.deleteOnExit();
+		ZipOutputStream zos = new ZipOutputStream(new FileOutputStream(tempFile));
+		zos.setMethod(method);
+		for (String className : classNames) {
+			byte[] bytes = readClassBytes(className);
+			ZipEntry entry = new ZipEntry(PACKAGE_PATH + className + ".class");
+			if (ZipEntry.STORED == method) {
+				CRC32 crc = new CRC32();
+				crc.update(bytes);
+				entry.setSize(bytes.length);
+				entry.setCompressedSize(bytes.length);
+				entry.setCrc(crc.getValue());
+			}
+			zos.putNextEntry(entry);
+			zos.write(bytes);
+			zos.closeEntry();
+		}
+		zos.close();
+		System.out.println("Created " + tempFile.getAbsolutePath());
+		return tempFile.getAbsolutePath();
+	}
+
+	/* Overrides method in j9vm.runner.Runner. */
+	public String getCustomCommandLineOptions() {
+		String customOptions = super.getCustomCommandLineOptions();
+		customOptions += "-XX:+MapZipFiles -Xbootclasspath/a:" + storedJar + File.pathSeparator + deflatedJar + " ";
+		return customOptions;
+	}
+
+	/* Overrides method in j9vm.runner.Runner. */
+	public String getTestClassArguments() {
+		return deflatedJar + " " + replacementJar;
+	}
+
+	/* Overrides method in j9vm.runner.Runner. */
+	public boolean run() {
+		boolean success = super.run();
+		if (success) {
+			byte[] stdErr = errCollector.getOutputAsByteArray();
+			try {
+				success = analyze(stdErr);
+			} catch (Exception e) {
+				success = false;
+				System.out.println("Unexpected Exception:");
+				e.printStackTrace();
+			}
+		}
+		return success;
+	}
+
+	public boolean analyze(byte[] stdErr) throws IOException {
+		BufferedReader in = new BufferedReader(new InputStreamReader(
+				new ByteArrayInputStream(stdErr)));
+		int matched = 0;
+		String line = in.readLine();
+		while (line != null) {
+			if (line.startsWith("Error:")) {
+				System.out.println(line);
+				return false;
+			}
+			if ((matched < EXPECTED_OUTPUT.length) && line.equals(EXPECTED_OUTPUT[matched])) {
+				matched += 1;
+			}
+			line = in.readLine();
+		}
+		if (matched < EXPECTED_OUTPUT.length) {
+			System.out.println("Error: Did not find \"" + EXPECTED_OUTPUT[matched] + "\" in the output");
+			return false;
+		}
+		return true;
+	}
+}
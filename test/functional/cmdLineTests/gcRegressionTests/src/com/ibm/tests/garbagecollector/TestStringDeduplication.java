@@ -0,0 +1,140 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.lang.reflect.Field;
+import java.util.IdentityHashMap;
+
+/**
+ * Keeps many Strings with equal contents but distinct backing arrays alive while driving collections,
+ * so that -XXgc:stringDeduplication shares their arrays, then checks that every String still has its
+ * original contents. Where String.value is accessible, it also checks that Strings sharing an array
+ * have equal contents and that some arrays were shared.
+ *
+ * Arguments: the number of seconds to allocate for, and the number of megabytes of other data to keep
+ * alive meanwhile (a large value relative to -Xmx makes balanced copy-forward run out of space and abort).
+ */
+public class TestStringDeduplication
+{
+	private static final int DISTINCT_VALUES = 256;
+	private static final int COPIES = 32;
+
+	public static Object _garbageHolder;
+
+	private static String expectedValue(int index)
+	{
+		StringBuilder builder = new StringBuilder("deduplication candidate ");
+		builder.append(index);
+		for (int i = 0; i < (index % 7); i++) {
+			builder.append(" \u00e9\u4e2d");
+		}
+		return builder.toString();
+	}
+
+	public static void main(String[] args) throws Exception
+	{
+		if (2 != args.length) {
+			System.err.println("Usage: TestStringDeduplication <seconds> <retained megabytes>");
+			System.exit(1);
+		}
+		int seconds = Integer.parseInt(args[0]);
+		int retainedMegabytes = Integer.parseInt(args[1]);
+
+		String[][] strings = new String[DISTINCT_VALUES][COPIES];
+		for (int value = 0; value < DISTINCT_VALUES; value++) {
+			char[] chars = expectedValue(value).toCharArray();
+			for (int copy = 0; copy < COPIES; copy++) {
+				/* each copy gets its own backing array */
+				strings[value][copy] = new String(chars);
+			}
+		}
+
+		byte[][] retained = new byte[retainedMegabytes * 16][];
+		for (int i = 0; i < retained.length; i++) {
+			retained[i] = new byte[64 * 1024];
+		}
+
+		long finishTime = System.currentTimeMillis() + (seconds * 1000L);
+		int round = 0;
+		while (System.currentTimeMillis() < finishTime) {
+			for (int i = 0; i < 1024; i++) {
+				_garbageHolder = new byte[1024];
+			}
+			if (0 != retained.length) {
+				/* replace some retained data so that older regions keep being collected */
+				retained[round % retained.length] = new byte[64 * 1024];
+			}
+			round += 1;
+			if (0 == (round % 2048)) {
+				System.gc();
+			}
+		}
+		System.gc();
+
+		int failures = 0;
+		for (int value = 0; value < DISTINCT_VALUES; value++) {
+			String expected = expectedValue(value);
+			for (int copy = 0; copy < COPIES; copy++) {
+				String actual = strings[value][copy];
+				if (!expected.equals(actual) || (expected.hashCode() != actual.hashCode())) {
+					System.out.println("FAIL: String " + value + "/" + copy + " changed to \"" + actual + "\"");
+					failures += 1;
+				}
+			}
+		}
+
+		Field valueField = null;
+		try {
+			valueField = String.class.getDeclaredField("value");
+			valueField.setAccessible(true);
+		} catch (RuntimeException e) {
+			/* String.value is not accessible from this module; the contents have been checked above */
+			valueField = null;
+		}
+		if (null != valueField) {
+			IdentityHashMap<Object, Integer> owners = new IdentityHashMap<Object, Integer>();
+			int shared = 0;
+			for (int value = 0; value < DISTINCT_VALUES; value++) {
+				for (int copy = 0; copy < COPIES; copy++) {
+					Object array = valueField.get(strings[value][copy]);
+					Integer owner = owners.put(array, Integer.valueOf(value));
+					if (null == owner) {
+						continue;
+					}
+					if (value == owner.intValue()) {
+						shared += 1;
+					} else {
+						System.out.println("FAIL: Strings " + owner + " and " + value + " share a backing array");
+						failures += 1;
+					}
+				}
+			}
+			System.out.println("Backing arrays shared: " + shared);
+		}
+
+		if (0 == failures) {
+			System.out.println("String deduplication test passed");
+		} else {
+			System.out.println("String deduplication test failed");
+		}
+	}
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.util.Iterator;
+import java.util.zip.GZIPInputStream;
+
+import com.ibm.dtfj.image.Image;
+import com.ibm.dtfj.image.ImageAddressSpace;
+import com.ibm.dtfj.image.ImageProcess;
+import com.ibm.dtfj.java.JavaHeap;
+import com.ibm.dtfj.java.JavaObject;
+import com.ibm.dtfj.java.JavaRuntime;
+import com.ibm.dtfj.phd.PHDImageFactory;
+
+/**
+ * Writes and validates portable heap dumps.
+ *
+ * "dump <count>" keeps the given number of Marker objects reachable until the VM stops, so that a
+ * heap dump agent triggered on vmstop writes them all. "verify <file> <count>" reads the heap dump
+ * back with the DTFJ PHD reader, decompressing it first if it is gzip compressed, and checks that
+ * every Marker object is in it.
+ */
+public class HeapDumpStream {
+	static final class Marker {
+		final int id;
+
+		Marker(int id) {
+			this.id = id;
+		}
+	}
+
+	static Marker[] markers;
+
+	public static void main(String[] args) throws Exception {
+		if ("dump".equals(args[0])) {
+			int count = Integer.parseInt(args[1]);
+			markers = new Marker[count];
+			for (int i = 0; i < count; i++) {
+				markers[i] = new Marker(i);
+			}
+			System.out.println("MARKERS CREATED " + count);
+		} else if ("verify".equals(args[0])) {
+			verify(new File(args[1]), Integer.parseInt(args[2]));
+		}
+	}
+
+	static void verify(File dumpFile, int expected) throws Exception {
+		File phdFile = dumpFile;
+
+		if (dumpFile.getName().endsWith(".gz")) {
+			/* GZIPInputStream checks the CRC and length in the gzip trailer at the end of the stream */
+			phdFile = File.createTempFile("heapdump", ".phd", dumpFile.getParentFile());
+			phdFile.deleteOnExit();
+			try (InputStream in = new GZIPInputStream(new FileInputStream(dumpFile));
+				OutputStream out = new FileOutputStream(phdFile)
+			) {
+				byte[] buffer = new byte[64 * 1024];
+				for (int length = in.read(buffer); length >= 0; length = in.read(buffer)) {
+					out.write(buffer, 0, length);
+				}
+			}
+			System.out.println("GZIP STREAM VALID");
+		}
+
+		int found = 0;
+		Image image = new PHDImageFactory().getImage(phdFile);
+		try {
+			for (Iterator<?> spaces = image.getAddressSpaces(); spaces.hasNext();) {
+				ImageAddressSpace space = (ImageAddressSpace) spaces.next();
+				for (Iterator<?> processes = space.getProcesses(); processes.hasNext();) {
+					ImageProcess process = (ImageProcess) processes.next();
+					for (Iterator<?> runtimes = process.getRuntimes(); runtimes.hasNext();) {
+						JavaRuntime runtime = (JavaRuntime) runtimes.next();
+						for (Iterator<?> heaps = runtime.getHeaps(); heaps.hasNext();) {
+							JavaHeap heap = (JavaHeap) heaps.next();
+							for (Iterator<?> objects = heap.getObjects(); objects.hasNext();) {
+								Object object = objects.next();
+								if ((object instanceof JavaObject)
+									&& "HeapDumpStream$Marker".equals(((JavaObject) object).getJavaClass().getName())
+								) {
+									found += 1;
+								}
+							}
+						}
+					}
+				}
+			}
+		} finally {
+			image.close();
+		}
+
+		System.out.println("MARKERS FOUND " + found);
+		if (found == expected) {
+			System.out.println("PHD VALID");
+		} else {
+			System.out.println("PHD INVALID: expected " + expected + " markers");
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#!/bin/sh
+
+#
+# Copyright IBM Corp. and others 2026
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution and
+# is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following
+# Secondary Licenses when the conditions for such availability set
+# forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+# General Public License, version 2 with the GNU Classpath
+# Exception [1] and GNU General Public License, version 2 with the
+# OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] https://openjdk.org/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+#
+
+echo "start running script";
+# the expected arguments are:
+# $1 is the TEST_RESROOT
+# $2 is the java command, including the JVM options under test
+# $3 is the -Xdump:heap opts to test, e.g. PHD+STREAM
+# $4 is the name of the heap dump file the agent is expected to write, relative to the dump directory
+# $5 is the number of marker objects to put in the heap dump
+
+TEST_RESROOT=$1
+JAVA_EXE="$2"
+DUMP_OPTS=$3
+EXPECTED_FILE=$4
+NUM_MARKERS=$5
+
+DUMP_DIR=$(mktemp -d "${TMPDIR:-/tmp}/heapdumpTests.XXXXXX")
+
+# The markers are still reachable when the VM stops, so the heap dump written on vmstop must contain all of them
+$JAVA_EXE -Xdump:heap:none -Xdump:heap:events=vmstop,opts=$DUMP_OPTS,file=$DUMP_DIR/heapdump.phd \
+    $TEST_RESROOT/HeapDumpStream.java dump $NUM_MARKERS
+
+if [ -f "$DUMP_DIR/$EXPECTED_FILE" ]; then
+    echo "HEAP DUMP FILE EXISTS $EXPECTED_FILE"
+    $JAVA_EXE --add-exports openj9.dtfj/com.ibm.dtfj.phd=ALL-UNNAMED \
+        $TEST_RESROOT/HeapDumpStream.java verify $DUMP_DIR/$EXPECTED_FILE $NUM_MARKERS
+else
+    echo "HEAP DUMP FILE MISSING $EXPECTED_FILE"
+    ls -l $DUMP_DIR
+fi
+
+rm -rf $DUMP_DIR
+echo "finished script";
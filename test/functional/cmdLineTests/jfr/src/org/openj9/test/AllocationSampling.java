@@ -0,0 +1,98 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test;
+
+import java.nio.file.Paths;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+/**
+ * "allocate <threads> <seconds>" allocates from several threads for the given time, to be
+ * run with allocation sampling enabled. "verify <recording> <rate> <seconds>" checks that the
+ * recording holds jdk.ObjectAllocationSample events and no more than the throttle allows.
+ */
+public class AllocationSampling {
+	public static volatile Object sink;
+
+	public static void main(String[] args) throws Exception {
+		if ("allocate".equals(args[0])) {
+			allocate(Integer.parseInt(args[1]), Integer.parseInt(args[2]));
+		} else {
+			verify(args[1], Long.parseLong(args[2]), Long.parseLong(args[3]));
+		}
+	}
+
+	private static void allocate(int numberOfThreads, int seconds) throws InterruptedException {
+		final long end = System.nanoTime() + (seconds * 1000000000L);
+		Thread threads[] = new Thread[numberOfThreads];
+
+		for (int i = 0; i < numberOfThreads; i++) {
+			threads[i] = new Thread(() -> {
+				while (System.nanoTime() < end) {
+					for (int j = 0; j < 1000; j++) {
+						sink = new byte[j];
+						sink = new Object[j % 64];
+					}
+				}
+			});
+			threads[i].start();
+		}
+		for (int i = 0; i < numberOfThreads; i++) {
+			threads[i].join();
+		}
+
+		System.out.println("All runs complete.");
+	}
+
+	private static void verify(String recording, long rate, long seconds) throws Exception {
+		List<RecordedEvent> events = RecordingFile.readAllEvents(Paths.get(recording));
+		Map<Long, Long> perSecond = new HashMap<>();
+		long samples = 0;
+		long maxPerSecond = 0;
+
+		for (RecordedEvent event : events) {
+			if ("jdk.ObjectAllocationSample".equals(event.getEventType().getName())) {
+				long second = event.getStartTime().getEpochSecond();
+				long count = perSecond.merge(second, 1L, Long::sum);
+				maxPerSecond = Math.max(maxPerSecond, count);
+				samples += 1;
+			}
+		}
+
+		System.out.println("ObjectAllocationSample events: " + samples + ", at most " + maxPerSecond + " in one second");
+
+		if (0 == samples) {
+			System.out.println("FAILED: no ObjectAllocationSample events");
+		} else if (maxPerSecond > (2 * rate)) {
+			/* The throttle windows are not aligned with wall clock seconds, so one second can overlap two windows. */
+			System.out.println("FAILED: more than " + (2 * rate) + " samples in one second");
+		} else if (samples > (rate * (seconds + 2))) {
+			System.out.println("FAILED: more than " + (rate * (seconds + 2)) + " samples in " + seconds + " seconds");
+		} else {
+			System.out.println("ObjectAllocationSample rate is capped");
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Many threads emit events with deep stacks as fast as they can, so that
+ * thread buffers fill up at the same time and more of them are handed off
+ * than the flusher thread is allowed to hold.
+ */
+public class EventStress {
+	public static void main(String[] args) throws InterruptedException {
+		int numberOfThreads = 64;
+		int eventsPerThread = 20000;
+		int stackDepth = 40;
+
+		if (args.length > 0) {
+			numberOfThreads = Integer.parseInt(args[0]);
+		}
+
+		if (args.length > 1) {
+			eventsPerThread = Integer.parseInt(args[1]);
+		}
+
+		if (args.length > 2) {
+			stackDepth = Integer.parseInt(args[2]);
+		}
+
+		final int events = eventsPerThread;
+		final int depth = stackDepth;
+		final CountDownLatch start = new CountDownLatch(1);
+		final AtomicLong parks = new AtomicLong(0);
+		Thread threads[] = new Thread[numberOfThreads];
+
+		for (int i = 0; i < numberOfThreads; i++) {
+			threads[i] = new Thread(() -> {
+				try {
+					start.await();
+				} catch (InterruptedException e) {
+					e.printStackTrace();
+				}
+				parks.addAndGet(parkAtDepth(depth, events));
+			}, "EventStress-" + i);
+			threads[i].start();
+		}
+
+		start.countDown();
+		for (int i = 0; i < numberOfThreads; i++) {
+			threads[i].join();
+		}
+
+		System.out.println("All runs complete. " + parks.get() + " parks");
+	}
+
+	private static long parkAtDepth(int depth, int events) {
+		if (0 == depth) {
+			for (int i = 0; i < events; i++) {
+				LockSupport.parkNanos(1);
+			}
+			return events;
+		}
+
+		return parkAtDepth(depth - 1, events);
+	}
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test;
+
+import java.io.InputStream;
+import java.nio.file.Paths;
+import java.util.concurrent.Callable;
+
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.jfr.consumer.RecordedStackTrace;
+import jdk.jfr.consumer.RecordingFile;
+
+/**
+ * "run <seconds>" repeatedly loads Churn in a new class loader, runs it until it is JIT compiled,
+ * checks the Throwable and StackWalker frames it reports, then drops the loader so the class and its
+ * compiled code are unloaded. Run with a flight recording, "verify <recording>" then checks that
+ * every recorded Churn frame names a method and line of Churn.call().
+ */
+public class StackTraceUnloading {
+	public static volatile Object sink;
+
+	/* The first and last lines of Churn.call(), and the lines of the two stack captures within it. */
+	static final int CALL_FIRST_LINE = 50;
+	static final int THROWABLE_LINE = 53;
+	static final int WALKER_LINE = 54;
+	static final int CALL_LAST_LINE = 55;
+
+	public static class Churn implements Callable<Object[]> {
+		public Object[] call() {
+			for (int i = 0; i < 1000; i++) {
+				sink = new byte[i];
+			}
+			StackTraceElement element = new Throwable().getStackTrace()[0];
+			StackWalker.StackFrame frame = StackWalker.getInstance(StackWalker.Option.RETAIN_CLASS_REFERENCE).walk(s -> s.findFirst()).get();
+			return new Object[] { element, frame };
+		}
+	}
+
+	/* Defines its own copy of Churn and delegates everything else to the application class loader. */
+	static class ChurnLoader extends ClassLoader {
+		private final byte[] churnBytes;
+
+		ChurnLoader(byte[] churnBytes) {
+			super(StackTraceUnloading.class.getClassLoader());
+			this.churnBytes = churnBytes;
+		}
+
+		@Override
+		protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+			synchronized (getClassLoadingLock(name)) {
+				if (Churn.class.getName().equals(name)) {
+					Class<?> clazz = findLoadedClass(name);
+					if (null == clazz) {
+						clazz = defineClass(name, churnBytes, 0, churnBytes.length);
+					}
+					return clazz;
+				}
+				return super.loadClass(name, resolve);
+			}
+		}
+	}
+
+	public static void main(String[] args) throws Exception {
+		if ("run".equals(args[0])) {
+			run(Integer.parseInt(args[1]));
+		} else {
+			verify(args[1]);
+		}
+	}
+
+	private static boolean isCallLine(int line) {
+		return (CALL_FIRST_LINE <= line) && (line <= CALL_LAST_LINE);
+	}
+
+	private static void run(int seconds) throws Exception {
+		final long end = System.nanoTime() + (seconds * 1000000000L);
+		byte[] churnBytes;
+		int rounds = 0;
+
+		try (InputStream in = StackTraceUnloading.class.getResourceAsStream("StackTraceUnloading$Churn.class")) {
+			churnBytes = in.readAllBytes();
+		}
+
+		while (System.nanoTime() < end) {
+			Class<?> clazz = new ChurnLoader(churnBytes).loadClass(Churn.class.getName());
+			@SuppressWarnings("unchecked")
+			Callable<Object[]> churn = (Callable<Object[]>)clazz.getDeclaredConstructor().newInstance();
+
+			if (Churn.class == clazz) {
+				System.out.println("FAILED: Churn was not loaded by a new class loader");
+				return;
+			}
+			for (int i = 0; i < 2000; i++) {
+				Object[] frames = churn.call();
+				StackTraceElement element = (StackTraceElement)frames[0];
+				StackWalker.StackFrame frame = (StackWalker.StackFrame)frames[1];
+
+				if (!"call".equals(element.getMethodName()) || (THROWABLE_LINE != element.getLineNumber())) {
+					System.out.println("FAILED: Throwable reported " + element + " in round " + rounds);
+					return;
+				}
+				if ((clazz != frame.getDeclaringClass()) || !"call".equals(frame.getMethodName()) || (WALKER_LINE != frame.getLineNumber())) {
+					System.out.println("FAILED: StackWalker reported " + frame + " from " + frame.getDeclaringClass().getClassLoader() + " in round " + rounds);
+					return;
+				}
+			}
+
+			/* drop the loader so Churn and its compiled code can be unloaded */
+			clazz = null;
+			churn = null;
+			System.gc();
+			rounds += 1;
+		}
+
+		System.out.println("Rounds: " + rounds);
+		System.out.println("All runs complete.");
+	}
+
+	private static void verify(String recording) throws Exception {
+		long churnFrames = 0;
+
+		for (RecordedEvent event : RecordingFile.readAllEvents(Paths.get(recording))) {
+			RecordedStackTrace stackTrace = event.getStackTrace();
+			if (null == stackTrace) {
+				continue;
+			}
+			for (RecordedFrame frame : stackTrace.getFrames()) {
+				if (!frame.isJavaFrame() || !Churn.class.getName().equals(frame.getMethod().getType().getName())) {
+					continue;
+				}
+				String methodName = frame.getMethod().getName();
+				int line = frame.getLineNumber();
+				if (!(methodName.equals("call") || methodName.startsWith("lambda$call$") || methodName.equals("<init>"))
+					|| ((line > 0) && !methodName.equals("<init>") && !isCallLine(line))
+				) {
+					System.out.println("FAILED: " + event.getEventType().getName() + " event has frame " + methodName + ":" + line);
+					return;
+				}
+				churnFrames += 1;
+			}
+		}
+
+		System.out.println("Churn frames: " + churnFrames);
+		if (0 == churnFrames) {
+			System.out.println("FAILED: no recorded stack traces include Churn");
+		} else {
+			System.out.println("Recorded Churn frames are valid");
+		}
+	}
+}
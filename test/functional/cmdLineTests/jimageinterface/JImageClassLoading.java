@@ -0,0 +1,69 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+import java.util.zip.CRC32;
+
+/**
+ * Loads classes from several modules of the jimage file and uses a few of them,
+ * so that corrupt class bytes served from the jimage file are detected.
+ */
+public class JImageClassLoading {
+	static final String[] CLASS_NAMES = {
+		"java.sql.Connection",
+		"java.util.logging.Logger",
+		"java.net.http.HttpClient",
+		"javax.script.ScriptEngineManager",
+		"javax.xml.parsers.DocumentBuilderFactory",
+		"javax.naming.InitialContext",
+		"java.util.prefs.Preferences",
+		"java.lang.management.ManagementFactory",
+		"java.beans.PropertyChangeSupport",
+		"java.awt.Color",
+		"com.sun.tools.javac.main.JavaCompiler",
+	};
+
+	public static void main(String[] args) throws Exception {
+		int loaded = 0;
+		for (String className : CLASS_NAMES) {
+			try {
+				Class.forName(className, false, ClassLoader.getSystemClassLoader());
+				loaded += 1;
+			} catch (ClassNotFoundException e) {
+				/* Not every JDK image includes every module */
+				System.out.println("CLASS NOT IN IMAGE " + className);
+			}
+		}
+
+		CRC32 crc = new CRC32();
+		crc.update("jimage".getBytes("UTF-8"));
+		StringBuilder builder = new StringBuilder();
+		for (int i = 0; i < 10; i++) {
+			builder.append(String.format("%02d", i));
+		}
+
+		if ((0x1BB27EDDL == crc.getValue()) && "00010203040506070809".equals(builder.toString()) && (loaded > 0)) {
+			System.out.println("JIMAGE CLASSES LOADED " + loaded);
+		} else {
+			System.out.println("JIMAGE CLASS LOADING FAILED");
+		}
+	}
+}
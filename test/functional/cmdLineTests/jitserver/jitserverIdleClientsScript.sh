@@ -0,0 +1,96 @@
+#!/bin/sh
+
+#
+# Copyright IBM Corp. and others 2026
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution and
+# is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following
+# Secondary Licenses when the conditions for such availability set
+# forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+# General Public License, version 2 with the GNU Classpath
+# Exception [1] and GNU General Public License, version 2 with the
+# OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] https://openjdk.org/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+#
+
+echo "start running script";
+# the expected arguments are:
+# $1 is the TEST_ROOT
+# $2 is the TEST_JDK_BIN
+# $3 is the JITServer Options
+# $4 is the JVM Options
+# $5 is the number of idle clients
+# $6 optionally disables the server connection reactor when set to "disableReactor"
+
+TEST_ROOT=$1
+TEST_JDK_BIN=$2
+JITSERVER_OPTS="$3"
+JVM_OPTS="$4"
+NUM_CLIENTS=$5
+
+if [ "$6" == "disableReactor" ]; then
+    export TR_DisableJITServerConnectionReactor=1
+fi
+
+source $TEST_ROOT/jitserverconfig.sh
+
+JITSERVER_PORT=$(random_port)
+JITSERVER_OPTIONS="-XX:JITServerPort=$JITSERVER_PORT $JITSERVER_OPTS"
+
+echo "Starting $TEST_JDK_BIN/jitserver $JITSERVER_OPTIONS"
+$TEST_JDK_BIN/jitserver $JITSERVER_OPTIONS &
+JITSERVER_PID=$!
+sleep 2
+
+ps | grep $JITSERVER_PID | grep 'jitserver'
+if [ "$?" != 0 ]; then
+    echo "JITSERVER DOES NOT EXIST"
+    echo "finished script";
+    exit 0
+fi
+echo "JITSERVER EXISTS"
+
+# Each client compiles remotely for a few seconds and then stays idle for 20 seconds,
+# so all of its connections are parked on the server when the server is stopped.
+CLIENT_PIDS=""
+for i in $(seq 1 $NUM_CLIENTS); do
+    $TEST_JDK_BIN/java -XX:JITServerPort=$JITSERVER_PORT $JVM_OPTS $TEST_ROOT/IdleClient.java 20 &
+    CLIENT_PIDS="$CLIENT_PIDS $!"
+done
+sleep 12
+
+echo "Stopping $TEST_JDK_BIN/jitserver with SIGTERM"
+kill -TERM $JITSERVER_PID
+for i in $(seq 1 30); do
+    ps | grep $JITSERVER_PID | grep -q 'jitserver' || break
+    sleep 1
+done
+ps | grep $JITSERVER_PID | grep -q 'jitserver'
+if [ "$?" == 0 ]; then
+    echo "JITSERVER DID NOT SHUT DOWN"
+    kill -9 $JITSERVER_PID
+else
+    echo "JITSERVER SHUT DOWN"
+fi
+
+# The clients must carry on compiling locally after their parked connections were closed
+CLIENT_FAILURES=0
+for pid in $CLIENT_PIDS; do
+    wait $pid || CLIENT_FAILURES=$((CLIENT_FAILURES + 1))
+done
+if [ "$CLIENT_FAILURES" == 0 ]; then
+    echo "ALL IDLE CLIENTS EXITED NORMALLY"
+else
+    echo "$CLIENT_FAILURES IDLE CLIENTS FAILED"
+fi
+
+echo "finished script";
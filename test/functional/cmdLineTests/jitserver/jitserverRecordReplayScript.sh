@@ -0,0 +1,94 @@
+#!/bin/sh
+
+#
+# Copyright IBM Corp. and others 2026
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution and
+# is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following
+# Secondary Licenses when the conditions for such availability set
+# forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+# General Public License, version 2 with the GNU Classpath
+# Exception [1] and GNU General Public License, version 2 with the
+# OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] https://openjdk.org/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+
+echo "start running script";
+# the expected arguments are:
+# $1 is the TEST_ROOT
+# $2 is the TEST_JDK_BIN
+# $3 is the JITServer Options
+# $4 is the JVM Options
+
+TEST_ROOT=$1
+TEST_JDK_BIN=$2
+JITSERVER_OPTS="$3"
+JVM_OPTS="$4"
+
+source $TEST_ROOT/jitserverconfig.sh
+
+REPLAY_TOOL=$(find $TEST_JDK_BIN/.. -name jitserver_replay -type f 2>/dev/null | head -n 1)
+if [ -z "$REPLAY_TOOL" ]; then
+    echo "JITSERVER_REPLAY DOES NOT EXIST"
+    echo "finished script";
+    exit 0
+fi
+
+RECORDING=$(mktemp jitserverTraffic.XXXXXX)
+
+JITSERVER_PORT=$(random_port)
+JITSERVER_OPTIONS="-XX:JITServerPort=$JITSERVER_PORT $JITSERVER_OPTS"
+
+echo "Starting $TEST_JDK_BIN/jitserver $JITSERVER_OPTIONS"
+$TEST_JDK_BIN/jitserver $JITSERVER_OPTIONS &
+JITSERVER_PID=$!
+sleep 2
+
+ps | grep $JITSERVER_PID | grep 'jitserver'
+if [ "$?" != 0 ]; then
+    echo "JITSERVER DOES NOT EXIST"
+    rm -f $RECORDING
+    echo "finished script";
+    exit 0
+fi
+echo "JITSERVER EXISTS"
+
+# Record the traffic of a client compiling remotely
+$TEST_JDK_BIN/java -XX:JITServerPort=$JITSERVER_PORT -XX:JITServerRecordTraffic=$RECORDING $JVM_OPTS $TEST_ROOT/IdleClient.java 0
+if [ "$?" == 0 ] && [ -s $RECORDING ]; then
+    echo "TRAFFIC RECORDED"
+else
+    echo "TRAFFIC NOT RECORDED"
+fi
+
+# Replay the recording against the same server, once and then concurrently
+$REPLAY_TOOL -file $RECORDING -port $JITSERVER_PORT
+if [ "$?" == 0 ]; then
+    echo "REPLAY SUCCEEDED"
+else
+    echo "REPLAY FAILED"
+fi
+$REPLAY_TOOL -file $RECORDING -port $JITSERVER_PORT -clients 4 -iterations 2 -pid $JITSERVER_PID
+if [ "$?" == 0 ]; then
+    echo "CONCURRENT REPLAY SUCCEEDED"
+else
+    echo "CONCURRENT REPLAY FAILED"
+fi
+
+ps | grep $JITSERVER_PID | grep -q 'jitserver'
+if [ "$?" == 0 ]; then
+    echo "JITSERVER STILL RUNNING"
+fi
+
+kill -9 $JITSERVER_PID
+rm -f $RECORDING
+
+echo "finished script";
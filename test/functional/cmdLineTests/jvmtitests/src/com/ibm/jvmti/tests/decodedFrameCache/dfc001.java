@@ -0,0 +1,269 @@
+package com.ibm.jvmti.tests.decodedFrameCache;
+
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.function.Consumer;
+
+import com.ibm.jvmti.tests.util.CustomClassLoader;
+import com.ibm.jvmti.tests.util.Util;
+
+/* Checks that stack traces stay correct while the decoded frame cache holds entries for methods
+ * which are redefined, unloaded or breakpointed. The capture methods are called often enough
+ * to be JIT compiled, so both interpreted and compiled frames are decoded and cached.
+ */
+public class dfc001
+{
+	private static final String TEST_PACKAGE = "com.ibm.jvmti.tests.decodedFrameCache";
+	private static final String TEST_CLASS_NAME = TEST_PACKAGE + ".dfc001_testClass_O1";
+	private static final String CAPTURE_SIGNATURE = "(L" + TEST_PACKAGE.replace('.', '/') + "/dfc001$Capturer;)[Ljava/lang/Object;";
+	private static final int CALLS = 10000;
+	private static final int ROUNDS = 10;
+
+	public static native boolean redefineClass(Class originalClass, int classBytesSize, byte[] classBytes);
+	public static native boolean setBreakpoint(Class clazz, String methodName, String methodSig);
+	public static native boolean clearBreakpoint(Class clazz, String methodName, String methodSig);
+	public static native int getBreakpointCount();
+
+	/**
+	 * Captures the current stack and returns the topmost dfc001_testClass_O1 frame as
+	 * { method name, line number, declaring class or null if the API does not report it }.
+	 */
+	public interface Capturer
+	{
+		Object[] capture();
+	}
+
+	private static final Capturer[] capturers = createCapturers();
+
+	public boolean setup(String args)
+	{
+		return true;
+	}
+
+	private static Object[] findTestClassFrame(StackTraceElement[] elements)
+	{
+		for (StackTraceElement element : elements) {
+			if (TEST_CLASS_NAME.equals(element.getClassName())) {
+				return new Object[] { element.getMethodName(), Integer.valueOf(element.getLineNumber()), null };
+			}
+		}
+		return null;
+	}
+
+	private static Capturer[] createCapturers()
+	{
+		ArrayList<Capturer> list = new ArrayList<Capturer>();
+
+		list.add(new Capturer() {
+			public Object[] capture() {
+				return findTestClassFrame(new Throwable().getStackTrace());
+			}
+		});
+		list.add(new Capturer() {
+			public Object[] capture() {
+				return findTestClassFrame(Thread.currentThread().getStackTrace());
+			}
+		});
+
+		Capturer stackWalker = createStackWalkerCapturer();
+		if (null != stackWalker) {
+			list.add(stackWalker);
+		}
+
+		return list.toArray(new Capturer[list.size()]);
+	}
+
+	/* StackWalker is only available from Java 9, so it is driven through reflection */
+	private static Capturer createStackWalkerCapturer()
+	{
+		try {
+			Class<?> walkerClass = Class.forName("java.lang.StackWalker");
+			Class<?> optionClass = Class.forName("java.lang.StackWalker$Option");
+			Class<?> frameClass = Class.forName("java.lang.StackWalker$StackFrame");
+			final Object walker = walkerClass.getMethod("getInstance", optionClass).invoke(null, optionClass.getField("RETAIN_CLASS_REFERENCE").get(null));
+			final Method forEach = walkerClass.getMethod("forEach", Consumer.class);
+			final Method getClassName = frameClass.getMethod("getClassName");
+			final Method getMethodName = frameClass.getMethod("getMethodName");
+			final Method getLineNumber = frameClass.getMethod("getLineNumber");
+			final Method getDeclaringClass = frameClass.getMethod("getDeclaringClass");
+
+			return new Capturer() {
+				public Object[] capture() {
+					final Object[][] result = new Object[1][];
+					try {
+						forEach.invoke(walker, new Consumer<Object>() {
+							public void accept(Object frame) {
+								try {
+									if ((null == result[0]) && TEST_CLASS_NAME.equals(getClassName.invoke(frame))) {
+										result[0] = new Object[] { getMethodName.invoke(frame), getLineNumber.invoke(frame), getDeclaringClass.invoke(frame) };
+									}
+								} catch (ReflectiveOperationException e) {
+									throw new RuntimeException(e);
+								}
+							}
+						});
+					} catch (ReflectiveOperationException e) {
+						throw new RuntimeException(e);
+					}
+					return result[0];
+				}
+			};
+		} catch (ReflectiveOperationException e) {
+			return null;
+		}
+	}
+
+	private static boolean checkFrame(String what, Object[] frame, String methodName, int lineNumber, Class<?> declaringClass)
+	{
+		if (null == frame) {
+			System.out.println("ERROR: " + what + ": no " + TEST_CLASS_NAME + " frame found");
+			return false;
+		}
+		if (!methodName.equals(frame[0]) || (lineNumber != ((Integer)frame[1]).intValue())) {
+			System.out.println("ERROR: " + what + ": expected " + methodName + ":" + lineNumber + " but found " + frame[0] + ":" + frame[1]);
+			return false;
+		}
+		if ((null != frame[2]) && (declaringClass != frame[2])) {
+			System.out.println("ERROR: " + what + ": frame belongs to the class from " + ((Class<?>)frame[2]).getClassLoader()
+					+ " instead of the class from " + declaringClass.getClassLoader());
+			return false;
+		}
+		return true;
+	}
+
+	/* Calls the application loader's dfc001_testClass_O1 directly, so the capture methods can be inlined */
+	private static boolean checkTestClass(String what)
+	{
+		int captureLine = dfc001_testClass_O1.captureLine();
+		int otherLine = dfc001_testClass_O1.otherLine();
+
+		for (int i = 0; i < CALLS; i++) {
+			for (Capturer capturer : capturers) {
+				if (!checkFrame(what, dfc001_testClass_O1.capture(capturer), "capture", captureLine, dfc001_testClass_O1.class)) {
+					return false;
+				}
+				if (!checkFrame(what, dfc001_testClass_O1.other(capturer), "other", otherLine, dfc001_testClass_O1.class)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	public boolean testRedefinition()
+	{
+		if (!checkTestClass("original class")) {
+			return false;
+		}
+
+		for (int round = 0; round < ROUNDS; round++) {
+			Class<?> version = (0 == (round % 2)) ? dfc001_testClass_R1.class : dfc001_testClass_O1.class;
+
+			if (!Util.redefineClass(dfc001.class, dfc001_testClass_O1.class, version)) {
+				return false;
+			}
+			if (!checkTestClass("round " + round + " after redefinition to " + version.getSimpleName())) {
+				return false;
+			}
+		}
+
+		/* leave the original version in place for the remaining tests */
+		if (0 != (ROUNDS % 2)) {
+			return Util.redefineClass(dfc001.class, dfc001_testClass_O1.class, dfc001_testClass_O1.class);
+		}
+		return true;
+	}
+
+	public String helpRedefinition()
+	{
+		return "Redefine a class back and forth between versions with different line numbers and check that "
+				+ "Throwable, Thread and StackWalker stack traces report the lines of the current version.";
+	}
+
+	public boolean testBreakpoints()
+	{
+		int expectedBreakpoints = getBreakpointCount();
+
+		if (!checkTestClass("before breakpoints")) {
+			return false;
+		}
+
+		/* Setting a breakpoint gives the method a private copy of its bytecodes, which is freed when the
+		 * breakpoint is cleared. Alternate between the two methods so the copies are freed and reallocated.
+		 */
+		for (int round = 0; round < ROUNDS; round++) {
+			String methodName = (0 == (round % 2)) ? "capture" : "other";
+
+			if (!setBreakpoint(dfc001_testClass_O1.class, methodName, CAPTURE_SIGNATURE)) {
+				System.out.println("ERROR: could not set a breakpoint in " + methodName);
+				return false;
+			}
+			if (!checkTestClass("round " + round + " with a breakpoint in " + methodName)) {
+				clearBreakpoint(dfc001_testClass_O1.class, methodName, CAPTURE_SIGNATURE);
+				return false;
+			}
+			if (!clearBreakpoint(dfc001_testClass_O1.class, methodName, CAPTURE_SIGNATURE)) {
+				System.out.println("ERROR: could not clear the breakpoint in " + methodName);
+				return false;
+			}
+			expectedBreakpoints += CALLS * capturers.length;
+			if (!checkTestClass("round " + round + " after clearing the breakpoint in " + methodName)) {
+				return false;
+			}
+		}
+
+		if (getBreakpointCount() != expectedBreakpoints) {
+			System.out.println("ERROR: expected " + expectedBreakpoints + " breakpoint events but received " + getBreakpointCount());
+			return false;
+		}
+		return true;
+	}
+
+	public String helpBreakpoints()
+	{
+		return "Repeatedly set and clear breakpoints in methods whose stack traces were already decoded and check "
+				+ "that the reported method names and lines stay correct.";
+	}
+
+	public boolean testClassUnload() throws Exception
+	{
+		for (int round = 0; round < ROUNDS; round++) {
+			/* a fresh loader defines its own dfc001_testClass_O1, so every round has new methods and JIT bodies */
+			Class<?> clazz = new CustomClassLoader("O1").loadClass(TEST_PACKAGE + ".dfc001_testClass_");
+			Method capture = clazz.getMethod("capture", Capturer.class);
+			Method other = clazz.getMethod("other", Capturer.class);
+			int captureLine = ((Integer)clazz.getMethod("captureLine").invoke(null)).intValue();
+			int otherLine = ((Integer)clazz.getMethod("otherLine").invoke(null)).intValue();
+			String what = "round " + round + " in a new class loader";
+
+			if (dfc001_testClass_O1.class == clazz) {
+				System.out.println("ERROR: " + what + ": the class was loaded by the application class loader");
+				return false;
+			}
+
+			for (int i = 0; i < CALLS; i++) {
+				for (Capturer capturer : capturers) {
+					if (!checkFrame(what, (Object[])capture.invoke(null, capturer), "capture", captureLine, clazz)) {
+						return false;
+					}
+					if (!checkFrame(what, (Object[])other.invoke(null, capturer), "other", otherLine, clazz)) {
+						return false;
+					}
+				}
+			}
+
+			/* drop the loader so the class and its compiled code can be unloaded before the next round */
+			clazz = null;
+			capture = null;
+			other = null;
+			System.gc();
+		}
+		return true;
+	}
+
+	public String helpClassUnload()
+	{
+		return "Load, use and unload the same class in a series of class loaders and check that stack traces, "
+				+ "including StackWalker declaring classes, never report frames of an unloaded class.";
+	}
+}
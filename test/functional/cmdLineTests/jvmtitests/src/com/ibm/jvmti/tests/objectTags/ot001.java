@@ -0,0 +1,181 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.jvmti.tests.objectTags;
+
+import java.util.ArrayList;
+
+public class ot001
+{
+	private static final int OBJECT_COUNT = 5000;
+	private static final int THREAD_COUNT = 8;
+	private static final int OBJECTS_PER_THREAD = 500;
+	private static final int ITERATIONS = 200;
+
+	public static Object garbage;
+
+	public static native boolean tagObjects(Object[] objects, long firstTag);
+	public static native boolean checkTags(Object[] objects, long firstTag);
+	public static native boolean checkUntagged(Object[] objects);
+	public static native boolean retagObjects(Object[] objects, long firstTag, int iterations);
+
+	/* A mix of plain objects, arrays and strings, so that tagged objects of several shapes are moved */
+	private static Object[] allocateObjects(int count)
+	{
+		Object[] objects = new Object[count];
+		for (int i = 0; i < count; i++) {
+			switch (i % 4) {
+			case 0:
+				objects[i] = new Object();
+				break;
+			case 1:
+				objects[i] = new int[i % 64];
+				break;
+			case 2:
+				objects[i] = "ot001 " + i;
+				break;
+			default:
+				objects[i] = new ArrayList<Integer>(i % 16);
+				break;
+			}
+		}
+		return objects;
+	}
+
+	/* Fill the nursery several times over, so that surviving objects are copied by the collector */
+	private static void moveObjects()
+	{
+		for (int i = 0; i < 200000; i++) {
+			garbage = new byte[256];
+		}
+		System.gc();
+		for (int i = 0; i < 200000; i++) {
+			garbage = new byte[256];
+		}
+		System.gc();
+		garbage = null;
+	}
+
+	public boolean testTagsSurviveGC()
+	{
+		Object[] objects = allocateObjects(OBJECT_COUNT);
+		Object[] untagged = allocateObjects(OBJECT_COUNT);
+
+		if (!tagObjects(objects, 1)) {
+			return false;
+		}
+		if (!checkTags(objects, 1)) {
+			return false;
+		}
+
+		moveObjects();
+
+		if (!checkTags(objects, 1)) {
+			System.out.println("Tags were lost or corrupted after the tagged objects were moved");
+			return false;
+		}
+		if (!checkUntagged(untagged)) {
+			return false;
+		}
+
+		/* Drop every other object; the tags of the collected objects must disappear with them */
+		for (int i = 0; i < OBJECT_COUNT; i += 2) {
+			objects[i] = null;
+		}
+		moveObjects();
+
+		if (!checkTags(objects, 1)) {
+			System.out.println("Tags of collected objects were still reported after GC");
+			return false;
+		}
+
+		/* Retag the survivors with a new range, which must replace the old tags */
+		if (!tagObjects(objects, OBJECT_COUNT + 1)) {
+			return false;
+		}
+		moveObjects();
+
+		return checkTags(objects, OBJECT_COUNT + 1) && checkUntagged(untagged);
+	}
+
+	public String helpTagsSurviveGC()
+	{
+		return "Check that SetTag, GetTag and GetObjectsWithTags agree after GCs that move the tagged objects and free some of them";
+	}
+
+	public boolean testConcurrentTagging() throws InterruptedException
+	{
+		final Object[][] objects = new Object[THREAD_COUNT][];
+		final boolean[] results = new boolean[THREAD_COUNT];
+		final Thread[] threads = new Thread[THREAD_COUNT];
+		final boolean[] done = new boolean[1];
+		boolean rc = true;
+
+		for (int t = 0; t < THREAD_COUNT; t++) {
+			objects[t] = allocateObjects(OBJECTS_PER_THREAD);
+		}
+
+		/* Keep moving objects while the tagging threads run */
+		Thread collector = new Thread("ot001 collector") {
+			public void run() {
+				while (!done[0]) {
+					moveObjects();
+				}
+			}
+		};
+
+		for (int t = 0; t < THREAD_COUNT; t++) {
+			final int index = t;
+			threads[t] = new Thread("ot001 tagger " + t) {
+				public void run() {
+					results[index] = retagObjects(objects[index], 1 + ((long)index * OBJECTS_PER_THREAD), ITERATIONS);
+				}
+			};
+		}
+
+		collector.start();
+		for (int t = 0; t < THREAD_COUNT; t++) {
+			threads[t].start();
+		}
+		for (int t = 0; t < THREAD_COUNT; t++) {
+			threads[t].join();
+		}
+		done[0] = true;
+		collector.join();
+
+		for (int t = 0; t < THREAD_COUNT; t++) {
+			if (!results[t]) {
+				System.out.println("Tagging thread " + t + " failed");
+				rc = false;
+			} else if (!checkTags(objects[t], 1 + ((long)t * OBJECTS_PER_THREAD))) {
+				System.out.println("Tags set by thread " + t + " are wrong");
+				rc = false;
+			}
+		}
+
+		return rc;
+	}
+
+	public String helpConcurrentTagging()
+	{
+		return "Check that several threads can tag and untag their own objects at once while the GC moves them";
+	}
+}
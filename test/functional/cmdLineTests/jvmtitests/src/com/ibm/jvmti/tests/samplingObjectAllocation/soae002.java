@@ -0,0 +1,103 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.jvmti.tests.samplingObjectAllocation;
+
+import java.nio.file.Paths;
+
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedThread;
+import jdk.jfr.consumer.RecordingFile;
+
+/**
+ * Runs with JFR sampling allocations at a smaller interval than the JVMTI agent. The test
+ * method checks that JVMTI only posts events at its own interval, main("verify", recording)
+ * checks that the weights of the JFR samples of the allocating thread add up to what it
+ * allocated.
+ */
+public class soae002 {
+	private final static int JVMTI_SAMPLING_INTERVAL = 1024 * 1024; /* 1 MB */
+	private final static int ARRAY_SIZE = 8 * 1024;
+	private final static int ARRAY_COUNT = 16 * 1024;
+	/* the bytes allocated by the allocator thread, not counting the array headers */
+	private final static long ALLOCATED_BYTES = (long)ARRAY_SIZE * ARRAY_COUNT;
+	private final static String ALLOCATOR_NAME = "soae002-allocator";
+
+	public static volatile Object sink;
+
+	private native static int enable(Thread thread, int samplingInterval);	/* count the JVMTI_EVENT_SAMPLED_OBJECT_ALLOC events of thread */
+	private native static int disable();	/* disable event JVMTI_EVENT_SAMPLED_OBJECT_ALLOC */
+	private native static int check();	/* the number of events counted */
+
+	public boolean testOwnInterval() throws InterruptedException {
+		boolean result = false;
+		Thread allocator = new Thread(() -> {
+			for (int i = 0; i < ARRAY_COUNT; i++) {
+				sink = new byte[ARRAY_SIZE];
+			}
+		}, ALLOCATOR_NAME);
+
+		if (0 == enable(allocator, JVMTI_SAMPLING_INTERVAL)) {
+			allocator.start();
+			allocator.join();
+			int samplingResult = check();
+			long expected = ALLOCATED_BYTES / JVMTI_SAMPLING_INTERVAL;
+
+			/* JFR samples far more often, so events posted at its interval would exceed the bound by orders of magnitude */
+			if ((samplingResult < (expected / 2)) || (samplingResult > (expected * 2))) {
+				System.out.println("com.ibm.jvmti.tests.samplingObjectAllocation.soae002.check() failed, expected about " + expected + " but got: " + samplingResult);
+			} else {
+				result = true;
+			}
+			if (0 != disable()) {
+				result = false;
+			}
+		}
+
+		return result;
+	}
+	public String helpOwnInterval() {
+		return "Test that the JVMTI sampled object allocation event is posted at the JVMTI sampling interval while JFR samples allocations at a smaller one.";
+	}
+
+	public static void main(String[] args) throws Exception {
+		long weights = 0;
+		long samples = 0;
+
+		for (RecordedEvent event : RecordingFile.readAllEvents(Paths.get(args[0]))) {
+			if ("jdk.ObjectAllocationSample".equals(event.getEventType().getName())) {
+				RecordedThread thread = event.getThread("eventThread");
+				if ((null != thread) && ALLOCATOR_NAME.equals(thread.getJavaName())) {
+					weights += event.getLong("weight");
+					samples += 1;
+				}
+			}
+		}
+
+		System.out.println(ALLOCATOR_NAME + " samples: " + samples + " weights: " + weights + " allocated: " + ALLOCATED_BYTES);
+		/* The array headers and the bytes after the last sample account for the difference */
+		if ((0 == samples) || (weights < ((ALLOCATED_BYTES * 9) / 10)) || (weights > ((ALLOCATED_BYTES * 11) / 10))) {
+			System.out.println("FAILED: the JFR weights do not add up to the allocated bytes");
+		} else {
+			System.out.println("JFR weights match the allocated bytes");
+		}
+	}
+}